@@ -0,0 +1,245 @@
+/**
+ * [FILE] AssetCache.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the asset cache
+ * [DATE] 2021-06-10
+*/
+
+#include "AssetCache.h"
+#include <cstdio>
+
+/**
+ * [DESCRIPTION] Register a BMP file to be loaded
+ *
+ * [PARAM] path
+*/
+void AssetCache::addImage(const char* path)
+{
+	if (findImage(path) == NULL) {
+		images.push_back({ path, NULL, NULL });
+	}
+}
+
+/**
+ * [DESCRIPTION] Register a WAV file to be loaded
+ *
+ * [PARAM] path
+*/
+void AssetCache::addSound(const char* path)
+{
+	if (findSound(path) == NULL) {
+		sounds.push_back({ path, {}, false });
+	}
+}
+
+/**
+ * [DESCRIPTION] Register a ROM set to be mapped and verified
+ *
+ * [PARAM] manifest_path
+*/
+void AssetCache::addRomSet(const char* manifest_path)
+{
+	if (findRomSet(manifest_path) == NULL) {
+		roms.push_back({ manifest_path, NULL });
+	}
+}
+
+/**
+ * [DESCRIPTION] Start decoding every registered asset on worker threads, the
+ *               main thread is free to bring SDL up in the meantime
+ *      - Nothing may be added once loading has started
+ *
+*/
+void AssetCache::startLoading()
+{
+	pool = new WorkStealingPool(0);
+
+	// every task only writes its own entry
+	for (Image& image : images) {
+		Image* entry = &image;
+		pool->submit([entry]() {
+			entry->surface = SDL_LoadBMP(entry->path.c_str());
+		});
+	}
+	for (Sound& sound : sounds) {
+		Sound* entry = &sound;
+		pool->submit([entry]() {
+			entry->loaded = AudioEngine::decodeWav(entry->path.c_str(), entry->pcm);
+		});
+	}
+	for (Rom& rom : roms) {
+		Rom* entry = &rom;
+		pool->submit([entry]() {
+			entry->rom_set = RomSet::open(entry->manifest_path);
+		});
+	}
+
+	loader = std::thread(&WorkStealingPool::run, pool);
+}
+
+/**
+ * [DESCRIPTION] Wait for the workers to finish (failures are printed and leave
+ *               the asset NULL)
+ *
+*/
+void AssetCache::finishLoading()
+{
+	if (finished) {
+		return;
+	}
+	if (loader.joinable()) {
+		loader.join();
+	}
+	delete pool;
+	pool = NULL;
+	finished = true;
+
+	for (Image& image : images) {
+		if (image.surface == NULL) {
+			printf("ERROR LOADING %s\n", image.path.c_str());
+		}
+	}
+	for (Sound& sound : sounds) {
+		if (!sound.loaded) {
+			printf("ERROR LOADING %s\n", sound.path.c_str());
+		}
+	}
+	for (Rom& rom : roms) {
+		if (!rom.rom_set) {
+			printf("ERROR LOADING %s\n", rom.manifest_path.c_str());
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Return the decoded surface of an image
+ *
+ * [PARAM] path
+ * [RETURN] SDL_Surface* (NULL if it was not registered or failed to load)
+*/
+SDL_Surface* AssetCache::getSurface(const char* path)
+{
+	finishLoading();
+	Image* image = findImage(path);
+	return image != NULL ? image->surface : NULL;
+}
+
+/**
+ * [DESCRIPTION] Return the texture of an image, made the first time it is asked for
+ *
+ * [PARAM] renderer - the cache only serves one renderer
+ * [PARAM] path
+ * [RETURN] SDL_Texture* (NULL if it was not registered or failed to load)
+*/
+SDL_Texture* AssetCache::getTexture(SDL_Renderer* renderer, const char* path)
+{
+	finishLoading();
+	Image* image = findImage(path);
+	if (image == NULL || image->surface == NULL) {
+		return NULL;
+	}
+	if (image->texture == NULL) {
+		image->texture = SDL_CreateTextureFromSurface(renderer, image->surface);
+	}
+	return image->texture;
+}
+
+/**
+ * [DESCRIPTION] Return the decoded samples of a sound
+ *
+ * [PARAM] path
+ * [RETURN] const std::vector<int16_t>* (NULL if it was not registered or failed to load)
+*/
+const std::vector<int16_t>* AssetCache::getSound(const char* path)
+{
+	finishLoading();
+	Sound* sound = findSound(path);
+	return sound != NULL && sound->loaded ? &sound->pcm : NULL;
+}
+
+/**
+ * [DESCRIPTION] Return an opened ROM set, boards that open the same manifest
+ *               share its mapping while the cache holds it
+ *
+ * [PARAM] manifest_path
+ * [RETURN] std::shared_ptr<const RomSet> (NULL if it was not registered or failed to load)
+*/
+std::shared_ptr<const RomSet> AssetCache::getRomSet(const char* manifest_path)
+{
+	finishLoading();
+	Rom* rom = findRomSet(manifest_path);
+	return rom != NULL ? rom->rom_set : nullptr;
+}
+
+/**
+ * [DESCRIPTION] Find a registered image
+ *
+ * [PARAM] path
+*/
+AssetCache::Image* AssetCache::findImage(const char* path)
+{
+	for (Image& image : images) {
+		if (image.path == path) {
+			return &image;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * [DESCRIPTION] Find a registered sound
+ *
+ * [PARAM] path
+*/
+AssetCache::Sound* AssetCache::findSound(const char* path)
+{
+	for (Sound& sound : sounds) {
+		if (sound.path == path) {
+			return &sound;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * [DESCRIPTION] Find a registered ROM set
+ *
+ * [PARAM] manifest_path
+*/
+AssetCache::Rom* AssetCache::findRomSet(const char* manifest_path)
+{
+	for (Rom& rom : roms) {
+		if (rom.manifest_path == manifest_path) {
+			return &rom;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * [DESCRIPTION] Construct a new AssetCache object
+ *
+*/
+AssetCache::AssetCache()
+{
+	pool = NULL;
+	finished = false;
+}
+
+/**
+ * [DESCRIPTION] Destroy the AssetCache object, freeing every asset
+ *
+*/
+AssetCache::~AssetCache()
+{
+	if (loader.joinable()) {
+		loader.join();
+	}
+	delete pool;
+	for (Image& image : images) {
+		if (image.texture != NULL) {
+			SDL_DestroyTexture(image.texture);
+		}
+		SDL_FreeSurface(image.surface);
+	}
+}
@@ -0,0 +1,69 @@
+/**
+ * [FILE] AssetCache.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a cache of the images, sounds and ROM sets the front end uses,
+ *               decoded in parallel on worker threads while SDL starts up
+ * [DATE] 2021-06-10
+*/
+
+#pragma once
+#include <SDL.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AudioEngine.h"
+#include "RomSet.h"
+#include "WorkStealingPool.h"
+
+/**
+ * [DESCRIPTION] Class which loads every asset once and keeps it for the life of
+ *               the emulator (across game launches)
+ *      - Assets are registered with add*() and startLoading() hands them to a
+ *        work stealing pool running beside the main thread
+ *      - Worker threads only touch the disk and SDL surfaces, everything that
+ *        needs the renderer (textures) is made on the main thread in get*()
+*/
+class AssetCache {
+private:
+    // an image decoded to a surface, the texture is made on first use
+    struct Image {
+        std::string     path;
+        SDL_Surface*    surface;
+        SDL_Texture*    texture;
+    };
+    // a sound file decoded to the audio engine's PCM format
+    struct Sound {
+        std::string     path;
+        std::vector<int16_t> pcm;
+        bool            loaded;
+    };
+    // a ROM set held open so its mapping outlives the boards that use it
+    struct Rom {
+        std::string     manifest_path;
+        std::shared_ptr<const RomSet> rom_set;
+    };
+
+    std::vector<Image>  images;
+    std::vector<Sound>  sounds;
+    std::vector<Rom>    roms;
+    WorkStealingPool*   pool;           // decodes the assets (NULL once finished)
+    std::thread         loader;         // runs the pool beside the main thread
+    bool                finished;       // true once finishLoading has run
+
+    Image*          findImage(const char* path);
+    Sound*          findSound(const char* path);
+    Rom*            findRomSet(const char* manifest_path);
+public:
+    void            addImage(const char* path);             // register a BMP to load
+    void            addSound(const char* path);             // register a WAV to load
+    void            addRomSet(const char* manifest_path);   // register a ROM set to open
+    void            startLoading();                         // start decoding on worker threads
+    void            finishLoading();                        // wait for the workers
+    SDL_Surface*    getSurface(const char* path);
+    SDL_Texture*    getTexture(SDL_Renderer* renderer, const char* path);
+    const std::vector<int16_t>* getSound(const char* path);
+    std::shared_ptr<const RomSet> getRomSet(const char* manifest_path);
+    AssetCache();
+    ~AssetCache();                                          // call before SDL_Quit
+};
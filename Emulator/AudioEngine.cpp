@@ -0,0 +1,370 @@
+/**
+ * [FILE] AudioEngine.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the cycle stamped sample player
+ * [DATE] 2021-06-11
+*/
+
+#include "AudioEngine.h"
+#include <cstdio>
+#include <cstring>
+
+/**
+ * [DESCRIPTION] Add a voice playing the passed sample, a NULL sample makes a
+ *               voice that stays silent so a missing file is not an error
+ *
+ * [PARAM] pcm - has to stay alive until the engine is closed
+ * [RETURN] int (voice number, -1 if there are already MAX_VOICES)
+*/
+int AudioEngine::addVoice(const std::vector<int16_t>* pcm)
+{
+	if (num_voices == MAX_VOICES) {
+		return -1;
+	}
+	Voice& voice = voices[num_voices];
+	voice.pcm = pcm != NULL ? pcm->data() : NULL;
+	voice.length = pcm != NULL ? pcm->size() : 0;
+	voice.position = 0;
+	voice.playing = false;
+	voice.loop = false;
+	return num_voices++;
+}
+
+/**
+ * [DESCRIPTION] Open the default audio device and start the callback, SDL
+ *               converts to whatever the device really wants
+ *
+ * [RETURN] false if the device could not be opened (the engine stays silent)
+*/
+bool AudioEngine::open()
+{
+	SDL_AudioSpec want;
+	SDL_AudioSpec have;
+	memset(&want, 0, sizeof(want));
+	want.freq = SAMPLE_RATE;
+	want.format = AUDIO_S16SYS;
+	want.channels = 1;
+	want.samples = BUFFER_SAMPLES;
+	want.callback = audioCallback;
+	want.userdata = this;
+
+	device = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
+	if (device == 0) {
+		printf("Error opening audio device: %s\n", SDL_GetError());
+		return false;
+	}
+	accum.resize(have.samples > 0 ? have.samples : BUFFER_SAMPLES);
+	synced = false;
+	SDL_PauseAudioDevice(device, 0);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Stop the callback and close the device, SDL waits for a
+ *               callback that is running to return
+ *
+*/
+void AudioEngine::close()
+{
+	if (device != 0) {
+		SDL_CloseAudioDevice(device);
+		device = 0;
+	}
+}
+
+/**
+ * [DESCRIPTION] Queue a voice to start/loop/stop on the passed clock cycle
+ *
+ * [PARAM] cycle - emulated clock cycle the change happened on
+ * [PARAM] voice - number returned by addVoice
+ * [PARAM] action
+ * [RETURN] false if the voice is unknown or the ring was full (the trigger is dropped)
+*/
+bool AudioEngine::trigger(uint64_t cycle, int voice, Action action)
+{
+	if (voice < 0 || voice >= num_voices) {
+		return false;
+	}
+	return events->push({ cycle, (uint8_t)voice, (uint8_t)action });
+}
+
+/**
+ * [DESCRIPTION] Report the emulated clock, called once every triggers up to
+ *               the passed cycle have been queued
+ *
+ * [PARAM] cycle
+*/
+void AudioEngine::sync(uint64_t cycle)
+{
+	emulated_cycle.store(cycle, std::memory_order_release);
+}
+
+/**
+ * [DESCRIPTION] Play emulated time back faster or slower so the triggers stay
+ *               lined up when the emulation is not running at real time
+ *
+ * [PARAM] speed - multiple of real time (1.0 = normal)
+*/
+void AudioEngine::setSpeed(double speed)
+{
+	if (speed > 0) {
+		cycles_per_sample.store(base_cycles_per_sample * speed, std::memory_order_relaxed);
+	}
+}
+
+/**
+ * [DESCRIPTION] Return how far the emulation is ahead of the sample the device
+ *               asked for last, LATENCY cycles while the two clocks agree
+ *
+ * [PARAM] buffered - filled in on success
+ * [RETURN] false if the device is closed or has not lined up yet
+*/
+bool AudioEngine::getBufferedCycles(int64_t& buffered)
+{
+	uint64_t played = played_cycle.load(std::memory_order_acquire);
+	if (device == 0 || played == 0) {
+		return false;
+	}
+	buffered = (int64_t)(emulated_cycle.load(std::memory_order_relaxed) - played);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Return how many times playback had to jump to the emulated
+ *               time after it first lined up (each one is a skip or a repeat)
+ *
+ * [RETURN] uint32_t
+*/
+uint32_t AudioEngine::getResyncs()
+{
+	return resyncs.load(std::memory_order_relaxed);
+}
+
+/**
+ * [DESCRIPTION] Return how many of the jumps were back in time, playback had
+ *               caught up with the emulation and ran out of emulated sound
+ *
+ * [RETURN] uint32_t
+*/
+uint32_t AudioEngine::getUnderruns()
+{
+	return underruns.load(std::memory_order_relaxed);
+}
+
+/**
+ * [DESCRIPTION] SDL audio callback, runs on SDL's audio thread
+ *
+ * [PARAM] userdata - the engine
+ * [PARAM] stream - buffer to fill
+ * [PARAM] len - size of the buffer in bytes
+*/
+void SDLCALL AudioEngine::audioCallback(void* userdata, Uint8* stream, int len)
+{
+	AudioEngine* engine = (AudioEngine*)userdata;
+	int16_t* out = (int16_t*)stream;
+	int num_samples = len / (int)sizeof(int16_t);
+
+	// the device normally asks for exactly one buffer, bigger requests are split
+	while (num_samples > 0) {
+		int chunk = num_samples < (int)engine->accum.size() ? num_samples : (int)engine->accum.size();
+		engine->mix(out, chunk);
+		out += chunk;
+		num_samples -= chunk;
+	}
+}
+
+/**
+ * [DESCRIPTION] Mix the next samples, applying each queued trigger on the
+ *               sample its cycle falls on
+ *
+ * [PARAM] out
+ * [PARAM] num_samples - at most accum.size()
+*/
+void AudioEngine::mix(int16_t* out, int num_samples)
+{
+	double step = cycles_per_sample.load(std::memory_order_relaxed);
+	uint64_t emulated = emulated_cycle.load(std::memory_order_acquire);
+	double target = emulated > latency_cycles ? (double)(emulated - latency_cycles) : 0.0;
+
+	// RESYNC =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	// line back up with the emulation when it was paused, fast forwarded or
+	// its clock has wandered off the sound card's
+	if (!synced || play_cycle + drift_cycles < target || play_cycle > target + drift_cycles) {
+		if (synced) {
+			resyncs.fetch_add(1, std::memory_order_relaxed);
+			if (play_cycle > target + drift_cycles) {
+				underruns.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		play_cycle = target;
+		synced = true;
+	}
+
+	memset(accum.data(), 0, num_samples * sizeof(int32_t));
+	int done = 0;
+	while (done < num_samples) {
+		// apply every trigger due on the current sample and find the next one
+		int run = num_samples - done;
+		while (has_pending || events->pop(pending)) {
+			has_pending = true;
+			double ahead = ((double)pending.cycle - play_cycle) / step;
+			if (ahead >= 1.0) {
+				if (ahead < run) {
+					run = (int)ahead;
+				}
+				break;
+			}
+			// a sound that should have started long ago (before a resync) is dropped
+			if (pending.action != ACTION_PLAY || pending.cycle + drift_cycles >= play_cycle) {
+				applyEvent(pending);
+			}
+			has_pending = false;
+		}
+
+		renderVoices(&accum[done], run);
+		done += run;
+		play_cycle += run * step;
+	}
+
+	for (int i = 0; i < num_samples; i++) {
+		int32_t sample = accum[i];
+		out[i] = (int16_t)(sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : sample));
+	}
+	played_cycle.store(play_cycle > 1.0 ? (uint64_t)play_cycle : 1, std::memory_order_release);
+}
+
+/**
+ * [DESCRIPTION] Add every playing voice into the mix buffer
+ *
+ * [PARAM] out
+ * [PARAM] num_samples
+*/
+void AudioEngine::renderVoices(int32_t* out, int num_samples)
+{
+	for (int v = 0; v < num_voices; v++) {
+		Voice& voice = voices[v];
+		int filled = 0;
+		while (voice.playing && filled < num_samples) {
+			size_t left = voice.length - voice.position;
+			int count = (size_t)(num_samples - filled) < left ? num_samples - filled : (int)left;
+			const int16_t* pcm = voice.pcm + voice.position;
+			for (int i = 0; i < count; i++) {
+				out[filled + i] += pcm[i];
+			}
+			filled += count;
+			voice.position += count;
+			if (voice.position == voice.length) {
+				voice.position = 0;
+				voice.playing = voice.loop;
+			}
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Start/loop/stop a voice
+ *
+ * [PARAM] evnt
+*/
+void AudioEngine::applyEvent(const Event& evnt)
+{
+	Voice& voice = voices[evnt.voice];
+	switch (evnt.action) {
+	case ACTION_PLAY:
+		voice.position = 0;
+		voice.playing = voice.length > 0;
+		voice.loop = false;
+		break;
+	case ACTION_LOOP:
+		if (!voice.playing || !voice.loop) {
+			voice.position = 0;
+		}
+		voice.playing = voice.length > 0;
+		voice.loop = true;
+		break;
+	case ACTION_STOP:
+		voice.playing = false;
+		voice.loop = false;
+		break;
+	}
+}
+
+/**
+ * [DESCRIPTION] Load a WAV file and convert it to mono 16 bit PCM at SAMPLE_RATE,
+ *               safe to call from worker threads
+ *
+ * [PARAM] path
+ * [PARAM] pcm - filled in on success
+ * [RETURN] false if the file could not be loaded or converted
+*/
+bool AudioEngine::decodeWav(const char* path, std::vector<int16_t>& pcm)
+{
+	SDL_AudioSpec spec;
+	Uint8* wav = NULL;
+	Uint32 wav_len = 0;
+	if (SDL_LoadWAV(path, &spec, &wav, &wav_len) == NULL) {
+		return false;
+	}
+
+	SDL_AudioCVT cvt;
+	if (SDL_BuildAudioCVT(&cvt, spec.format, spec.channels, spec.freq, AUDIO_S16SYS, 1, SAMPLE_RATE) < 0) {
+		SDL_FreeWAV(wav);
+		return false;
+	}
+	cvt.len = (int)wav_len;
+	cvt.buf = (Uint8*)SDL_malloc((size_t)wav_len * cvt.len_mult);
+	if (cvt.buf == NULL) {
+		SDL_FreeWAV(wav);
+		return false;
+	}
+	memcpy(cvt.buf, wav, wav_len);
+	SDL_FreeWAV(wav);
+
+	bool ok = true;
+	if (cvt.needed) {
+		ok = SDL_ConvertAudio(&cvt) == 0;
+	}
+	else {
+		cvt.len_cvt = cvt.len;
+	}
+	if (ok) {
+		const int16_t* samples = (const int16_t*)cvt.buf;
+		pcm.assign(samples, samples + cvt.len_cvt / sizeof(int16_t));
+	}
+	SDL_free(cvt.buf);
+	return ok;
+}
+
+/**
+ * [DESCRIPTION] Construct a new AudioEngine object
+ *
+ * [PARAM] cycles_per_second - emulated clock rate
+ * [PARAM] latency - cycles playback trails the emulation by
+ * [PARAM] drift - cycles playback may wander from that before it jumps
+*/
+AudioEngine::AudioEngine(uint64_t cycles_per_second, uint64_t latency, uint64_t drift)
+{
+	events.reset(new SpscRing<Event, 1024>());
+	num_voices = 0;
+	emulated_cycle = 0;
+	played_cycle = 0;
+	resyncs = 0;
+	underruns = 0;
+	base_cycles_per_sample = (double)cycles_per_second / SAMPLE_RATE;
+	cycles_per_sample = base_cycles_per_sample;
+	latency_cycles = latency;
+	drift_cycles = drift;
+	device = 0;
+	play_cycle = 0;
+	synced = false;
+	has_pending = false;
+}
+
+/**
+ * [DESCRIPTION] Destroy the AudioEngine object, closing the device
+ *
+*/
+AudioEngine::~AudioEngine()
+{
+	close();
+}
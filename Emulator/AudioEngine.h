@@ -0,0 +1,96 @@
+/**
+ * [FILE] AudioEngine.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a sample player that mixes preloaded sounds on the SDL
+ *               audio thread, started and stopped on exact emulated clock cycles
+ * [DATE] 2021-06-11
+*/
+
+#pragma once
+#include <SDL.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "SpscRing.h"
+
+/**
+ * [DESCRIPTION] Class representing the audio output of an emulated machine
+ *      - Samples are mono 16 bit PCM at SAMPLE_RATE, decodeWav converts a WAV
+ *        file into that format ahead of time
+ *      - The emulation thread stamps every trigger with the clock cycle it
+ *        happened on and pushes it through a lock free ring, it never waits
+ *        on the audio thread
+ *      - The audio callback plays back emulated time LATENCY cycles behind the
+ *        last cycle the emulation reported with sync(), so every trigger lands
+ *        on the output sample matching its cycle
+ *      - If the two clocks drift more than DRIFT cycles apart (pause, speed
+ *        change, fast forward) the callback jumps to the emulated time again
+ *      - getBufferedCycles tells the emulation how much emulated time is
+ *        queued ahead of the device, so the device can be the master clock
+ *        (the emulation steers its speed to keep it at LATENCY)
+*/
+class AudioEngine {
+public:
+    static const int    SAMPLE_RATE = 44100;    // output samples per second
+    static const int    BUFFER_SAMPLES = 512;   // samples per callback (11.6 ms)
+    static const int    MAX_VOICES = 16;
+
+    enum Action : uint8_t {
+        ACTION_PLAY,        // play the sample once from the start
+        ACTION_LOOP,        // repeat the sample until stopped (no restart if already looping)
+        ACTION_STOP         // silence the voice
+    };
+private:
+    // a trigger handed from the emulation thread to the audio thread
+    struct Event {
+        uint64_t    cycle;
+        uint8_t     voice;
+        uint8_t     action;
+    };
+    // one sample player, only touched by the audio thread once the device is open
+    struct Voice {
+        const int16_t*  pcm;
+        size_t          length;
+        size_t          position;
+        bool            playing;
+        bool            loop;
+    };
+
+    Voice                   voices[MAX_VOICES];
+    int                     num_voices;
+    std::unique_ptr<SpscRing<Event, 1024>> events;  // emulation thread -> audio thread (held by pointer, see SpscRing)
+    std::atomic<uint64_t>   emulated_cycle;     // last cycle reported by sync()
+    std::atomic<uint64_t>   played_cycle;       // play_cycle after the last callback (0 until synced)
+    std::atomic<uint32_t>   resyncs;            // jumps after the first line up
+    std::atomic<uint32_t>   underruns;          // jumps back because playback ran out of emulated time
+    std::atomic<double>     cycles_per_sample;  // emulated cycles per output sample
+    double                  base_cycles_per_sample; // at normal speed
+    uint64_t                latency_cycles;     // how far playback trails the emulation
+    uint64_t                drift_cycles;       // how far it may wander before jumping
+    SDL_AudioDeviceID       device;             // 0 while closed
+
+    // AUDIO THREAD =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    double                  play_cycle;         // emulated cycle of the next output sample
+    bool                    synced;             // false until the first callback has lined up
+    Event                   pending;            // popped but not yet due
+    bool                    has_pending;
+    std::vector<int32_t>    accum;              // mix buffer (sized when the device opens)
+    static void SDLCALL     audioCallback(void* userdata, Uint8* stream, int len);
+    void                    mix(int16_t* out, int num_samples);
+    void                    renderVoices(int32_t* out, int num_samples);
+    void                    applyEvent(const Event& evnt);
+public:
+    int     addVoice(const std::vector<int16_t>* pcm);  // add a voice (before open), returns its number
+    bool    open();                                     // open the device and start playing
+    void    close();                                    // stop playing and close the device
+    bool    trigger(uint64_t cycle, int voice, Action action);  // emulation thread, never blocks
+    void    sync(uint64_t cycle);                       // emulation thread, report the current cycle
+    void    setSpeed(double speed);                     // multiple of real time the emulation runs at
+    bool    getBufferedCycles(int64_t& buffered);       // emulated cycles queued ahead of the device
+    uint32_t getResyncs();                              // times playback jumped to the emulation
+    uint32_t getUnderruns();                            // the jumps back, playback had run out of sound
+    static bool decodeWav(const char* path, std::vector<int16_t>& pcm); // load a WAV as engine PCM
+    AudioEngine(uint64_t cycles_per_second, uint64_t latency, uint64_t drift);
+    ~AudioEngine();
+};
@@ -30,8 +30,8 @@ bool Emulator::initSDL()
 			"8080 Emulator",			// title of the window
 			SDL_WINDOWPOS_CENTERED,		// x pos of window on screen
 			SDL_WINDOWPOS_CENTERED,		// y pos of window on screen
-			WIND_WIDTH,					// width of window
-			WIND_HEIGHT,				// height of window
+			WIND_WIDTH * options.scale,	// width of window
+			WIND_HEIGHT * options.scale,// height of window
 			SDL_WINDOW_SHOWN			// flag to show window when created
 		);
 		// check that the window was successfully created before moving on
@@ -70,15 +70,6 @@ bool Emulator::initSDL()
 				}
 			}
 		}
-
-		// Initialize Sound Mixer
-		if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
-			// Error message if can't initialize
-			printf("Error initializing Sound Mixer\n");
-		}
-
-		// Amount of channels (Max amount of sounds playing at the same time)
-		Mix_AllocateChannels(2);
 	}
 	return load_success;
 }
@@ -95,17 +86,31 @@ void Emulator::displayMainMenu()
 	// event to handle 
 	SDL_Event evnt;
 
-	// show the loading screen
+	// show the loading screen until the workers have decoded every asset
 	SDL_Surface* imageLoader = SDL_LoadBMP("Emulator/bmp_files/loading_screen.bmp");
 	SDL_Texture* loading_screen = SDL_CreateTextureFromSurface(gwRenderer, imageLoader);
 	SDL_RenderCopy(gwRenderer, loading_screen, NULL, NULL);
 	SDL_RenderPresent(gwRenderer);
-	SDL_Delay(5000);
+	logPhase("splash shown");
+	assets->finishLoading();
+	logPhase("assets loaded");
 	SDL_FreeSurface(imageLoader);
 	SDL_DestroyTexture(loading_screen);
 
+	// show the first menu screen straight away
+	menuAnimation(false);
+	logPhase("menu shown");
+
+	// time the menu animation moves on to its next screen
+	Uint32 next_animation = SDL_GetTicks() + 200;
 
 	while (!quit_flag) {
+		// sleep until there is an event or the animation is due
+		Uint32 now = SDL_GetTicks();
+		if (now < next_animation) {
+			SDL_WaitEventTimeout(NULL, (int)(next_animation - now));
+		}
+
 		// look at the event queue and handle events on it until
 		// there are none left to handle (the queue is empty)
 		while (SDL_PollEvent(&evnt) != 0) {
@@ -137,8 +142,10 @@ void Emulator::displayMainMenu()
 			}
 		}
 		// after the events have been handled switch to the next screen
-		menuAnimation(false);
-		SDL_Delay(200);
+		if (SDL_GetTicks() >= next_animation) {
+			menuAnimation(false);
+			next_animation = SDL_GetTicks() + 200;
+		}
 	}
 	// destory the menu textures
 	menuAnimation(true);
@@ -151,25 +158,13 @@ void Emulator::displayMainMenu()
 */
 void Emulator::menuAnimation(bool destroy_flag)
 {
-	// declare the static variables curresponding to the textures loaded
-	static SDL_Texture* gwMenu_1 = NULL;
-	static SDL_Texture* gwMenu_2 = NULL;
-	static SDL_Texture* gwMenu_3 = NULL;
-
-	// check if the images need to be loaded and if so load them
+	// check if the images need to be loaded and if so take them from the cache
 	if (gwMenu_1 == NULL) {
-		SDL_Surface* imageLoader = SDL_LoadBMP("Emulator/bmp_files/menu_1.bmp");
-		gwMenu_1 = SDL_CreateTextureFromSurface(gwRenderer, imageLoader);
-		imageLoader = SDL_LoadBMP("Emulator/bmp_files/menu_2.bmp");
-		gwMenu_2 = SDL_CreateTextureFromSurface(gwRenderer, imageLoader);
-		imageLoader = SDL_LoadBMP("Emulator/bmp_files/menu_3.bmp");
-		gwMenu_3 = SDL_CreateTextureFromSurface(gwRenderer, imageLoader);
-		SDL_FreeSurface(imageLoader);
+		gwMenu_1 = assets->getTexture(gwRenderer, "Emulator/bmp_files/menu_1.bmp");
+		gwMenu_2 = assets->getTexture(gwRenderer, "Emulator/bmp_files/menu_2.bmp");
+		gwMenu_3 = assets->getTexture(gwRenderer, "Emulator/bmp_files/menu_3.bmp");
 	}
 
-	// keeps track of the current background image of the menu
-	static int cur_menu_ind = 1;
-
 	switch (cur_menu_ind) {
 	case 1:
 		SDL_RenderCopy(gwRenderer, gwMenu_2, NULL, NULL);
@@ -187,13 +182,11 @@ void Emulator::menuAnimation(bool destroy_flag)
 
 	SDL_RenderPresent(gwRenderer);
 
-	// check if the destroy flag is set, if it is destroy the textures
+	// check if the destroy flag is set, if it is let go of the textures
+	// (the asset cache frees them)
 	if (destroy_flag) {
-		SDL_DestroyTexture(gwMenu_1);
 		gwMenu_1 = NULL;
-		SDL_DestroyTexture(gwMenu_2);
 		gwMenu_2 = NULL;
-		SDL_DestroyTexture(gwMenu_3);
 		gwMenu_3 = NULL;
 	}
 
@@ -205,6 +198,10 @@ void Emulator::menuAnimation(bool destroy_flag)
 */
 void Emulator::closeGameWindow()
 {
+	// the cached textures have to go before the renderer
+	delete assets;
+	assets = NULL;
+
 	// release the window variable
 	SDL_DestroyWindow(gameWindow);
 	gameWindow = NULL;
@@ -229,12 +226,34 @@ void Emulator::closeGameWindow()
  * [DESCRIPTION] Construct a new Emulator:: Emulator object
  * 
 */
-Emulator::Emulator()
+Emulator::Emulator(const EmulatorOptions& p_options)
 {
+	start_micro = HostTimer::nowMicro();
+	options = p_options;
+
+	// decode every asset on worker threads while SDL comes up
+	assets = new AssetCache;
+	assets->addImage("Emulator/bmp_files/menu_1.bmp");
+	assets->addImage("Emulator/bmp_files/menu_2.bmp");
+	assets->addImage("Emulator/bmp_files/menu_3.bmp");
+	SpaceInvaders::addAssets(*assets, options);
+	assets->startLoading();
+
 	initSDL();
+	logPhase("sdl ready");
 	displayMainMenu();
 };
 
+/**
+ * [DESCRIPTION] Print how long after launch a startup phase finished
+ *
+ * [PARAM] phase
+*/
+void Emulator::logPhase(const char* phase)
+{
+	printf("[startup] %-16s %8.1f ms\n", phase, (HostTimer::nowMicro() - start_micro) / 1000.0);
+}
+
 /**
  * [DESCRIPTION] Destroy the Emulator:: Emulator object
  * 
@@ -251,6 +270,7 @@ Emulator::~Emulator()
 void Emulator::runSpaceInvaders()
 {
 	SpaceInvaders* game;
-	game = new SpaceInvaders(gwRenderer, gameController_1, gameController_2);
+	game = new SpaceInvaders(gwRenderer, gameController_1, gameController_2, options, assets);
 	game->runGame();
+	delete game;
 }
@@ -11,12 +11,14 @@
 
 #pragma once
 #include <SDL.h>
-#include <SDL_mixer.h>;
 #include <stdio.h>
 #include <string>
 #include <math.h> 
 #include <iostream>
 #include "../SpaceInvaders/SpaceInvaders.h"
+#include "EmulatorOptions.h"
+#include "AssetCache.h"
+#include "HostTimer.h"
 
 /**
  * [DESCRIPTION] Class which contains SDL interactions and pathways to begin
@@ -33,7 +35,15 @@ class Emulator {
         bool initSDL();					            // initializes the game window
         void displayMainMenu();				    // wait for the user to make a selection 
         void menuAnimation(bool destroy_flag);	    // handle the main menu animation
+        SDL_Texture*    gwMenu_1 = NULL;            // menu animation frames
+        SDL_Texture*    gwMenu_2 = NULL;
+        SDL_Texture*    gwMenu_3 = NULL;
+        int             cur_menu_ind = 1;           // current background image of the menu
         void closeGameWindow();					    // shut down procedure for the game
+        EmulatorOptions options;                    // command line options
+        AssetCache*     assets = NULL;              // images/sounds/ROMs kept across games
+        uint64_t        start_micro = 0;            // host time the emulator was launched
+        void logPhase(const char* phase);           // print the time a startup phase finished
     public:
         /* =-=-=-= SDL MEMBERS =-=-=-= */
         SDL_Joystick*   gameController_1 = NULL;    // variable to hold handle to joystick1
@@ -41,7 +51,7 @@ class Emulator {
         SDL_Window*     gameWindow = NULL;			// main window for game
         SDL_Renderer*   gwRenderer = NULL;		    // main renderer
 
-        Emulator();
+        Emulator(const EmulatorOptions& p_options);
         ~Emulator();
         void runSpaceInvaders();				    // run space invaders on the emulator
 };
\ No newline at end of file
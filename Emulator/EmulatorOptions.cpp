@@ -0,0 +1,386 @@
+/**
+ * [FILE] EmulatorOptions.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the command line parsing for the emulator options
+ * [DATE] 2021-06-04
+*/
+
+#include "EmulatorOptions.h"
+#include "../SpaceInvaders/SiBoard.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * [DESCRIPTION] Fill in the options from the command line arguments
+ *
+ * [PARAM] argc
+ * [PARAM] argv
+ * [RETURN] false if an argument could not be parsed
+*/
+bool EmulatorOptions::parse(int argc, char* argv[])
+{
+	for (int i = 1; i < argc; i++) {
+		bool has_value = (i + 1) < argc;
+		if (strcmp(argv[i], "--record") == 0 && has_value) {
+			record_path = argv[++i];
+		}
+		else if (strcmp(argv[i], "--replay") == 0 && has_value) {
+			replay_path = argv[++i];
+		}
+		else if (strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+		}
+		else if (strcmp(argv[i], "--speed") == 0 && has_value) {
+			speed = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--paused") == 0) {
+			paused = true;
+		}
+		else if (strcmp(argv[i], "--pixel-bits") == 0 && has_value) {
+			pixel_bits = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--scale") == 0 && has_value) {
+			scale = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--scanlines") == 0) {
+			scanlines = true;
+		}
+		else if (strcmp(argv[i], "--overlay") == 0) {
+			overlay = true;
+		}
+		else if (strcmp(argv[i], "--latency") == 0) {
+			latency = true;
+		}
+		else if (strcmp(argv[i], "--late-input") == 0) {
+			late_input = true;
+		}
+		else if (strcmp(argv[i], "--audio-sync") == 0) {
+			audio_sync = true;
+		}
+		else if (strcmp(argv[i], "--run-ahead") == 0 && has_value) {
+			run_ahead = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--record-video") == 0 && has_value) {
+			record_video = argv[++i];
+		}
+		else if (strcmp(argv[i], "--export-video") == 0 && has_value) {
+			export_video = argv[++i];
+		}
+		else if (strcmp(argv[i], "--export-to") == 0 && has_value) {
+			export_to = argv[++i];
+		}
+		else if (strcmp(argv[i], "--export-start") == 0 && has_value) {
+			export_start = strtoull(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--perf-overlay") == 0) {
+			perf_overlay = true;
+		}
+		else if (strcmp(argv[i], "--metrics") == 0) {
+			metrics = true;
+		}
+		else if (strcmp(argv[i], "--metrics-socket") == 0 && has_value) {
+			metrics = true;
+			metrics_socket = argv[++i];
+		}
+		else if (strcmp(argv[i], "--metrics-read") == 0 && has_value) {
+			metrics_read = strtoull(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--hash-out") == 0 && has_value) {
+			hash_out = argv[++i];
+		}
+		else if (strcmp(argv[i], "--hash-check") == 0 && has_value) {
+			hash_check = argv[++i];
+		}
+		else if (strcmp(argv[i], "--batch") == 0 && has_value) {
+			batch_runs = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--batch-movie") == 0 && has_value) {
+			batch_movies.push_back(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--seed") == 0 && has_value) {
+			batch_seed = strtoull(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--frames") == 0 && has_value) {
+			frames = strtoull(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--threads") == 0 && has_value) {
+			threads = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--interpreter") == 0) {
+			interpreter = true;
+		}
+		else if (strcmp(argv[i], "--diff") == 0 && has_value) {
+			diff_engine = argv[++i];
+		}
+		else if (strcmp(argv[i], "--diff-every") == 0 && has_value) {
+			diff_every = strtoull(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--diff-random") == 0 && has_value) {
+			diff_random = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--diff-program") == 0 && has_value) {
+			diff_programs.push_back(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--board") == 0 && has_value) {
+			board = argv[++i];
+		}
+		else if (strcmp(argv[i], "--trace") == 0) {
+			trace = true;
+		}
+		else if (strcmp(argv[i], "--profile") == 0) {
+			profile = true;
+		}
+		else if (strcmp(argv[i], "--recompile") == 0 && has_value) {
+			recompile_path = argv[++i];
+		}
+		else if (strcmp(argv[i], "--watch") == 0 && has_value) {
+			Watch watch;
+			if (!parseWatch(argv[++i], watch)) {
+				printf("Bad watchpoint: %s (expected <r|w|x>:<addr>[-<addr>][=<value>] in hex)\n", argv[i]);
+				return false;
+			}
+			watches.push_back(watch);
+		}
+		else if (strcmp(argv[i], "--break") == 0 && has_value) {
+			char* end;
+			unsigned long address = strtoul(argv[++i], &end, 16);
+			if (*end != '\0' || end == argv[i] || address > 0xFFFF) {
+				printf("Bad breakpoint: %s (expected a hex address)\n", argv[i]);
+				return false;
+			}
+			watches.push_back({ (uint16_t)address, (uint16_t)address, 4, -1 });
+		}
+		else {
+			printf("Unknown argument: %s\n", argv[i]);
+			return false;
+		}
+	}
+
+	// headless runs have no user so they need input from somewhere
+	if (headless && replay_path == nullptr && !isBatch()) {
+		printf("--headless requires --replay\n");
+		return false;
+	}
+	if (speed < 0) {
+		printf("--speed can not be negative\n");
+		return false;
+	}
+	if (pixel_bits != 32 && pixel_bits != 16 && pixel_bits != 8) {
+		printf("--pixel-bits must be 32, 16 or 8\n");
+		return false;
+	}
+	if (scale < 1 || scale > 3) {
+		printf("--scale must be 1, 2 or 3\n");
+		return false;
+	}
+	if (scanlines && scale == 1) {
+		printf("--scanlines needs --scale 2 or 3\n");
+		return false;
+	}
+	if ((scale > 1 || overlay) && pixel_bits != 32) {
+		printf("--scale and --overlay need --pixel-bits 32\n");
+		return false;
+	}
+	if ((latency || late_input) && (headless || isBatch() || replay_path != nullptr)) {
+		printf("--latency and --late-input need the game window played live (not --headless, --batch or --replay)\n");
+		return false;
+	}
+	if (run_ahead < 0 || run_ahead > 4) {
+		printf("--run-ahead must be 0 to 4 frames\n");
+		return false;
+	}
+	if (run_ahead > 0 && (headless || isBatch() || replay_path != nullptr || latency || late_input || trace)) {
+		printf("--run-ahead can not be used with --headless, --batch, --replay, --latency, --late-input or --trace\n");
+		return false;
+	}
+	if (perf_overlay && (headless || isBatch())) {
+		printf("--perf-overlay needs the game window (not --headless or --batch)\n");
+		return false;
+	}
+	if (record_video != nullptr && (isBatch() || diff_engine != nullptr || recompile_path != nullptr)) {
+		printf("--record-video needs the game window or --headless (not --batch, --diff or --recompile)\n");
+		return false;
+	}
+	if ((export_video != nullptr) != (export_to != nullptr)) {
+		printf("--export-video and --export-to go together\n");
+		return false;
+	}
+	if (metrics && (isBatch() || diff_engine != nullptr || recompile_path != nullptr)) {
+		printf("--metrics needs the game window or --headless (not --batch, --diff or --recompile)\n");
+		return false;
+	}
+	if ((hash_out != nullptr || hash_check != nullptr) && !headless) {
+		printf("--hash-out and --hash-check need --headless\n");
+		return false;
+	}
+	if (hash_out != nullptr && hash_check != nullptr) {
+		printf("--hash-out and --hash-check can not be used together\n");
+		return false;
+	}
+	if (audio_sync && (headless || isBatch())) {
+		printf("--audio-sync needs the game window (not --headless or --batch)\n");
+		return false;
+	}
+	if (!watches.empty() && !headless && !isBatch()) {
+		printf("--watch and --break need --headless or --batch\n");
+		return false;
+	}
+	if (SiBoard::find(board) == NULL) {
+		printf("Unknown board: %s, the boards are:\n", board);
+		SiBoard::printBoards();
+		return false;
+	}
+	if (recompile_path != nullptr && strcmp(board, SiBoards::INVADERS.name) != 0) {
+		printf("--recompile only builds the %s blocks\n", SiBoards::INVADERS.name);
+		return false;
+	}
+	if (diff_engine != nullptr && strcmp(diff_engine, "recompiled") != 0) {
+		printf("--diff must be recompiled\n");
+		return false;
+	}
+	if (diff_engine != nullptr && !isBatch() && diff_random <= 0 && diff_programs.empty()) {
+		printf("--diff needs sessions: --batch, --batch-movie, --diff-random or --diff-program\n");
+		return false;
+	}
+	if (diff_engine != nullptr && (!watches.empty() || trace || interpreter)) {
+		printf("--diff can not be used with --watch, --break, --trace or --interpreter\n");
+		return false;
+	}
+	if (diff_every == 0) {
+		printf("--diff-every must be at least 1\n");
+		return false;
+	}
+	if (trace && isBatch()) {
+		printf("--trace can not be used with --batch (every run would write the same file)\n");
+		return false;
+	}
+	if (profile && (!headless || isBatch())) {
+		printf("--profile needs --headless (not --batch)\n");
+		return false;
+	}
+	if (record_path != nullptr && replay_path != nullptr) {
+		printf("--record and --replay can not be used together\n");
+		return false;
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Print the accepted command line arguments
+ *
+*/
+void EmulatorOptions::printUsage()
+{
+	printf("Usage: Emulator_8080 [options]\n");
+	printf("  --record <file>   record the game input to a movie file\n");
+	printf("  --replay <file>   play the game input back from a movie file\n");
+	printf("  --headless        run the replay without a window at full speed\n");
+	printf("  --speed <x>       run at x times real time, 0 runs as fast as possible (default 1)\n");
+	printf("  --paused          start paused, N steps a frame and P resumes\n");
+	printf("  --pixel-bits <n>  bits per pixel of the game texture: 32, 16 or 8 (default 32)\n");
+	printf("  --scale <n>       scale the window and game screen 1, 2 or 3 times (default 1)\n");
+	printf("  --scanlines       darken the last row of every scaled game row\n");
+	printf("  --overlay         color the game screen with the cabinet's red/green gel strips\n");
+	printf("  --latency         measure the input to screen latency, printed when the game ends\n");
+	printf("  --late-input      sample the input again just before the game reads it each frame\n");
+	printf("  --audio-sync      make the sound card the master clock (the speed is steered up to 0.5%%)\n");
+	printf("  --run-ahead <n>   show the screen n frames ahead of the game (1-4) to hide its input lag\n");
+	printf("  --record-video <file>  record every frame's screen and sound writes, compressed\n");
+	printf("  --export-video <file>  convert a --record-video recording to the --export-to video and exit\n");
+	printf("  --export-to <file>     .y4m video the export is written to\n");
+	printf("  --export-start <n>     first frame of the recording to export (default 0)\n");
+	printf("  --perf-overlay    show the clock speed, opcodes per second and frame times over the window\n");
+	printf("  --metrics         publish the counters in shared memory (/i8080_metrics_<pid>)\n");
+	printf("  --metrics-socket <path>  publish them and serve them as Prometheus text on a Unix socket\n");
+	printf("  --metrics-read <pid>     print the counters another emulator process publishes and exit\n");
+	printf("  --hash-out <file>   write every frame's screen and machine state hashes (with --headless)\n");
+	printf("  --hash-check <file> check every frame against a --hash-out file, stop at the first mismatch\n");
+	printf("  --batch <runs>    run this many random policy games headless in parallel\n");
+	printf("  --batch-movie <file>  add a movie run to the batch (can be repeated)\n");
+	printf("  --seed <n>        seed of the first random policy run (default 1)\n");
+	printf("  --frames <n>      frames per batch run (default 3600)\n");
+	printf("  --threads <n>     worker threads for the batch (default every core)\n");
+	printf("  --interpreter     run every opcode on the interpreter instead of the recompiled ROM\n");
+	printf("  --diff <engine>   compare recompiled against the interpreter on the --batch,\n");
+	printf("                    --batch-movie, --diff-random and --diff-program sessions\n");
+	printf("  --diff-every <n>  compare memory and ports every n steps (default 1000)\n");
+	printf("  --diff-random <n> add n random instruction streams to the --diff sessions\n");
+	printf("  --diff-program <file>  add a CP/M .COM program (e.g. an 8080 exerciser) to the --diff sessions\n");
+	printf("  --board <name>    the board of the family to run, only invaders (default) so far\n");
+	printf("  --trace           log the cpu state of every opcode to Opcode_Log_i8080.txt\n");
+	printf("  --profile         print the runs and cycles of every instruction after a headless run\n");
+	printf("  --recompile <file>  write the ROM recompiled to C++ (SiRecompiledBlocks.cpp) and exit\n");
+	printf("  --watch <spec>    stop a headless/batch run on a memory access, spec is\n");
+	printf("                    <r|w|x...>:<addr>[-<addr>][=<value>] in hex, e.g. w:20f8-20f9\n");
+	printf("  --break <addr>    stop a headless/batch run before the opcode at addr (hex)\n");
+}
+
+/**
+ * [DESCRIPTION] Parse a watchpoint spec, <kinds>:<addr>[-<addr>][=<value>]
+ *               with kinds any of r/w/x and the numbers in hex
+ *
+ * [PARAM] text
+ * [PARAM] watch - filled in on success
+ * [RETURN] false if the spec is malformed
+*/
+bool EmulatorOptions::parseWatch(const char* text, Watch& watch)
+{
+	watch.kinds = 0;
+	for (; *text != ':' && *text != '\0'; text++) {
+		if (*text == 'r') {
+			watch.kinds |= 1;
+		}
+		else if (*text == 'w') {
+			watch.kinds |= 2;
+		}
+		else if (*text == 'x') {
+			watch.kinds |= 4;
+		}
+		else {
+			return false;
+		}
+	}
+	if (watch.kinds == 0 || *text != ':') {
+		return false;
+	}
+
+	char* end;
+	unsigned long first = strtoul(++text, &end, 16);
+	unsigned long last = first;
+	if (end == text) {
+		return false;
+	}
+	if (*end == '-') {
+		text = end + 1;
+		last = strtoul(text, &end, 16);
+		if (end == text) {
+			return false;
+		}
+	}
+	watch.value = -1;
+	if (*end == '=') {
+		text = end + 1;
+		unsigned long value = strtoul(text, &end, 16);
+		if (end == text || value > 0xFF) {
+			return false;
+		}
+		watch.value = (int)value;
+	}
+	if (*end != '\0' || first > last || last > 0xFFFF) {
+		return false;
+	}
+	watch.first = (uint16_t)first;
+	watch.last = (uint16_t)last;
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Check if a batch of headless runs was requested
+ *
+ * [RETURN] true if there is at least one batch run
+*/
+bool EmulatorOptions::isBatch() const
+{
+	return batch_runs > 0 || !batch_movies.empty();
+}
@@ -0,0 +1,72 @@
+/**
+ * [FILE] EmulatorOptions.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the options that can be passed to the emulator on the
+ *               command line
+ * [DATE] 2021-06-04
+*/
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Options that change how the emulator runs
+ *
+*/
+struct EmulatorOptions {
+    // a memory watchpoint or PC breakpoint from --watch/--break
+    struct Watch {
+        uint16_t    first;
+        uint16_t    last;                   // inclusive
+        uint8_t     kinds;                  // 1 = read, 2 = write, 4 = execute
+        int         value;                  // byte to match, -1 = any
+    };
+
+    const char* record_path = nullptr;      // record the input ports to this movie
+    const char* replay_path = nullptr;      // play the input ports back from this movie
+    const char* record_video = nullptr;     // record every frame's screen and sound writes (SiVideo)
+    const char* export_video = nullptr;     // convert this recording to a standard video and exit
+    const char* export_to   = nullptr;      // .y4m file the export is written to
+    uint64_t    export_start = 0;           // first frame of the recording to export
+    bool        headless    = false;        // run without SDL (requires replay_path)
+    double      speed       = 1.0;          // multiple of real time, 0 = unthrottled
+    bool        paused      = false;        // start paused (frames are stepped by hand)
+    int         pixel_bits  = 32;           // bits per pixel of the game texture (32, 16 or 8)
+    int         scale       = 1;            // integer scale of the window and game screen (1-3)
+    bool        scanlines   = false;        // darken every scale'th row of the game screen
+    bool        overlay     = false;        // color the game screen like the cabinet's gel strips
+    bool        latency     = false;        // measure the input to screen latency of the game window
+    bool        late_input  = false;        // sample the input again just before the game reads it
+    bool        audio_sync  = false;        // steer the speed to the sound card's clock
+    int         run_ahead   = 0;            // frames the screen is shown ahead of the game (0 = off)
+    bool        perf_overlay = false;       // draw clock speed, opcodes and frame times over the window
+    bool        metrics     = false;        // publish the counters in a shared memory segment
+    const char* metrics_socket = nullptr;   // also serve them as Prometheus text on this Unix socket
+    uint64_t    metrics_read = 0;           // print the counters of this process id and exit
+    const char* hash_out    = nullptr;      // write every frame's screen and state hashes (SiGolden)
+    const char* hash_check  = nullptr;      // check every frame against these hashes (SiGolden)
+
+    // BATCH RUNS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    int         batch_runs  = 0;            // number of random policy runs
+    std::vector<const char*> batch_movies;  // movies to run, one run each
+    uint64_t    batch_seed  = 1;            // seed of the first random policy run
+    uint64_t    frames      = 3600;         // frames per batch run (60 seconds)
+    int         threads     = 0;            // worker threads, 0 = every core
+    std::vector<Watch> watches;             // stop headless/batch runs when one matches
+    bool        interpreter = false;        // run every opcode on the interpreter (no recompiled blocks)
+    const char* recompile_path = nullptr;   // write the recompiled ROM blocks to this file and exit
+    const char* diff_engine = nullptr;      // compare this engine against the interpreter (SiDiff)
+    uint64_t    diff_every  = 1000;         // compare memory and ports every this many steps
+    int         diff_random = 0;            // random instruction streams to compare
+    std::vector<const char*> diff_programs; // CP/M programs (.COM) to compare
+    const char* board       = "invaders";   // board of the Space Invaders family to run (SiBoard.h)
+    bool        trace       = false;        // log opcodes to Opcode_Log_i8080.txt (not in batch runs)
+    bool        profile     = false;        // print the cycles every instruction took after a headless run
+
+    bool        parse(int argc, char* argv[]);  // fill in the options from argv
+    bool        isBatch() const;                // true if batch runs were requested
+    static void printUsage();                   // print the accepted arguments
+private:
+    static bool parseWatch(const char* text, Watch& watch);
+};
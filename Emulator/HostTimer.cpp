@@ -0,0 +1,83 @@
+/**
+ * [FILE] HostTimer.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the host sleep timers
+ * [DATE] 2021-06-10
+*/
+
+#include "HostTimer.h"
+#include "../i8080/i8080.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <cerrno>
+#include <ctime>
+#endif
+
+/**
+ * [DESCRIPTION] Return the host time in micro seconds, read from the cpu's
+ *               clock so the pacing and the sleeps share one time source
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t HostTimer::nowMicro()
+{
+	return i8080::i8080_Clock::nowMicro();
+}
+
+/**
+ * [DESCRIPTION] Sleep on the OS timer until SPIN_MICRO before the deadline then
+ *               spin the rest of the way, returns straight away if the deadline
+ *               has already passed
+ *
+ * [PARAM] deadline_micro - host time (nowMicro) to return at
+*/
+void HostTimer::sleepUntil(uint64_t deadline_micro)
+{
+	uint64_t now = nowMicro();
+	if (deadline_micro > now + SPIN_MICRO) {
+		uint64_t sleep_micro = deadline_micro - SPIN_MICRO - now;
+#ifdef _WIN32
+		// high resolution timers need Windows 10 1803, older versions fall
+		// back to a normal timer (the spin covers most of its lateness)
+		static HANDLE timer = NULL;
+		if (timer == NULL) {
+			timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+			if (timer == NULL) {
+				timer = CreateWaitableTimerW(NULL, TRUE, NULL);
+			}
+		}
+
+		// negative due times are relative, in 100 ns units
+		LARGE_INTEGER due;
+		due.QuadPart = -(LONGLONG)(sleep_micro * 10);
+		if (timer != NULL && SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE)) {
+			WaitForSingleObject(timer, INFINITE);
+		}
+		else {
+			Sleep((DWORD)(sleep_micro / 1000));
+		}
+#else
+		// absolute deadline on the monotonic clock so a signal that
+		// interrupts the sleep does not push the wakeup back
+		timespec wake;
+		clock_gettime(CLOCK_MONOTONIC, &wake);
+		wake.tv_sec += (time_t)(sleep_micro / 1000000);
+		wake.tv_nsec += (long)(sleep_micro % 1000000) * 1000;
+		if (wake.tv_nsec >= 1000000000) {
+			wake.tv_sec++;
+			wake.tv_nsec -= 1000000000;
+		}
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) == EINTR) {
+		}
+#endif
+	}
+
+	// the last stretch is too short for the OS timer to hit reliably
+	while (nowMicro() < deadline_micro) {
+	}
+}
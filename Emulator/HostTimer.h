@@ -0,0 +1,28 @@
+/**
+ * [FILE] HostTimer.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains low cpu waiting on the host clock, used to sleep until
+ *               the next emulated frame is due instead of busy spinning
+ * [DATE] 2021-06-10
+*/
+
+#pragma once
+#include <cstdint>
+
+/**
+ * [DESCRIPTION] Class wrapping the host's sleep timers
+ *      - Times are micro seconds on the steady clock, nowMicro is
+ *        i8080_Clock::nowMicro (the time source the pacing uses)
+ *      - The thread sleeps on the OS timer until shortly before the deadline
+ *        and spins for the rest, OS wakeups are late by up to SPIN_MICRO
+*/
+class HostTimer {
+public:
+#ifdef _WIN32
+    static const uint64_t SPIN_MICRO = 1000;    // waitable timers wake up within ~0.5 ms
+#else
+    static const uint64_t SPIN_MICRO = 300;     // clock_nanosleep wakes up within ~0.1 ms
+#endif
+    static uint64_t nowMicro();                 // host time in micro seconds
+    static void     sleepUntil(uint64_t deadline_micro);   // sleep, then spin until the deadline
+};
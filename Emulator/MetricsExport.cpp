@@ -0,0 +1,448 @@
+/**
+ * [FILE] MetricsExport.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the shared memory counters and
+ *               their Prometheus text endpoint
+ * [DATE] 2021-06-18
+*/
+
+#include "MetricsExport.h"
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// the segment is read in place by other processes, the atomics must be plain words
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "64 bit atomics must be lock free");
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "atomics must not change the layout");
+
+static const char METRICS_MAGIC[8] = { 'I', '8', '0', '8', '0', 'M', 'E', 'T' };
+
+/**
+ * [DESCRIPTION] Return the id of this process
+ *
+ * [RETURN] uint64_t
+*/
+static uint64_t currentProcessId()
+{
+#ifdef _WIN32
+	return (uint64_t)GetCurrentProcessId();
+#else
+	return (uint64_t)getpid();
+#endif
+}
+
+/**
+ * [DESCRIPTION] Create this process's segment and publish zeroed counters
+ *
+ * [RETURN] false if the segment could not be made (the reason is printed)
+*/
+bool MetricsExport::create()
+{
+	uint64_t pid = currentProcessId();
+	if (!mapSegment(pid, true)) {
+		return false;
+	}
+	owner = true;
+	layout->version = VERSION;
+	layout->size = (uint32_t)sizeof(Layout);
+	layout->pid = pid;
+	// the magic goes in last, a reader that sees it sees a whole header
+	std::atomic_thread_fence(std::memory_order_release);
+	memcpy(layout->magic, METRICS_MAGIC, sizeof(METRICS_MAGIC));
+	printf("metrics: publishing to %s\n", getSegmentName(pid).c_str());
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Map the segment of another process read only and check that it
+ *               has the layout this build knows
+ *
+ * [PARAM] pid
+ * [RETURN] false if there is no such segment or its layout differs
+*/
+bool MetricsExport::attach(uint64_t pid)
+{
+	if (!mapSegment(pid, false)) {
+		return false;
+	}
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (memcmp(layout->magic, METRICS_MAGIC, sizeof(METRICS_MAGIC)) != 0 ||
+		layout->version != VERSION || layout->size != sizeof(Layout)) {
+		printf("METRICS SEGMENT %s IS NOT VERSION %u (%u bytes)\n", getSegmentName(pid).c_str(), VERSION,
+			(unsigned int)sizeof(Layout));
+		return false;
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Count a frame and write the totals to the segment, only ever
+ *               called from the emulation thread
+ *
+ * [PARAM] totals - the emulation's running totals after the frame
+ * [PARAM] frame_micro - host time the frame took to run
+*/
+void MetricsExport::publishFrame(const Totals& totals, uint64_t frame_micro)
+{
+	frames++;
+	frame_micro_total += frame_micro;
+	int bucket = 0;
+	for (uint64_t limit = 1000; frame_micro >= limit && bucket < NUM_BUCKETS - 1; limit *= 2) {
+		bucket++;
+	}
+	frame_buckets[bucket]++;
+	if (layout == NULL) {
+		return;
+	}
+
+	// readers retry while the sequence is odd or has moved under them
+	uint64_t sequence = layout->sequence.load(std::memory_order_relaxed);
+	layout->sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	layout->counters[COUNTER_CYCLES].store(totals.cycles, std::memory_order_relaxed);
+	layout->counters[COUNTER_INSTRUCTIONS].store(totals.instructions, std::memory_order_relaxed);
+	layout->counters[COUNTER_FRAMES].store(frames, std::memory_order_relaxed);
+	layout->counters[COUNTER_INTERRUPTS].store(totals.interrupts, std::memory_order_relaxed);
+	layout->counters[COUNTER_AUDIO_UNDERRUNS].store(totals.audio_underruns, std::memory_order_relaxed);
+	layout->counters[COUNTER_FRAME_MICRO].store(frame_micro_total, std::memory_order_relaxed);
+	layout->frame_buckets[bucket].store(frame_buckets[bucket], std::memory_order_relaxed);
+	layout->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+/**
+ * [DESCRIPTION] Copy the counters, retrying while the emulation thread is in
+ *               the middle of writing them
+ *
+ * [PARAM] snapshot
+ * [RETURN] false if nothing is mapped or no consistent copy was made
+*/
+bool MetricsExport::read(Snapshot& snapshot) const
+{
+	if (layout == NULL) {
+		return false;
+	}
+	for (int attempt = 0; attempt < 1000; attempt++) {
+		uint64_t before = layout->sequence.load(std::memory_order_acquire);
+		if ((before & 1) == 0) {
+			snapshot.pid = layout->pid;
+			for (int i = 0; i < NUM_COUNTERS; i++) {
+				snapshot.counters[i] = layout->counters[i].load(std::memory_order_relaxed);
+			}
+			for (int i = 0; i < NUM_BUCKETS; i++) {
+				snapshot.frame_buckets[i] = layout->frame_buckets[i].load(std::memory_order_relaxed);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (layout->sequence.load(std::memory_order_relaxed) == before) {
+				return true;
+			}
+		}
+		std::this_thread::yield();
+	}
+	return false;
+}
+
+/**
+ * [DESCRIPTION] Format the counters in the Prometheus text format (version 0.0.4),
+ *               the frame times as a histogram in seconds
+ *
+ * [PARAM] snapshot
+ * [RETURN] std::string
+*/
+std::string MetricsExport::formatPrometheus(const Snapshot& snapshot)
+{
+	static const char* const NAMES[NUM_COUNTERS - 1] = {
+		"i8080_cycles_total", "i8080_instructions_total", "i8080_frames_total",
+		"i8080_interrupts_total", "i8080_audio_underruns_total"
+	};
+	static const char* const HELP[NUM_COUNTERS - 1] = {
+		"Emulated clock cycles run.", "Opcodes run.", "Emulated frames run.",
+		"Interrupts taken by the cpu.", "Times audio playback caught up with the emulation."
+	};
+
+	std::string text;
+	char line[256];
+	for (int i = 0; i < NUM_COUNTERS - 1; i++) {
+		snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s counter\n%s{pid=\"%llu\"} %llu\n", NAMES[i], HELP[i],
+			NAMES[i], NAMES[i], (unsigned long long)snapshot.pid, (unsigned long long)snapshot.counters[i]);
+		text += line;
+	}
+
+	// HISTOGRAM =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	// the segment holds a count per bucket, Prometheus wants running totals
+	text += "# HELP i8080_frame_seconds Host time spent running an emulated frame.\n";
+	text += "# TYPE i8080_frame_seconds histogram\n";
+	uint64_t cumulative = 0;
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		cumulative += snapshot.frame_buckets[i];
+		if (i < NUM_BUCKETS - 1) {
+			snprintf(line, sizeof(line), "i8080_frame_seconds_bucket{pid=\"%llu\",le=\"%g\"} %llu\n",
+				(unsigned long long)snapshot.pid, (1000 << i) / 1000000.0, (unsigned long long)cumulative);
+		}
+		else {
+			snprintf(line, sizeof(line), "i8080_frame_seconds_bucket{pid=\"%llu\",le=\"+Inf\"} %llu\n",
+				(unsigned long long)snapshot.pid, (unsigned long long)cumulative);
+		}
+		text += line;
+	}
+	snprintf(line, sizeof(line), "i8080_frame_seconds_sum{pid=\"%llu\"} %.6f\ni8080_frame_seconds_count{pid=\"%llu\"} %llu\n",
+		(unsigned long long)snapshot.pid, snapshot.counters[COUNTER_FRAME_MICRO] / 1000000.0,
+		(unsigned long long)snapshot.pid, (unsigned long long)cumulative);
+	text += line;
+	return text;
+}
+
+/**
+ * [DESCRIPTION] Return the name of a process's segment
+ *
+ * [PARAM] pid
+ * [RETURN] std::string
+*/
+std::string MetricsExport::getSegmentName(uint64_t pid)
+{
+	char name[64];
+#ifdef _WIN32
+	snprintf(name, sizeof(name), "Local\\i8080_metrics_%llu", (unsigned long long)pid);
+#else
+	snprintf(name, sizeof(name), "/i8080_metrics_%llu", (unsigned long long)pid);
+#endif
+	return name;
+}
+
+/**
+ * [DESCRIPTION] Print the counters of another emulator process (--metrics-read)
+ *
+ * [PARAM] pid
+ * [RETURN] int (0 on success)
+*/
+int MetricsExport::printProcess(uint64_t pid)
+{
+	MetricsExport reader;
+	Snapshot snapshot;
+	if (!reader.attach(pid)) {
+		return 1;
+	}
+	if (!reader.read(snapshot)) {
+		printf("METRICS SEGMENT %s KEPT CHANGING WHILE IT WAS READ\n", getSegmentName(pid).c_str());
+		return 1;
+	}
+	fputs(formatPrometheus(snapshot).c_str(), stdout);
+	return 0;
+}
+
+/**
+ * [DESCRIPTION] Map a process's segment, creating it (read/write) or opening an
+ *               existing one (read only)
+ *
+ * [PARAM] pid
+ * [PARAM] create
+ * [RETURN] false if it could not be mapped (the reason is printed)
+*/
+bool MetricsExport::mapSegment(uint64_t pid, bool create)
+{
+	std::string name = getSegmentName(pid);
+#ifdef _WIN32
+	// pages of a new mapping start out zeroed
+	HANDLE handle = create ?
+		CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD)sizeof(Layout), name.c_str()) :
+		OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+	void* view = handle != NULL ?
+		MapViewOfFile(handle, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, sizeof(Layout)) : NULL;
+	if (view == NULL) {
+		printf("ERROR MAPPING METRICS SEGMENT %s\n", name.c_str());
+		if (handle != NULL) {
+			CloseHandle(handle);
+		}
+		return false;
+	}
+	mapping = handle;
+#else
+	// a segment left behind by a process that died with the same id is cleared
+	int fd = create ? shm_open(name.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0644) : shm_open(name.c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		printf("ERROR OPENING METRICS SEGMENT %s\n", name.c_str());
+		return false;
+	}
+	struct stat st;
+	bool sized = create ? ftruncate(fd, sizeof(Layout)) == 0 : (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(Layout));
+	void* view = sized ? mmap(NULL, sizeof(Layout), create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+	close(fd);
+	if (view == MAP_FAILED) {
+		printf("ERROR MAPPING METRICS SEGMENT %s\n", name.c_str());
+		if (create) {
+			shm_unlink(name.c_str());
+		}
+		return false;
+	}
+#endif
+	layout = (Layout*)view;
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Answer every connection to a Unix socket with the counters,
+ *               from a thread of its own
+ *
+ * [PARAM] path - socket to create (a stale socket there is replaced)
+ * [RETURN] false if the socket could not be made
+*/
+bool MetricsExport::serve(const char* path)
+{
+#ifdef _WIN32
+	printf("--metrics-socket needs a host with Unix sockets, read the segment with --metrics-read instead\n");
+	return false;
+#else
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		printf("METRICS SOCKET PATH %s IS TOO LONG\n", path);
+		return false;
+	}
+	strcpy(address.sun_path, path);
+
+	// only ever remove a socket, never a file that happens to have the name
+	struct stat st;
+	if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+		unlink(path);
+	}
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0 || bind(fd, (sockaddr*)&address, sizeof(address)) != 0 || listen(fd, 8) != 0) {
+		printf("ERROR OPENING METRICS SOCKET %s\n", path);
+		if (fd >= 0) {
+			close(fd);
+		}
+		return false;
+	}
+	listen_fd = fd;
+	socket_path = path;
+	stopping = false;
+	server = std::thread(&MetricsExport::serveLoop, this);
+	printf("metrics: serving %s\n", path);
+	return true;
+#endif
+}
+
+/**
+ * [DESCRIPTION] Accept connections until the destructor wakes the thread up,
+ *               whatever was asked for the answer is the whole text
+ *
+*/
+void MetricsExport::serveLoop()
+{
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+	const int send_flags = MSG_NOSIGNAL;    // a client that hung up must not kill the process
+#else
+	const int send_flags = 0;
+#endif
+	while (true) {
+		int client = accept(listen_fd, NULL, NULL);
+		if (stopping.load()) {
+			if (client >= 0) {
+				close(client);
+			}
+			break;
+		}
+		if (client < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			break;
+		}
+
+		// read the request (if the client sends one) so an HTTP client is happy
+		timeval timeout = { 0, 200000 };
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		char request[1024];
+		recv(client, request, sizeof(request), 0);
+
+		Snapshot snapshot;
+		std::string response;
+		if (read(snapshot)) {
+			std::string body = formatPrometheus(snapshot);
+			response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " +
+				std::to_string(body.size()) + "\r\n\r\n" + body;
+		}
+		else {
+			response = "HTTP/1.0 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n";
+		}
+		size_t sent = 0;
+		while (sent < response.size()) {
+			ssize_t count = send(client, response.data() + sent, response.size() - sent, send_flags);
+			if (count <= 0) {
+				break;
+			}
+			sent += (size_t)count;
+		}
+		close(client);
+	}
+#endif
+}
+
+/**
+ * [DESCRIPTION] Construct a new MetricsExport object (nothing is mapped yet)
+ *
+*/
+MetricsExport::MetricsExport()
+{
+	layout = NULL;
+	owner = false;
+	frames = 0;
+	frame_micro_total = 0;
+	memset(frame_buckets, 0, sizeof(frame_buckets));
+#ifdef _WIN32
+	mapping = NULL;
+#endif
+	stopping = false;
+	listen_fd = -1;
+}
+
+/**
+ * [DESCRIPTION] Stop serving and remove the segment if this process made it
+ *
+*/
+MetricsExport::~MetricsExport()
+{
+#ifndef _WIN32
+	if (listen_fd >= 0) {
+		// wake the accept up (Linux returns from it on shutdown, other hosts
+		// need a connection of our own)
+		stopping = true;
+		shutdown(listen_fd, SHUT_RDWR);
+		sockaddr_un address = {};
+		address.sun_family = AF_UNIX;
+		strcpy(address.sun_path, socket_path.c_str());
+		int wake = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (wake >= 0) {
+			connect(wake, (sockaddr*)&address, sizeof(address));
+			close(wake);
+		}
+		server.join();
+		close(listen_fd);
+		unlink(socket_path.c_str());
+	}
+#endif
+	if (layout == NULL) {
+		return;
+	}
+#ifdef _WIN32
+	UnmapViewOfFile(layout);
+	CloseHandle(mapping);
+#else
+	munmap(layout, sizeof(Layout));
+	if (owner) {
+		shm_unlink(getSegmentName(currentProcessId()).c_str());
+	}
+#endif
+}
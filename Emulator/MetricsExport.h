@@ -0,0 +1,97 @@
+/**
+ * [FILE] MetricsExport.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the counters an emulator process publishes in a named
+ *               shared memory segment, and the readers of them (another process
+ *               or a Unix socket serving Prometheus text)
+ * [DATE] 2021-06-18
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * [DESCRIPTION] Class publishing the emulation's counters for other processes
+ *      - The segment is named after the process id ("/i8080_metrics_<pid>",
+ *        "Local\i8080_metrics_<pid>" on Windows) and holds a single Layout,
+ *        readers check its magic, version and size before trusting it
+ *      - The emulation thread writes once a frame under a sequence counter
+ *        (odd while writing), readers copy the counters and retry if the
+ *        sequence moved, so the writer never waits on a reader
+ *      - serve() answers every connection to a Unix socket with the counters
+ *        as an HTTP response in Prometheus text format, from its own thread
+*/
+class MetricsExport {
+public:
+    static const uint32_t   VERSION = 1;            // bump whenever Layout changes
+    static const int        NUM_BUCKETS = 8;        // frame time histogram: <1 ms, doubling, the last one is open
+
+    enum Counter {
+        COUNTER_CYCLES,             // emulated clock cycles run
+        COUNTER_INSTRUCTIONS,       // opcodes run on either engine
+        COUNTER_FRAMES,             // emulated frames published
+        COUNTER_INTERRUPTS,         // interrupts the cpu took
+        COUNTER_AUDIO_UNDERRUNS,    // times playback caught up with the emulation
+        COUNTER_FRAME_MICRO,        // host time spent running the frames
+        NUM_COUNTERS
+    };
+
+    // the shared segment, fixed width fields only
+    struct Layout {
+        char                    magic[8];           // "I8080MET"
+        uint32_t                version;            // VERSION
+        uint32_t                size;               // sizeof(Layout)
+        uint64_t                pid;                // process publishing it
+        std::atomic<uint64_t>   sequence;           // odd while the counters are being written
+        std::atomic<uint64_t>   counters[NUM_COUNTERS];
+        std::atomic<uint64_t>   frame_buckets[NUM_BUCKETS]; // frames per host time bucket (not cumulative)
+    };
+
+    // a consistent copy of the counters
+    struct Snapshot {
+        uint64_t    pid;
+        uint64_t    counters[NUM_COUNTERS];
+        uint64_t    frame_buckets[NUM_BUCKETS];
+    };
+
+    // the totals the emulation hands over once a frame
+    struct Totals {
+        uint64_t    cycles;
+        uint64_t    instructions;
+        uint64_t    interrupts;
+        uint64_t    audio_underruns;
+    };
+
+    bool        create();                           // make this process's segment (false if it failed)
+    bool        attach(uint64_t pid);               // map another process's segment read only
+    void        publishFrame(const Totals& totals, uint64_t frame_micro);  // emulation thread, once a frame
+    bool        read(Snapshot& snapshot) const;     // false if no consistent copy could be made
+    bool        serve(const char* socket_path);     // start answering scrapes on a Unix socket
+    static std::string formatPrometheus(const Snapshot& snapshot);
+    static std::string getSegmentName(uint64_t pid);
+    static int  printProcess(uint64_t pid);         // the --metrics-read tool, returns the exit code
+    MetricsExport();
+    ~MetricsExport();
+
+private:
+    Layout*             layout;             // NULL until created or attached
+    bool                owner;              // created it (removed again by the destructor)
+    uint64_t            frames;             // emulation thread's copies, only it writes the segment
+    uint64_t            frame_micro_total;
+    uint64_t            frame_buckets[NUM_BUCKETS];
+#ifdef _WIN32
+    void*               mapping;            // file mapping handle
+#endif
+
+    // SOCKET =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    std::thread         server;
+    std::atomic<bool>   stopping;
+    int                 listen_fd;          // -1 if not serving
+    std::string         socket_path;
+    void                serveLoop();
+
+    bool                mapSegment(uint64_t pid, bool create);
+};
@@ -0,0 +1,256 @@
+/**
+ * [FILE] PerfOverlay.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the on screen performance panel
+ * [DATE] 2021-06-17
+*/
+
+#include "PerfOverlay.h"
+#include "HostTimer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+/**
+ * [DESCRIPTION] Take the emulation's running totals after a frame was run
+ *
+ * [PARAM] cycles - clock cycles run since power on
+ * [PARAM] opcodes - opcodes run since power on
+ * [PARAM] p_busy_micro - host time the frame took to run
+*/
+void PerfOverlay::frameRun(uint64_t cycles, uint64_t opcodes, uint64_t p_busy_micro)
+{
+	uint64_t now = HostTimer::nowMicro();
+	if (window_micro == 0) {
+		window_micro = now;
+		window_cycles = cycles;
+		window_opcodes = opcodes;
+	}
+	last_cycles = cycles;
+	last_opcodes = opcodes;
+	busy_micro += p_busy_micro;
+	frames_since_present++;
+
+	if (now - window_micro >= REFRESH_MICRO) {
+		refresh(now);
+	}
+}
+
+/**
+ * [DESCRIPTION] Count a present, called right before SDL_RenderPresent
+ *
+ * [PARAM] p_busy_micro - host time drawing the frame took
+*/
+void PerfOverlay::framePresented(uint64_t p_busy_micro)
+{
+	uint64_t now = HostTimer::nowMicro();
+	busy_micro += p_busy_micro;
+	if (frames_since_present > 1) {
+		dropped += frames_since_present - 1;
+	}
+	frames_since_present = 0;
+	if (last_present_micro != 0) {
+		uint64_t interval = now - last_present_micro;
+		frame_micro.push_back((uint32_t)interval);
+		if (interval > FRAME_MICRO * 3 / 2) {
+			duplicated++;
+		}
+	}
+	last_present_micro = now;
+}
+
+/**
+ * [DESCRIPTION] Work the text out from the window that just ended and start the
+ *               next one
+ *
+ * [PARAM] now_micro
+*/
+void PerfOverlay::refresh(uint64_t now_micro)
+{
+	double seconds = (now_micro - window_micro) / 1000000.0;
+	double mhz = (last_cycles - window_cycles) / seconds / 1000000.0;
+	double target_mhz = cycles_per_second / 1000000.0;
+	double ops = (last_opcodes - window_opcodes) / seconds;
+
+	double min_ms = 0;
+	double avg_ms = 0;
+	double p99_ms = 0;
+	if (!frame_micro.empty()) {
+		std::sort(frame_micro.begin(), frame_micro.end());
+		uint64_t total = 0;
+		for (uint32_t micro : frame_micro) {
+			total += micro;
+		}
+		min_ms = frame_micro.front() / 1000.0;
+		avg_ms = total / (double)frame_micro.size() / 1000.0;
+		p99_ms = frame_micro[(frame_micro.size() - 1) * 99 / 100] / 1000.0;
+	}
+
+	snprintf(text[0], sizeof(text[0]), "CLOCK   %.3f/%.3f MHZ %6.1f%%", mhz, target_mhz, mhz * 100 / target_mhz);
+	snprintf(text[1], sizeof(text[1]), "OPS/S   %.2f M", ops / 1000000.0);
+	snprintf(text[2], sizeof(text[2]), "FRAME   %.1f MIN %.1f AVG %.1f P99 MS", min_ms, avg_ms, p99_ms);
+	snprintf(text[3], sizeof(text[3]), "DROPPED %llu DUPLICATED %llu", (unsigned long long)dropped,
+		(unsigned long long)duplicated);
+	snprintf(text[4], sizeof(text[4]), "THREAD  %.1f%% BUSY", busy_micro / seconds / 10000.0);
+	dirty = true;
+
+	window_micro = now_micro;
+	window_cycles = last_cycles;
+	window_opcodes = last_opcodes;
+	busy_micro = 0;
+	frame_micro.clear();
+}
+
+/**
+ * [DESCRIPTION] Copy the panel to the window at the passed position, the text is
+ *               only drawn again after a refresh
+ *
+ * [PARAM] renderer
+ * [PARAM] x - left edge in window pixels
+ * [PARAM] y - top edge in window pixels
+ * [PARAM] scale - window pixels per panel pixel
+*/
+void PerfOverlay::draw(SDL_Renderer* renderer, int x, int y, int scale)
+{
+	if (texture == NULL) {
+		texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, WIDTH, HEIGHT);
+		if (texture == NULL) {
+			return;
+		}
+		SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+		dirty = true;
+	}
+	if (dirty) {
+		rasterize();
+		SDL_UpdateTexture(texture, NULL, pixels.data(), WIDTH * (int)sizeof(uint32_t));
+		dirty = false;
+	}
+	SDL_Rect target = { x, y, WIDTH * scale, HEIGHT * scale };
+	SDL_RenderCopy(renderer, texture, NULL, &target);
+}
+
+/**
+ * [DESCRIPTION] Draw the text in green on a see through black panel
+ *
+*/
+void PerfOverlay::rasterize()
+{
+	std::fill(pixels.begin(), pixels.end(), 0xC0000000);
+	for (int line = 0; line < LINES; line++) {
+		for (int column = 0; column < COLUMNS && text[line][column] != '\0'; column++) {
+			const uint8_t* glyph = getGlyph(text[line][column]);
+			if (glyph == NULL) {
+				continue;
+			}
+			uint32_t* origin = &pixels[(BORDER + line * GLYPH_HEIGHT) * WIDTH + BORDER + column * GLYPH_WIDTH];
+			for (int row = 0; row < 7; row++) {
+				for (int bit = 0; bit < 5; bit++) {
+					if (glyph[row] & (0x10 >> bit)) {
+						origin[row * WIDTH + bit] = 0xFF30FF30;
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Return the 5x7 glyph of a character, lower case letters are
+ *               drawn as upper case
+ *
+ * [PARAM] c
+ * [RETURN] const uint8_t* (7 rows, bit 4 is the left pixel, NULL for a blank)
+*/
+const uint8_t* PerfOverlay::getGlyph(char c)
+{
+	static const char CHARS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ.%/:-+()";
+	static const uint8_t GLYPHS[][7] = {
+		{ 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },   // 0
+		{ 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },   // 1
+		{ 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },   // 2
+		{ 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },   // 3
+		{ 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },   // 4
+		{ 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },   // 5
+		{ 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },   // 6
+		{ 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },   // 7
+		{ 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },   // 8
+		{ 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },   // 9
+		{ 0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11 },   // A
+		{ 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E },   // B
+		{ 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E },   // C
+		{ 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C },   // D
+		{ 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F },   // E
+		{ 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 },   // F
+		{ 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F },   // G
+		{ 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },   // H
+		{ 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E },   // I
+		{ 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C },   // J
+		{ 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 },   // K
+		{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F },   // L
+		{ 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 },   // M
+		{ 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 },   // N
+		{ 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },   // O
+		{ 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 },   // P
+		{ 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D },   // Q
+		{ 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 },   // R
+		{ 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E },   // S
+		{ 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },   // T
+		{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },   // U
+		{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 },   // V
+		{ 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A },   // W
+		{ 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 },   // X
+		{ 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04 },   // Y
+		{ 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F },   // Z
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C },   // .
+		{ 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 },   // %
+		{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 },   // /
+		{ 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 },   // :
+		{ 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 },   // -
+		{ 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 },   // +
+		{ 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 },   // (
+		{ 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 },   // )
+	};
+	static_assert(sizeof(GLYPHS) / sizeof(GLYPHS[0]) == sizeof(CHARS) - 1, "a glyph for every character");
+
+	if (c >= 'a' && c <= 'z') {
+		c = (char)(c - 'a' + 'A');
+	}
+	const char* found = c != '\0' ? strchr(CHARS, c) : NULL;
+	return found != NULL ? GLYPHS[found - CHARS] : NULL;
+}
+
+/**
+ * [DESCRIPTION] Construct a new PerfOverlay object
+ *
+ * [PARAM] p_cycles_per_second - clock rate the emulation is meant to run at
+*/
+PerfOverlay::PerfOverlay(uint64_t p_cycles_per_second)
+{
+	texture = NULL;
+	pixels.assign(WIDTH * HEIGHT, 0);
+	memset(text, 0, sizeof(text));
+	snprintf(text[0], sizeof(text[0]), "MEASURING...");
+	dirty = true;
+	cycles_per_second = p_cycles_per_second;
+	window_micro = 0;
+	window_cycles = 0;
+	window_opcodes = 0;
+	last_cycles = 0;
+	last_opcodes = 0;
+	busy_micro = 0;
+	last_present_micro = 0;
+	frames_since_present = 0;
+	dropped = 0;
+	duplicated = 0;
+}
+
+/**
+ * [DESCRIPTION] Destroy the PerfOverlay object (before the renderer goes)
+ *
+*/
+PerfOverlay::~PerfOverlay()
+{
+	if (texture != NULL) {
+		SDL_DestroyTexture(texture);
+	}
+}
@@ -0,0 +1,67 @@
+/**
+ * [FILE] PerfOverlay.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains an on screen panel showing whether the host keeps up with
+ *               the emulation (clock speed, opcodes, frame times, dropped frames)
+ * [DATE] 2021-06-17
+*/
+
+#pragma once
+#include <SDL.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class drawing a small performance panel over the window
+ *      - The emulation hands over its running totals once per frame (clock
+ *        cycles, opcodes run, time it was busy), nothing is counted per opcode
+ *        here
+ *      - The text is worked out and drawn into the texture every REFRESH_MICRO
+ *        with a built in 5x7 font, every other frame only copies the texture
+ *      - A frame that ran but was never presented is dropped, a present that
+ *        came more than 1.5 frame periods after the last one left the display
+ *        showing the same picture twice (duplicated)
+*/
+class PerfOverlay {
+public:
+    static const int        LINES = 5;
+    static const int        COLUMNS = 36;
+    static const uint64_t   REFRESH_MICRO = 500000;         // text is updated twice a second
+    static const uint64_t   FRAME_MICRO = 16667;            // host time of a 60 Hz frame
+
+    void    frameRun(uint64_t cycles, uint64_t opcodes, uint64_t busy_micro);  // after each emulated frame
+    void    framePresented(uint64_t busy_micro);            // before SDL_RenderPresent, busy = drawing time
+    void    draw(SDL_Renderer* renderer, int x, int y, int scale);  // copy the panel to the window
+    PerfOverlay(uint64_t p_cycles_per_second);
+    ~PerfOverlay();
+
+private:
+    static const int        GLYPH_WIDTH = 6;                // 5 pixels and a gap
+    static const int        GLYPH_HEIGHT = 9;               // 7 pixels and a gap
+    static const int        BORDER = 2;
+    static const int        WIDTH = COLUMNS * GLYPH_WIDTH + 2 * BORDER;
+    static const int        HEIGHT = LINES * GLYPH_HEIGHT + 2 * BORDER;
+
+    SDL_Texture*            texture;                // NULL until the first draw
+    std::vector<uint32_t>   pixels;                 // WIDTH x HEIGHT ARGB
+    char                    text[LINES][COLUMNS + 1];
+    bool                    dirty;                  // text changed since it was drawn
+    uint64_t                cycles_per_second;      // target clock rate
+
+    // WINDOW =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    uint64_t                window_micro;           // host time the window started (0 before the first frame)
+    uint64_t                window_cycles;          // totals when it started
+    uint64_t                window_opcodes;
+    uint64_t                last_cycles;            // totals of the last frame
+    uint64_t                last_opcodes;
+    uint64_t                busy_micro;             // emulation thread busy in the window
+    std::vector<uint32_t>   frame_micro;            // times between presents in the window
+    uint64_t                last_present_micro;
+    int                     frames_since_present;   // emulated frames since the last present
+    uint64_t                dropped;                // totals since the game started
+    uint64_t                duplicated;
+
+    void    refresh(uint64_t now_micro);            // work the text out and start a new window
+    void    rasterize();                            // draw the text into pixels
+    static const uint8_t*   getGlyph(char c);       // 7 rows of 5 bits (NULL = blank)
+};
@@ -0,0 +1,328 @@
+/**
+ * [FILE] RomSet.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the memory mapped ROM set
+ * [DATE] 2021-06-10
+*/
+
+#include "RomSet.h"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * [DESCRIPTION] Open the ROM set described by the passed manifest, sets that are
+ *               already open in this process are shared instead of mapped again
+ *
+ * [PARAM] manifest_path
+ * [RETURN] std::shared_ptr<const RomSet> (NULL if the manifest or a file was bad)
+*/
+std::shared_ptr<const RomSet> RomSet::open(const std::string& manifest_path)
+{
+	static std::mutex cache_lock;
+	static std::map<std::string, std::weak_ptr<const RomSet>> cache;
+
+	std::lock_guard<std::mutex> guard(cache_lock);
+	std::shared_ptr<const RomSet> rom_set = cache[manifest_path].lock();
+	if (rom_set) {
+		return rom_set;
+	}
+
+	std::shared_ptr<RomSet> loaded(new RomSet);
+	if (!loaded->load(manifest_path)) {
+		return NULL;
+	}
+	cache[manifest_path] = loaded;
+	return loaded;
+}
+
+/**
+ * [DESCRIPTION] Return the ROM files in manifest order
+ *
+ * [RETURN] const std::vector<RomFile>&
+*/
+const std::vector<RomSet::RomFile>& RomSet::getFiles() const
+{
+	return files;
+}
+
+/**
+ * [DESCRIPTION] Read the manifest, map every file it lists and check each one
+ *               against its size, CRC32 and SHA1
+ *
+ * [PARAM] manifest_path
+ * [RETURN] false if anything did not match (the reason is printed)
+*/
+bool RomSet::load(const std::string& manifest_path)
+{
+#pragma warning(disable:4996)
+	FILE* f = fopen(manifest_path.c_str(), "r");
+	if (f == NULL) {
+		printf("ERROR OPENING ROM MANIFEST %s\n", manifest_path.c_str());
+		return false;
+	}
+
+	// file names are relative to the manifest
+	std::string dir;
+	size_t slash = manifest_path.find_last_of("/\\");
+	if (slash != std::string::npos) {
+		dir = manifest_path.substr(0, slash + 1);
+	}
+
+	char line[512];
+	int line_num = 0;
+	bool ok = true;
+	while (ok && fgets(line, sizeof(line), f) != NULL) {
+		line_num++;
+		char* comment = strchr(line, '#');
+		if (comment != NULL) {
+			*comment = '\0';
+		}
+
+		char name[256];
+		unsigned int address, size, crc;
+		char sha[64];
+		int fields = sscanf(line, "%255s %x %x %x %63s", name, &address, &size, &crc, sha);
+		if (fields <= 0) {
+			continue;
+		}
+		if (fields != 5 || strlen(sha) != 40 || size == 0 || address + size > 0x10000) {
+			printf("ERROR IN ROM MANIFEST %s LINE %d\n", manifest_path.c_str(), line_num);
+			ok = false;
+			break;
+		}
+
+		Mapping mapping = {};
+		std::string path = dir + name;
+		if (!mapFile(path, mapping)) {
+			ok = false;
+			break;
+		}
+		mappings.push_back(mapping);
+
+		RomFile file;
+		file.name = name;
+		file.address = (uint16_t)address;
+		file.size = size;
+		file.crc32 = crc;
+		file.sha1 = sha;
+		file.data = (const uint8_t*)mapping.view;
+		for (char& c : file.sha1) {
+			c = (char)tolower((unsigned char)c);
+		}
+
+		// VERIFY =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+		if (mapping.size != size) {
+			printf("ROM %s IS %zu BYTES, EXPECTED %u\n", path.c_str(), mapping.size, size);
+			ok = false;
+		}
+		else if (crc32(file.data, size) != file.crc32) {
+			printf("ROM %s CRC32 %08x, EXPECTED %08x\n", path.c_str(), crc32(file.data, size), file.crc32);
+			ok = false;
+		}
+		else if (sha1(file.data, size) != file.sha1) {
+			printf("ROM %s SHA1 %s, EXPECTED %s\n", path.c_str(), sha1(file.data, size).c_str(), file.sha1.c_str());
+			ok = false;
+		}
+		files.push_back(file);
+	}
+	fclose(f);
+
+	if (ok && files.empty()) {
+		printf("ROM MANIFEST %s LISTS NO FILES\n", manifest_path.c_str());
+		ok = false;
+	}
+	return ok;
+}
+
+/**
+ * [DESCRIPTION] Map a whole file read only
+ *
+ * [PARAM] path
+ * [PARAM] mapping - filled in on success
+ * [RETURN] false if the file could not be opened or mapped
+*/
+bool RomSet::mapFile(const std::string& path, Mapping& mapping)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		printf("ERROR OPENING %s\n", path.c_str());
+		return false;
+	}
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+		printf("ERROR READING %s\n", path.c_str());
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE file_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	void* view = file_mapping != NULL ? MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+	if (view == NULL) {
+		printf("ERROR MAPPING %s\n", path.c_str());
+		if (file_mapping != NULL) {
+			CloseHandle(file_mapping);
+		}
+		CloseHandle(file);
+		return false;
+	}
+	mapping.view = view;
+	mapping.size = (size_t)file_size.QuadPart;
+	mapping.file = file;
+	mapping.mapping = file_mapping;
+#else
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		printf("ERROR OPENING %s\n", path.c_str());
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		printf("ERROR READING %s\n", path.c_str());
+		close(fd);
+		return false;
+	}
+	// the mapping keeps the file alive once the descriptor is closed
+	void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED) {
+		printf("ERROR MAPPING %s\n", path.c_str());
+		return false;
+	}
+	mapping.view = view;
+	mapping.size = (size_t)st.st_size;
+#endif
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Release a mapping made by mapFile
+ *
+ * [PARAM] mapping
+*/
+void RomSet::unmapFile(Mapping& mapping)
+{
+#ifdef _WIN32
+	UnmapViewOfFile(mapping.view);
+	CloseHandle(mapping.mapping);
+	CloseHandle(mapping.file);
+#else
+	munmap(mapping.view, mapping.size);
+#endif
+}
+
+/**
+ * [DESCRIPTION] Compute the CRC32 (IEEE 802.3, the one zip and MAME use)
+ *
+ * [PARAM] data
+ * [PARAM] size
+ * [RETURN] uint32_t
+*/
+uint32_t RomSet::crc32(const uint8_t* data, size_t size)
+{
+	uint32_t crc = 0xFFFFFFFF;
+	for (size_t i = 0; i < size; i++) {
+		crc ^= data[i];
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+/**
+ * [DESCRIPTION] Compute the SHA1 digest
+ *
+ * [PARAM] data
+ * [PARAM] size
+ * [RETURN] std::string (40 lower case hex digits)
+*/
+std::string RomSet::sha1(const uint8_t* data, size_t size)
+{
+	uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+	// the message is padded with 0x80, zeros and the bit length to whole 64 byte blocks
+	std::vector<uint8_t> message(data, data + size);
+	message.push_back(0x80);
+	while (message.size() % 64 != 56) {
+		message.push_back(0x00);
+	}
+	uint64_t bits = (uint64_t)size * 8;
+	for (int i = 7; i >= 0; i--) {
+		message.push_back((uint8_t)(bits >> (i * 8)));
+	}
+
+	for (size_t block = 0; block < message.size(); block += 64) {
+		uint32_t w[80];
+		for (int i = 0; i < 16; i++) {
+			const uint8_t* p = &message[block + i * 4];
+			w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+		}
+		for (int i = 16; i < 80; i++) {
+			uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+			w[i] = (x << 1) | (x >> 31);
+		}
+
+		uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+		for (int i = 0; i < 80; i++) {
+			uint32_t f, k;
+			if (i < 20) {
+				f = (b & c) | (~b & d);
+				k = 0x5A827999;
+			}
+			else if (i < 40) {
+				f = b ^ c ^ d;
+				k = 0x6ED9EBA1;
+			}
+			else if (i < 60) {
+				f = (b & c) | (b & d) | (c & d);
+				k = 0x8F1BBCDC;
+			}
+			else {
+				f = b ^ c ^ d;
+				k = 0xCA62C1D6;
+			}
+			uint32_t temp = ((a << 5) | (a >> 27)) + f + e + k + w[i];
+			e = d;
+			d = c;
+			c = (b << 30) | (b >> 2);
+			b = a;
+			a = temp;
+		}
+		h[0] += a;
+		h[1] += b;
+		h[2] += c;
+		h[3] += d;
+		h[4] += e;
+	}
+
+	char hex[41];
+	for (int i = 0; i < 5; i++) {
+		snprintf(hex + i * 8, 9, "%08x", h[i]);
+	}
+	return std::string(hex, 40);
+}
+
+/**
+ * [DESCRIPTION] Destroy the RomSet object, unmapping every file
+ *
+*/
+RomSet::~RomSet()
+{
+	for (Mapping& mapping : mappings) {
+		unmapFile(mapping);
+	}
+}
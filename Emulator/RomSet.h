@@ -0,0 +1,63 @@
+/**
+ * [FILE] RomSet.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a ROM set loaded from a manifest, the ROM files are mapped
+ *               read only and verified against the sizes and checksums the manifest
+ *               lists
+ * [DATE] 2021-06-10
+*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class representing a verified, memory mapped set of ROM files
+ *      - The manifest is a text file with one ROM per line:
+ *            <file> <load address> <size> <crc32> <sha1>
+ *        (file paths are relative to the manifest, # starts a comment)
+ *      - Files are mapped read only (mmap / MapViewOfFile), so every cpu that
+ *        maps the set reads the same physical pages, across processes too
+ *        through the page cache
+ *      - open() caches the sets by manifest path, every board in a process
+ *        shares one mapping for as long as any of them holds it
+*/
+class RomSet {
+public:
+    // a single ROM file of the set
+    struct RomFile {
+        std::string     name;           // file name from the manifest
+        uint16_t        address;        // load address in the cpu memory
+        uint32_t        size;           // size in bytes
+        uint32_t        crc32;          // expected CRC32
+        std::string     sha1;           // expected SHA1 (40 lower case hex digits)
+        const uint8_t*  data;           // read only mapping of the file
+    };
+
+    static std::shared_ptr<const RomSet> open(const std::string& manifest_path); // NULL on any error
+    const std::vector<RomFile>& getFiles() const;
+    static uint32_t     crc32(const uint8_t* data, size_t size);
+    static std::string  sha1(const uint8_t* data, size_t size);
+    ~RomSet();
+
+private:
+    // a read only file mapping
+    struct Mapping {
+        void*           view;           // start of the mapped file
+        size_t          size;           // bytes mapped
+#ifdef _WIN32
+        void*           file;           // file handle
+        void*           mapping;        // file mapping handle
+#endif
+    };
+
+    std::vector<RomFile>    files;      // every ROM in manifest order
+    std::vector<Mapping>    mappings;   // one per file (unmapped by the destructor)
+
+    RomSet() = default;
+    bool            load(const std::string& manifest_path);
+    bool            mapFile(const std::string& path, Mapping& mapping);
+    static void     unmapFile(Mapping& mapping);
+};
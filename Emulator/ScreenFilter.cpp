@@ -0,0 +1,247 @@
+/**
+ * [FILE] ScreenFilter.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the screen filter
+ * [DATE] 2021-06-12
+*/
+
+#include "ScreenFilter.h"
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SCREEN_FILTER_SSE2
+#endif
+
+// ROW KERNELS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+/**
+ * [DESCRIPTION] Multiply a row by its tint, the pixels are either black or white
+ *               so an AND is enough
+ *
+ * [PARAM] dst
+ * [PARAM] src
+ * [PARAM] tint
+ * [PARAM] count
+*/
+static void tintRow(uint32_t* dst, const uint32_t* src, const uint32_t* tint, int count)
+{
+	int i = 0;
+#ifdef SCREEN_FILTER_SSE2
+	for (; i + 4 <= count; i += 4) {
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i colors = _mm_loadu_si128((const __m128i*)(tint + i));
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_and_si128(pixels, colors));
+	}
+#endif
+	for (; i < count; i++) {
+		dst[i] = src[i] & tint[i];
+	}
+}
+
+/**
+ * [DESCRIPTION] Write every pixel of a row scale times
+ *
+ * [PARAM] dst - count * scale pixels
+ * [PARAM] src
+ * [PARAM] count
+ * [PARAM] scale - 1, 2 or 3
+*/
+static void widenRow(uint32_t* dst, const uint32_t* src, int count, int scale)
+{
+	int i = 0;
+#ifdef SCREEN_FILTER_SSE2
+	if (scale == 2) {
+		// abcd -> aabb ccdd
+		for (; i + 4 <= count; i += 4) {
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(src + i));
+			_mm_storeu_si128((__m128i*)(dst + i * 2), _mm_unpacklo_epi32(pixels, pixels));
+			_mm_storeu_si128((__m128i*)(dst + i * 2 + 4), _mm_unpackhi_epi32(pixels, pixels));
+		}
+	}
+	else if (scale == 3) {
+		// abcd -> aaab bbcc cddd
+		for (; i + 4 <= count; i += 4) {
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(src + i));
+			_mm_storeu_si128((__m128i*)(dst + i * 3), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 0, 0)));
+			_mm_storeu_si128((__m128i*)(dst + i * 3 + 4), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 1, 1)));
+			_mm_storeu_si128((__m128i*)(dst + i * 3 + 8), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 2)));
+		}
+	}
+#endif
+	for (; i < count; i++) {
+		for (int s = 0; s < scale; s++) {
+			dst[i * scale + s] = src[i];
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Copy a row at half brightness (the alpha stays opaque)
+ *
+ * [PARAM] dst
+ * [PARAM] src
+ * [PARAM] count
+*/
+static void darkenRow(uint32_t* dst, const uint32_t* src, int count)
+{
+	int i = 0;
+#ifdef SCREEN_FILTER_SSE2
+	const __m128i half_mask = _mm_set1_epi32(0x007F7F7F);
+	const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+	for (; i + 4 <= count; i += 4) {
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(src + i));
+		pixels = _mm_and_si128(_mm_srli_epi32(pixels, 1), half_mask);
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(pixels, alpha));
+	}
+#endif
+	for (; i < count; i++) {
+		dst[i] = ((src[i] >> 1) & 0x007F7F7F) | 0xFF000000;
+	}
+}
+
+// SCREEN FILTER =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Set the integer scale (values outside 1-3 are clamped)
+ *
+ * [PARAM] p_scale
+*/
+void ScreenFilter::setScale(int p_scale)
+{
+	scale = p_scale < 1 ? 1 : (p_scale > MAX_SCALE ? MAX_SCALE : p_scale);
+}
+
+/**
+ * [DESCRIPTION] Turn the scanlines on/off, they are skipped at a scale of 1
+ *               (there is no row left to darken)
+ *
+ * [PARAM] p_scanlines
+*/
+void ScreenFilter::setScanlines(bool p_scanlines)
+{
+	scanlines = p_scanlines;
+}
+
+/**
+ * [DESCRIPTION] Add a colored band over a rectangle of the source screen, later
+ *               bands win where they overlap
+ *
+ * [PARAM] top
+ * [PARAM] bottom - exclusive
+ * [PARAM] left
+ * [PARAM] right - exclusive
+ * [PARAM] color - ARGB
+*/
+void ScreenFilter::addBand(int top, int bottom, int left, int right, uint32_t color)
+{
+	bands.push_back({ top, bottom, left, right, color | 0xFF000000 });
+}
+
+/**
+ * [DESCRIPTION] Build a tint row for every different row of bands, rows no band
+ *               touches are left untinted
+ *
+ * [PARAM] p_width
+ * [PARAM] p_height
+*/
+void ScreenFilter::prepare(int p_width, int p_height)
+{
+	width = p_width;
+	height = p_height;
+	tints.clear();
+	row_tint.assign(height, -1);
+	scratch.resize(width);
+
+	std::vector<uint32_t> tint(width);
+	for (int y = 0; y < height; y++) {
+		bool tinted = false;
+		for (int x = 0; x < width; x++) {
+			tint[x] = 0xFFFFFFFF;
+		}
+		for (const Band& band : bands) {
+			if (y < band.top || y >= band.bottom) {
+				continue;
+			}
+			for (int x = band.left; x < band.right && x < width; x++) {
+				tint[x] = band.color;
+				tinted = true;
+			}
+		}
+		if (!tinted) {
+			continue;
+		}
+
+		// the bands are few, so most rows share a tint
+		for (size_t t = 0; t < tints.size() && row_tint[y] < 0; t++) {
+			if (tints[t] == tint) {
+				row_tint[y] = (int)t;
+			}
+		}
+		if (row_tint[y] < 0) {
+			row_tint[y] = (int)tints.size();
+			tints.push_back(tint);
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Return the integer scale
+ *
+ * [RETURN] int
+*/
+int ScreenFilter::getScale() const
+{
+	return scale;
+}
+
+/**
+ * [DESCRIPTION] Check if the filter changes anything
+ *
+ * [RETURN] false if the rows would be copied through unchanged
+*/
+bool ScreenFilter::isActive() const
+{
+	return scale > 1 || !bands.empty();
+}
+
+/**
+ * [DESCRIPTION] Tint, widen and repeat one source row into the output
+ *
+ * [PARAM] src - width ARGB pixels
+ * [PARAM] y - source row (picks the tint)
+ * [PARAM] dst - first of the scale output rows
+ * [PARAM] pitch - bytes per output row
+*/
+void ScreenFilter::filterRow(const uint32_t* src, int y, uint8_t* dst, int pitch)
+{
+	if (row_tint[y] >= 0) {
+		tintRow(scratch.data(), src, tints[row_tint[y]].data(), width);
+		src = scratch.data();
+	}
+
+	uint32_t* first = (uint32_t*)dst;
+	widenRow(first, src, width, scale);
+	int out_width = width * scale;
+	for (int s = 1; s < scale; s++) {
+		uint32_t* row = (uint32_t*)(dst + s * pitch);
+		if (scanlines && s == scale - 1) {
+			darkenRow(row, first, out_width);
+		}
+		else {
+			memcpy(row, first, out_width * sizeof(uint32_t));
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Construct a new ScreenFilter object (1x, no scanlines, no bands)
+ *
+*/
+ScreenFilter::ScreenFilter()
+{
+	width = 0;
+	height = 0;
+	scale = 1;
+	scanlines = false;
+}
@@ -0,0 +1,51 @@
+/**
+ * [FILE] ScreenFilter.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a software post processing stage for emulated screens:
+ *               integer scaling, scanlines and colored overlay bands
+ * [DATE] 2021-06-12
+*/
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class which filters a 32 bit ARGB screen a row at a time on its
+ *               way into the texture, for hosts without a shader path
+ *      - Each source row is tinted by the overlay, widened scale times and
+ *        written scale times, the last copy darkened when scanlines are on
+ *      - Every stage is a straight pass over a row (SSE2 where the host has
+ *        it), nothing is looked up per pixel
+*/
+class ScreenFilter {
+private:
+    // a rectangle of source pixels seen through a colored gel
+    struct Band {
+        int         top;
+        int         bottom;     // exclusive
+        int         left;
+        int         right;      // exclusive
+        uint32_t    color;
+    };
+
+    int                     width;          // source pixels per row
+    int                     height;         // source rows
+    int                     scale;          // output pixels per source pixel (1-3)
+    bool                    scanlines;      // darken the last output row of each source row
+    std::vector<Band>       bands;
+    std::vector<std::vector<uint32_t>> tints;   // distinct per pixel tint rows
+    std::vector<int>        row_tint;       // tint row of each source row (-1 = none)
+    std::vector<uint32_t>   scratch;        // tinted source row
+public:
+    static const int MAX_SCALE = 3;
+
+    void    setScale(int p_scale);                      // 1, 2 or 3
+    void    setScanlines(bool p_scanlines);             // needs a scale of 2 or 3
+    void    addBand(int top, int bottom, int left, int right, uint32_t color);
+    void    prepare(int p_width, int p_height);         // build the tint rows (after the setters)
+    int     getScale() const;
+    bool    isActive() const;                           // false if rows pass through unchanged
+    void    filterRow(const uint32_t* src, int y, uint8_t* dst, int pitch);  // write one source row
+    ScreenFilter();
+};
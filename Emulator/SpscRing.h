@@ -0,0 +1,99 @@
+/**
+ * [FILE] SpscRing.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a fixed size lock free queue between exactly one producer
+ *               thread and one consumer thread
+ * [DATE] 2021-06-11
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * [DESCRIPTION] Class representing a single producer/single consumer ring buffer
+ *      - Neither side ever blocks, push fails when the ring is full and pop
+ *        fails when it is empty
+ *      - The read and write counters only ever grow, the slot is the counter
+ *        masked by the capacity (so CAPACITY has to be a power of 2)
+ *      - Each counter sits on its own cache line so the two threads do not
+ *        fight over it
+ *      - Before C++17 new only aligns to alignof(max_align_t), so a ring
+ *        created with new places itself on a cache line (a class holding a
+ *        ring should hold it by pointer, new would misalign it)
+*/
+template <typename T, size_t CAPACITY>
+class SpscRing {
+private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "SpscRing capacity must be a power of 2");
+
+    T                               slots[CAPACITY];
+    alignas(64) std::atomic<size_t> read_count;     // written by the consumer only
+    alignas(64) std::atomic<size_t> write_count;    // written by the producer only
+public:
+    /**
+     * [DESCRIPTION] Add an item (producer thread only)
+     *
+     * [PARAM] item
+     * [RETURN] false if the ring was full and the item was dropped
+    */
+    bool push(const T& item)
+    {
+        size_t write = write_count.load(std::memory_order_relaxed);
+        if (write - read_count.load(std::memory_order_acquire) == CAPACITY) {
+            return false;
+        }
+        slots[write & (CAPACITY - 1)] = item;
+        write_count.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * [DESCRIPTION] Take the oldest item (consumer thread only)
+     *
+     * [PARAM] item - filled in on success
+     * [RETURN] false if the ring was empty
+    */
+    bool pop(T& item)
+    {
+        size_t read = read_count.load(std::memory_order_relaxed);
+        if (read == write_count.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = slots[read & (CAPACITY - 1)];
+        read_count.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * [DESCRIPTION] Allocate a ring on a cache line, the block new returned is
+     *               kept in front of it for operator delete
+     *
+     * [PARAM] size
+     * [RETURN] void*
+    */
+    static void* operator new(size_t size)
+    {
+        const size_t align = alignof(SpscRing);
+        void* block = ::operator new(size + align + sizeof(void*));
+        uintptr_t ring = ((uintptr_t)block + sizeof(void*) + align - 1) & ~(uintptr_t)(align - 1);
+        ((void**)ring)[-1] = block;
+        return (void*)ring;
+    }
+
+    /**
+     * [DESCRIPTION] Free a ring operator new allocated
+     *
+     * [PARAM] ring
+    */
+    static void operator delete(void* ring)
+    {
+        if (ring != NULL) {
+            ::operator delete(((void**)ring)[-1]);
+        }
+    }
+
+    SpscRing() : read_count(0), write_count(0) {}
+};
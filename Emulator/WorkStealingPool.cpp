@@ -0,0 +1,103 @@
+/**
+ * [FILE] WorkStealingPool.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the work stealing thread pool
+ * [DATE] 2021-06-07
+*/
+
+#include "WorkStealingPool.h"
+
+/**
+ * [DESCRIPTION] Take the next task for the passed worker, first from its own
+ *               queue and then by stealing from the other queues
+ *
+ * [PARAM] worker
+ * [PARAM] task - set to the task that was taken
+ * [RETURN] false once every queue is empty
+*/
+bool WorkStealingPool::takeTask(size_t worker, std::function<void()>& task)
+{
+	// own queue, newest task first
+	{
+		std::lock_guard<std::mutex> guard(queues[worker].lock);
+		if (!queues[worker].tasks.empty()) {
+			task = std::move(queues[worker].tasks.back());
+			queues[worker].tasks.pop_back();
+			return true;
+		}
+	}
+
+	// steal the oldest task from the next queue that has one
+	for (size_t i = 1; i < queues.size(); i++) {
+		WorkerQueue& victim = queues[(worker + i) % queues.size()];
+		std::lock_guard<std::mutex> guard(victim.lock);
+		if (!victim.tasks.empty()) {
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * [DESCRIPTION] Run tasks on the calling thread until there are none left
+ *
+ * [PARAM] worker
+*/
+void WorkStealingPool::workerLoop(size_t worker)
+{
+	std::function<void()> task;
+	while (takeTask(worker, task)) {
+		task();
+	}
+}
+
+/**
+ * [DESCRIPTION] Add a task to the pool, tasks are dealt round robin
+ *
+ * [PARAM] task
+*/
+void WorkStealingPool::submit(std::function<void()> task)
+{
+	std::lock_guard<std::mutex> guard(queues[next_queue].lock);
+	queues[next_queue].tasks.push_back(std::move(task));
+	next_queue = (next_queue + 1) % queues.size();
+}
+
+/**
+ * [DESCRIPTION] Start the workers, run every submitted task and wait for all
+ *               of them to finish (the calling thread works as worker 0)
+ *
+*/
+void WorkStealingPool::run()
+{
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < queues.size(); i++) {
+		threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+	}
+	workerLoop(0);
+	for (std::thread& t : threads) {
+		t.join();
+	}
+}
+
+/**
+ * [DESCRIPTION] Return the number of workers in the pool
+ *
+*/
+size_t WorkStealingPool::getWorkerCount()
+{
+	return queues.size();
+}
+
+/**
+ * [DESCRIPTION] Construct a new WorkStealingPool object
+ *
+ * [PARAM] num_workers - 0 uses every core of the host
+*/
+WorkStealingPool::WorkStealingPool(size_t num_workers) : queues(num_workers != 0 ? num_workers :
+	(std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1))
+{
+	next_queue = 0;
+}
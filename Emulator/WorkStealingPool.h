@@ -0,0 +1,43 @@
+/**
+ * [FILE] WorkStealingPool.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a thread pool where every worker owns a queue of tasks and
+ *               idle workers steal from the other queues
+ * [DATE] 2021-06-07
+*/
+
+#pragma once
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class representing a work stealing thread pool
+ *      - Tasks are dealt round robin onto the worker queues up front
+ *      - A worker takes from the back of its own queue and steals from
+ *        the front of the others once its own queue runs dry
+*/
+class WorkStealingPool {
+private:
+    /**
+     * [DESCRIPTION] Queue of tasks owned by a single worker
+     *
+    */
+    class WorkerQueue {
+    public:
+        std::mutex                          lock;   // guards tasks
+        std::deque<std::function<void()>>   tasks;  // tasks waiting to run
+    };
+
+    std::vector<WorkerQueue>    queues;             // one queue per worker
+    size_t                      next_queue;         // queue the next submitted task goes on
+    bool                        takeTask(size_t worker, std::function<void()>& task);
+    void                        workerLoop(size_t worker);
+public:
+    void    submit(std::function<void()> task);     // add a task (before run is called)
+    void    run();                                  // run every task and wait for them to finish
+    size_t  getWorkerCount();                       // number of worker threads
+    WorkStealingPool(size_t num_workers);
+};
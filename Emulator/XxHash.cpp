@@ -0,0 +1,146 @@
+/**
+ * [FILE] XxHash.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of XXH64
+ * [DATE] 2021-06-20
+*/
+
+#include "XxHash.h"
+#include <cstring>
+
+static const uint64_t PRIME_1 = 0x9E3779B185EBCA87ull;
+static const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+static const uint64_t PRIME_3 = 0x165667B19E3779F9ull;
+static const uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ull;
+static const uint64_t PRIME_5 = 0x27D4EB2F165667C5ull;
+
+/**
+ * [DESCRIPTION] Rotate left
+ *
+ * [PARAM] val
+ * [PARAM] bits
+ * [RETURN] uint64_t
+*/
+static inline uint64_t rotl(uint64_t val, int bits)
+{
+	return (val << bits) | (val >> (64 - bits));
+}
+
+/**
+ * [DESCRIPTION] Read a little endian 64 bit word (the hosts this builds for
+ *               are little endian)
+ *
+ * [PARAM] bytes
+ * [RETURN] uint64_t
+*/
+static inline uint64_t read64(const uint8_t* bytes)
+{
+	uint64_t val;
+	memcpy(&val, bytes, sizeof(val));
+	return val;
+}
+
+/**
+ * [DESCRIPTION] Read a little endian 32 bit word
+ *
+ * [PARAM] bytes
+ * [RETURN] uint64_t
+*/
+static inline uint64_t read32(const uint8_t* bytes)
+{
+	uint32_t val;
+	memcpy(&val, bytes, sizeof(val));
+	return val;
+}
+
+/**
+ * [DESCRIPTION] Mix a word into one of the four lanes
+ *
+ * [PARAM] acc
+ * [PARAM] input
+ * [RETURN] uint64_t
+*/
+static inline uint64_t mixLane(uint64_t acc, uint64_t input)
+{
+	acc += input * PRIME_2;
+	acc = rotl(acc, 31);
+	return acc * PRIME_1;
+}
+
+/**
+ * [DESCRIPTION] Fold a lane into the hash
+ *
+ * [PARAM] acc
+ * [PARAM] lane
+ * [RETURN] uint64_t
+*/
+static inline uint64_t mergeRound(uint64_t acc, uint64_t lane)
+{
+	acc ^= mixLane(0, lane);
+	return acc * PRIME_1 + PRIME_4;
+}
+
+/**
+ * [DESCRIPTION] Hash a block of memory
+ *      - 32 byte stripes run through four independent lanes, the tail is
+ *        mixed in 8, 4 and 1 bytes at a time and the result avalanched
+ *
+ * [PARAM] data
+ * [PARAM] size
+ * [PARAM] seed
+ * [RETURN] uint64_t
+*/
+uint64_t XxHash::hash64(const void* data, size_t size, uint64_t seed)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	const uint8_t* end = bytes + size;
+	uint64_t hash;
+
+	if (size >= 32) {
+		uint64_t lane_1 = seed + PRIME_1 + PRIME_2;
+		uint64_t lane_2 = seed + PRIME_2;
+		uint64_t lane_3 = seed;
+		uint64_t lane_4 = seed - PRIME_1;
+		const uint8_t* last_stripe = end - 32;
+		do {
+			lane_1 = mixLane(lane_1, read64(bytes));
+			lane_2 = mixLane(lane_2, read64(bytes + 8));
+			lane_3 = mixLane(lane_3, read64(bytes + 16));
+			lane_4 = mixLane(lane_4, read64(bytes + 24));
+			bytes += 32;
+		} while (bytes <= last_stripe);
+
+		hash = rotl(lane_1, 1) + rotl(lane_2, 7) + rotl(lane_3, 12) + rotl(lane_4, 18);
+		hash = mergeRound(hash, lane_1);
+		hash = mergeRound(hash, lane_2);
+		hash = mergeRound(hash, lane_3);
+		hash = mergeRound(hash, lane_4);
+	}
+	else {
+		hash = seed + PRIME_5;
+	}
+	hash += (uint64_t)size;
+
+	// TAIL =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	for (; bytes + 8 <= end; bytes += 8) {
+		hash ^= mixLane(0, read64(bytes));
+		hash = rotl(hash, 27) * PRIME_1 + PRIME_4;
+	}
+	if (bytes + 4 <= end) {
+		hash ^= read32(bytes) * PRIME_1;
+		hash = rotl(hash, 23) * PRIME_2 + PRIME_3;
+		bytes += 4;
+	}
+	for (; bytes < end; bytes++) {
+		hash ^= *bytes * PRIME_5;
+		hash = rotl(hash, 11) * PRIME_1;
+	}
+
+	// AVALANCHE =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	hash ^= hash >> 33;
+	hash *= PRIME_2;
+	hash ^= hash >> 29;
+	hash *= PRIME_3;
+	hash ^= hash >> 32;
+	return hash;
+}
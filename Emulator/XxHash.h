@@ -0,0 +1,22 @@
+/**
+ * [FILE] XxHash.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the XXH64 hash used to fingerprint emulated frames and
+ *               machine states
+ * [DATE] 2021-06-20
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * [DESCRIPTION] Class computing XXH64 (the 64 bit xxHash), several GB/s on a
+ *               single core so a whole board is hashed in a few micro seconds
+ *      - Produces the reference implementation's values (XXH64("", 0) is
+ *        0xEF46DB3751D8E999), input is read as little endian words
+*/
+class XxHash {
+public:
+    static uint64_t hash64(const void* data, size_t size, uint64_t seed = 0);
+};
@@ -0,0 +1,239 @@
+/**
+ * [FILE] SiBatch.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the batch runner
+ * [DATE] 2021-06-07
+*/
+
+#include "SiBatch.h"
+#include "../Emulator/WorkStealingPool.h"
+#include <chrono>
+
+/**
+ * [DESCRIPTION] Step the xorshift64 generator
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiBatch::RandomPolicy::nextRandom()
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+/**
+ * [DESCRIPTION] Return the value port 1 should hold for the passed frame
+ *      - bit 0 = coin, bit 2 = 1P start, bit 4 = fire, bit 5 = left, bit 6 = right
+ *
+ * [PARAM] frame
+ * [RETURN] uint8_t
+*/
+uint8_t SiBatch::RandomPolicy::port1ForFrame(uint64_t frame)
+{
+	// insert a coin and then press start once the credit shows up
+	if (frame >= 60 && frame < 70) {
+		return 0x01;
+	}
+	if (frame >= 120 && frame < 130) {
+		return 0x04;
+	}
+	if (frame < 130) {
+		return 0x00;
+	}
+
+	// hold a random combination of left/right/fire for 4 to 19 frames
+	if (frame >= hold_until) {
+		uint64_t rnd = nextRandom();
+		buttons = (uint8_t)(rnd & 0x70);
+		hold_until = frame + 4 + ((rnd >> 8) % 16);
+	}
+	return buttons;
+}
+
+/**
+ * [DESCRIPTION] Construct a new RandomPolicy object
+ *
+ * [PARAM] seed
+*/
+SiBatch::RandomPolicy::RandomPolicy(uint64_t seed)
+{
+	// xorshift can not start from 0
+	state = seed * 0x9E3779B97F4A7C15ull + 1;
+	hold_until = 0;
+	buttons = 0;
+}
+
+/**
+ * [DESCRIPTION] Fill in the parts of the result that are read from the board
+ *
+ * [PARAM] result
+ * [PARAM] machine
+*/
+void SiBatch::finishResult(Result& result, SiMachine& machine)
+{
+	result.cycles = machine.cpu->clock->getCurrentCCs();
+	result.p1_score = machine.readScore(SiMachine::RAM_P1_SCORE);
+	result.p2_score = machine.readScore(SiMachine::RAM_P2_SCORE);
+	result.hi_score = machine.readScore(SiMachine::RAM_HI_SCORE);
+}
+
+/**
+ * [DESCRIPTION] Apply the command line options to a single board run: the
+ *               watchpoints and the choice of interpreter
+ *
+ * [PARAM] machine
+ * [PARAM] options
+*/
+void SiBatch::setupMachine(SiMachine& machine, const EmulatorOptions& options)
+{
+	machine.use_recompiled = machine.use_recompiled && !options.interpreter;
+	for (const EmulatorOptions::Watch& watch : options.watches) {
+		machine.addWatchpoint({ watch.first, watch.last, watch.kinds, watch.value });
+	}
+}
+
+/**
+ * [DESCRIPTION] Run one frame of a single board run and chain its screen into
+ *               the frame hash
+ *
+ * [PARAM] result
+ * [PARAM] machine
+ * [PARAM] frame - number of the frame being run
+ * [RETURN] false if a watchpoint stopped the run (frames and stop are filled in)
+*/
+bool SiBatch::runFrame(Result& result, SiMachine& machine, uint64_t frame)
+{
+	if (!machine.runFrames(1)) {
+		result.frames = frame;
+		result.stop = machine.describeStop();
+		return false;
+	}
+	result.frame_hash = (result.frame_hash ^ machine.hashVRAM()) * 1099511628211ull;
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Run a single board driven by a random policy
+ *
+ * [PARAM] id
+ * [PARAM] seed
+ * [PARAM] options - frames, watchpoints and interpreter choice
+ * [RETURN] Result
+*/
+SiBatch::Result SiBatch::runPolicy(int id, uint64_t seed, const EmulatorOptions& options)
+{
+	Result result = {};
+	result.id = id;
+	result.source = "seed:" + std::to_string(seed);
+	result.frames = options.frames;
+
+	SiMachine machine(*SiBoard::find(options.board));
+	machine.loadRomFiles();
+	setupMachine(machine, options);
+	RandomPolicy policy(seed);
+
+	for (uint64_t frame = 0; frame < options.frames; frame++) {
+		machine.cpu->io->input.get_port(1)->port_val.byte_val = policy.port1ForFrame(frame);
+		if (!runFrame(result, machine, frame)) {
+			break;
+		}
+	}
+
+	finishResult(result, machine);
+	return result;
+}
+
+/**
+ * [DESCRIPTION] Run a single board driven by a recorded movie
+ *
+ * [PARAM] id
+ * [PARAM] movie_path
+ * [PARAM] options - the run stops early if the movie is shorter than the frames
+ * [RETURN] Result
+*/
+SiBatch::Result SiBatch::runMovie(int id, const char* movie_path, const EmulatorOptions& options)
+{
+	Result result = {};
+	result.id = id;
+	result.source = movie_path;
+
+	SiMovie movie;
+	if (!movie.load(movie_path)) {
+		return result;
+	}
+
+	SiMachine machine(*SiBoard::find(options.board));
+	machine.loadRomFiles();
+	machine.playMovie(&movie);
+	setupMachine(machine, options);
+
+	uint64_t movie_frames = movie.getEndCycle() / SiMachine::INTERRUPT_INTERVAL;
+	result.frames = movie_frames < options.frames ? movie_frames : options.frames;
+	for (uint64_t frame = 0; frame < result.frames; frame++) {
+		if (!runFrame(result, machine, frame)) {
+			break;
+		}
+	}
+
+	finishResult(result, machine);
+	return result;
+}
+
+/**
+ * [DESCRIPTION] Run every run in the batch on a work stealing pool and print
+ *               the results as CSV in run order
+ *
+ * [PARAM] options
+ * [RETURN] int (0 on success)
+*/
+int SiBatch::run(const EmulatorOptions& options)
+{
+	// every board maps the same ROM set, check it once before any run starts
+	SiMachine probe(*SiBoard::find(options.board));
+	if (!probe.loadRomFiles()) {
+		return 1;
+	}
+
+	size_t num_runs = options.batch_movies.size() + (size_t)options.batch_runs;
+	std::vector<Result> results(num_runs);
+	WorkStealingPool pool(options.threads);
+
+	// every task only writes its own slot in results
+	int id = 0;
+	for (const char* movie_path : options.batch_movies) {
+		pool.submit([&results, id, movie_path, &options]() {
+			results[id] = runMovie(id, movie_path, options);
+		});
+		id++;
+	}
+	for (int i = 0; i < options.batch_runs; i++) {
+		uint64_t seed = options.batch_seed + i;
+		pool.submit([&results, id, seed, &options]() {
+			results[id] = runPolicy(id, seed, options);
+		});
+		id++;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	pool.run();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	uint64_t total_frames = 0;
+	printf("id,source,frames,cycles,p1_score,p2_score,hi_score,frame_hash\n");
+	for (const Result& result : results) {
+		printf("%d,%s,%llu,%llu,%d,%d,%d,%016llx\n", result.id, result.source.c_str(),
+			(unsigned long long)result.frames, (unsigned long long)result.cycles,
+			result.p1_score, result.p2_score, result.hi_score, (unsigned long long)result.frame_hash);
+		total_frames += result.frames;
+	}
+	for (const Result& result : results) {
+		if (!result.stop.empty()) {
+			fprintf(stderr, "run %d stopped: %s\n", result.id, result.stop.c_str());
+		}
+	}
+	fprintf(stderr, "%zu runs, %llu frames on %zu threads in %.3f s (%.0f frames/s)\n",
+		num_runs, (unsigned long long)total_frames, pool.getWorkerCount(), seconds,
+		seconds > 0 ? total_frames / seconds : 0.0);
+	return 0;
+}
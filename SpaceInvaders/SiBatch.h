@@ -0,0 +1,59 @@
+/**
+ * [FILE] SiBatch.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains an object that runs many independent Space Invaders boards
+ *               headless across every core and gathers their results
+ * [DATE] 2021-06-07
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include "../Emulator/EmulatorOptions.h"
+#include <string>
+
+/**
+ * [DESCRIPTION] Class which runs a batch of boards on a work stealing pool
+ *      - Every run owns its board and input source so runs share nothing
+ *        and scale with the number of cores
+*/
+class SiBatch {
+public:
+    // result gathered from a single run
+    struct Result {
+        int         id;                 // index of the run in the batch
+        std::string source;             // movie path or random policy seed
+        uint64_t    frames;             // frames that were run
+        uint64_t    cycles;             // clock cycles that were run
+        int         p1_score;           // player 1 score at the end of the run
+        int         p2_score;           // player 2 score at the end of the run
+        int         hi_score;           // high score at the end of the run
+        uint64_t    frame_hash;         // hash chained over the screen of every frame
+        std::string stop;               // watchpoint that ended the run early (empty if none)
+    };
+
+    static int      run(const EmulatorOptions& options);   // run the batch, returns the exit code
+
+    /**
+     * [DESCRIPTION] Input source that inserts a coin, starts a one player game
+     *               and then holds random combinations of left/right/fire
+     *               (also drives the sessions of SiDiff)
+     *
+    */
+    class RandomPolicy {
+    private:
+        uint64_t    state;              // xorshift64 state
+        uint64_t    hold_until;         // frame the current input is held until
+        uint8_t     buttons;            // port 1 movement/fire bits currently held
+        uint64_t    nextRandom();
+    public:
+        uint8_t     port1ForFrame(uint64_t frame);   // port 1 value for the passed frame
+        RandomPolicy(uint64_t seed);
+    };
+
+private:
+    static Result   runPolicy(int id, uint64_t seed, const EmulatorOptions& options);
+    static Result   runMovie(int id, const char* movie_path, const EmulatorOptions& options);
+    static void     finishResult(Result& result, SiMachine& machine);
+    static void     setupMachine(SiMachine& machine, const EmulatorOptions& options);
+    static bool     runFrame(Result& result, SiMachine& machine, uint64_t frame);
+};
@@ -0,0 +1,42 @@
+/**
+ * [FILE] SiBoard.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the lookup of the Space Invaders family boards
+ * [DATE] 2021-06-14
+*/
+
+#include "SiBoard.h"
+#include <cstdio>
+#include <cstring>
+
+// every board --board accepts, the first one is the default
+static const SiBoard* const BOARDS[] = {
+	&SiBoards::INVADERS,
+};
+
+/**
+ * [DESCRIPTION] Find a board by its --board name
+ *
+ * [PARAM] name
+ * [RETURN] const SiBoard* (NULL if there is no such board)
+*/
+const SiBoard* SiBoard::find(const char* name)
+{
+	for (const SiBoard* board : BOARDS) {
+		if (strcmp(board->name, name) == 0) {
+			return board;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * [DESCRIPTION] Print the name, title and ROM manifest of every board
+ *
+*/
+void SiBoard::printBoards()
+{
+	for (const SiBoard* board : BOARDS) {
+		printf("  %-10s %s (%s)\n", board->name, board->title, board->romset);
+	}
+}
@@ -0,0 +1,83 @@
+/**
+ * [FILE] SiBoard.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the descriptions of the Midway 8080 boards that share the
+ *               Space Invaders hardware (ROM/RAM map, port devices, interrupts and
+ *               video), SiMachine is built from one of them
+ * [DATE] 2021-06-14
+*/
+
+#pragma once
+#include <cstdint>
+
+/**
+ * [DESCRIPTION] Struct describing one board of the Space Invaders family
+ *      - Everything is known at compile time, SiMachine keeps its own copy so
+ *        nothing is looked up while the board runs
+ *      - The boards all have the 2 MHz 8080, the shift register, the 1bpp
+ *        frame buffer and the two RST interrupts per frame, they differ in
+ *        where the ROM lives
+*/
+struct SiBoard {
+    // an inclusive range of the address space
+    struct Range {
+        uint16_t    first;
+        uint16_t    last;
+    };
+
+    static const int MAX_ROM_RANGES = 2;
+
+    const char* name;                   // --board name (the MAME short name)
+    const char* title;
+    const char* romset;                 // manifest in the ROM directory
+
+    // MEMORY =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    Range       rom[MAX_ROM_RANGES];    // where the manifest's files may load
+    int         num_rom;
+    Range       ram;                    // work RAM and the frame buffer
+
+    // PORTS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    uint8_t     input_ports[2];         // IN, player 1 (coin/start) and player 2 controls
+    uint8_t     shift_amount_port;      // OUT, bits 0-2 pick the shifted byte
+    uint8_t     shift_data_port;        // OUT, shifted into the register
+    uint8_t     shift_result_port;      // IN, the shifted byte
+    uint8_t     sound_ports[2];         // OUT, captured for the front end
+
+    // INTERRUPTS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    int         interrupt_interval;     // clock cycles between interrupts
+    uint8_t     interrupts[2];          // RST numbers, sent in turn
+
+    // VIDEO =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    uint16_t    vram;                   // first byte of the 1bpp frame buffer
+    int         screen_width;           // pixels across the monitor (it is rotated)
+    int         screen_height;
+
+    constexpr int   getVRAMBytes() const { return screen_width * screen_height / 8; }
+    constexpr bool  isRom(uint16_t address) const
+    {
+        return (num_rom > 0 && address >= rom[0].first && address <= rom[0].last) ||
+            (num_rom > 1 && address >= rom[1].first && address <= rom[1].last);
+    }
+
+    static const SiBoard*   find(const char* name);     // NULL if there is no such board
+    static void             printBoards();              // list the --board names
+};
+
+/* Midway/Taito boards on the Space Invaders hardware, every one of them is
+    mapped like MAME's mw8080bw driver: ROM at 0000-1FFF (and 4000-5FFF when
+    the game needs more), RAM at 2000-3FFF. A board is only listed here once
+    its manifest is verified and it runs, and it has to keep the frame timing
+    and screen of INVADERS (the batch runs, movies and front end share them) */
+namespace SiBoards {
+    constexpr SiBoard INVADERS = {
+        "invaders", "Space Invaders (Midway, 1978)", "invaders.romset",
+        { { 0x0000, 0x1FFF }, { 0, 0 } }, 1, { 0x2000, 0x3FFF },
+        { 1, 2 }, 2, 4, 3, { 3, 5 },
+        33333, { 1, 2 },
+        0x2400, 224, 256
+    };
+
+    static_assert(INVADERS.vram >= INVADERS.ram.first &&
+        INVADERS.vram + INVADERS.getVRAMBytes() - 1 <= INVADERS.ram.last,
+        "the frame buffer has to be in RAM");
+}
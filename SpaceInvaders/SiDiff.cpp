@@ -0,0 +1,482 @@
+/**
+ * [FILE] SiDiff.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the differential harness
+ * [DATE] 2021-06-15
+*/
+
+#include "SiDiff.h"
+#include "SiRecompiled.h"
+#include "../Emulator/WorkStealingPool.h"
+#include "../i8080/i8080_OpSpec.h"
+#include <chrono>
+#include <cstdio>
+
+/**
+ * [DESCRIPTION] Step a xorshift64 generator
+ *
+ * [PARAM] state
+ * [RETURN] uint64_t
+*/
+static uint64_t nextRandom(uint64_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+// SIDE =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Build the board of a session, the reference and the candidate
+ *               are set up by the same call so they start out identical
+ *      - Policy/movie sessions boot the game from its ROM
+ *      - Random sessions fill everything above the ROM with random code (the
+ *        same code for every session of the run)
+ *        and start from a random cpu state of their own, every opcode (HLT
+ *        included) is fair game
+ *      - Program sessions load a CP/M .COM file (e.g. an 8080 exerciser) at
+ *        0100 with a BDOS stub that returns straight away, the session ends
+ *        when the program jumps back to 0000 (which loops on itself)
+ *
+ * [PARAM] session
+ * [PARAM] options - the --seed the random code is built from
+ * [RETURN] false if the ROM, movie or program could not be loaded
+*/
+bool SiDiff::Side::setup(const Session& session, const EmulatorOptions& options)
+{
+	i8080* cpu = machine.cpu;
+	if (kind != SESSION_PROGRAM && !machine.loadRomFiles()) {
+		return false;
+	}
+
+	if (kind == SESSION_MOVIE) {
+		if (!movie.load(session.path)) {
+			return false;
+		}
+		machine.playMovie(&movie);
+	}
+	else if (kind == SESSION_RANDOM) {
+		uint64_t code_state = options.batch_seed * 0x9E3779B97F4A7C15ull + 1;
+		for (uint32_t address = SiRecompiled::ROM_SIZE; address <= 0xFFFF; address++) {
+			cpu->memory->set((uint16_t)address, (uint8_t)nextRandom(code_state));
+		}
+		uint16_t pc = (uint16_t)(SiRecompiled::ROM_SIZE + nextRandom(code_state) % (0x10000 - SiRecompiled::ROM_SIZE));
+
+		uint64_t state = session.seed * 0x9E3779B97F4A7C15ull + 1;
+		uint64_t rnd = nextRandom(state);
+		cpu->registers->A.set((uint8_t)rnd);
+		cpu->registers->B.set((uint8_t)(rnd >> 8));
+		cpu->registers->C.set((uint8_t)(rnd >> 16));
+		cpu->registers->D.set((uint8_t)(rnd >> 24));
+		cpu->registers->E.set((uint8_t)(rnd >> 32));
+		cpu->registers->H.set((uint8_t)(rnd >> 40));
+		cpu->registers->L.set((uint8_t)(rnd >> 48));
+		rnd = nextRandom(state);
+		cpu->registers->SP.set((uint16_t)rnd);
+		cpu->flags->S.set(((rnd >> 16) & 1) != 0);
+		cpu->flags->Z.set(((rnd >> 17) & 1) != 0);
+		cpu->flags->AC.set(((rnd >> 18) & 1) != 0);
+		cpu->flags->P.set(((rnd >> 19) & 1) != 0);
+		cpu->flags->C.set(((rnd >> 20) & 1) != 0);
+		for (unsigned char port = 0; port < 3; port++) {
+			cpu->io->input.get_port(port)->port_val.byte_val = (uint8_t)(rnd >> (24 + port * 8));
+		}
+		cpu->registers->PC.set(pc);
+	}
+	else if (kind == SESSION_PROGRAM) {
+#pragma warning(disable:4996)
+		FILE* f = fopen(session.path, "rb");
+		if (f == NULL) {
+			fprintf(stderr, "ERROR OPENING PROGRAM %s\n", session.path);
+			return false;
+		}
+		std::vector<uint8_t> data(PROGRAM_BDOS - PROGRAM_START + 1);
+		size_t size = fread(data.data(), 1, data.size(), f);
+		fclose(f);
+		if (size == 0 || size == data.size()) {
+			fprintf(stderr, "PROGRAM %s IS EMPTY OR DOES NOT FIT BELOW %04X\n", session.path, PROGRAM_BDOS);
+			return false;
+		}
+		for (size_t i = 0; i < size; i++) {
+			cpu->memory->set((uint16_t)(PROGRAM_START + i), data[i]);
+		}
+
+		// 0000 loops on itself so a finished program stays there, CALL 5 jumps
+		// to a RET and programs take their stack from the address at 6
+		cpu->memory->set(0x0000, 0xC3);
+		cpu->memory->set(0x0001, 0x00);
+		cpu->memory->set(0x0002, 0x00);
+		cpu->memory->set(0x0005, 0xC3);
+		cpu->memory->set(0x0006, (uint8_t)PROGRAM_BDOS);
+		cpu->memory->set(0x0007, (uint8_t)(PROGRAM_BDOS >> 8));
+		cpu->memory->set(PROGRAM_BDOS, 0xC9);
+		cpu->registers->SP.set(PROGRAM_BDOS);
+		cpu->registers->PC.set(PROGRAM_START);
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Apply the input a policy session holds during the frame
+ *
+ * [PARAM] frame
+*/
+void SiDiff::Side::startFrame(uint64_t frame)
+{
+	if (kind == SESSION_POLICY) {
+		machine.cpu->io->input.get_port(1)->port_val.byte_val = policy.port1ForFrame(frame);
+	}
+}
+
+/**
+ * [DESCRIPTION] Check if the session has nothing left to compare
+ *      - A program session has returned to CP/M
+ *      - A random session ran a HLT with interrupts off, the cpu can not
+ *        leave it (a HLT with INTE set waits for the board's interrupt and
+ *        the session goes on)
+ *
+ * [RETURN] bool
+*/
+bool SiDiff::Side::isFinished()
+{
+	i8080* cpu = machine.cpu;
+	if (kind == SESSION_RANDOM) {
+		return cpu->flags->halted && !cpu->flags->INTE.get();
+	}
+	return kind == SESSION_PROGRAM && cpu->registers->PC.get() == 0x0000;
+}
+
+/**
+ * [DESCRIPTION] Run the reference opcode by opcode until it reaches the cycle
+ *               the candidate stopped on, the PCs it ran are kept for the report
+ *
+ * [PARAM] cycle
+*/
+void SiDiff::Side::catchUp(uint64_t cycle)
+{
+	trace.clear();
+	while (machine.cpu->clock->getCurrentCCs() < cycle) {
+		trace.push_back(machine.cpu->registers->PC.get());
+		machine.runInstruction();
+	}
+}
+
+/**
+ * [DESCRIPTION] Construct a new Side object
+ *
+ * [PARAM] board
+ * [PARAM] session
+*/
+SiDiff::Side::Side(const SiBoard& board, const Session& session) : machine(board), policy(session.seed)
+{
+	kind = session.kind;
+}
+
+// COMPARISON =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+/**
+ * [DESCRIPTION] Compare the state of the two boards
+ *
+ * [PARAM] reference
+ * [PARAM] candidate
+ * [PARAM] full - also compare the whole memory and the ports
+ * [RETURN] std::string (every field that differs as name=reference/candidate, empty if none)
+*/
+std::string SiDiff::compareState(SiMachine& reference, SiMachine& candidate, bool full)
+{
+	i8080* ref = reference.cpu;
+	i8080* cand = candidate.cpu;
+	std::string diff;
+	char text[96];
+	auto field = [&diff, &text](const char* name, unsigned ref_val, unsigned cand_val) {
+		if (ref_val != cand_val) {
+			snprintf(text, sizeof(text), " %s=%X/%X", name, ref_val, cand_val);
+			diff += text;
+		}
+	};
+
+	field("A", ref->registers->A.get(), cand->registers->A.get());
+	field("B", ref->registers->B.get(), cand->registers->B.get());
+	field("C", ref->registers->C.get(), cand->registers->C.get());
+	field("D", ref->registers->D.get(), cand->registers->D.get());
+	field("E", ref->registers->E.get(), cand->registers->E.get());
+	field("H", ref->registers->H.get(), cand->registers->H.get());
+	field("L", ref->registers->L.get(), cand->registers->L.get());
+	field("SP", ref->registers->SP.get(), cand->registers->SP.get());
+	field("PC", ref->registers->PC.get(), cand->registers->PC.get());
+	field("flag_S", ref->flags->S.get(), cand->flags->S.get());
+	field("flag_Z", ref->flags->Z.get(), cand->flags->Z.get());
+	field("flag_AC", ref->flags->AC.get(), cand->flags->AC.get());
+	field("flag_P", ref->flags->P.get(), cand->flags->P.get());
+	field("flag_C", ref->flags->C.get(), cand->flags->C.get());
+	field("INTE", ref->flags->INTE.get(), cand->flags->INTE.get());
+	field("INT", ref->interrupt_pending, cand->interrupt_pending);
+	field("HLT", ref->flags->halted, cand->flags->halted);
+	if (ref->clock->getCurrentCCs() != cand->clock->getCurrentCCs()) {
+		snprintf(text, sizeof(text), " cycle=%llu/%llu", (unsigned long long)ref->clock->getCurrentCCs(),
+			(unsigned long long)cand->clock->getCurrentCCs());
+		diff += text;
+	}
+	if (!full) {
+		return diff;
+	}
+
+	// MEMORY =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	int num_bytes = 0;
+	for (uint32_t address = 0; address <= 0xFFFF; address++) {
+		uint8_t ref_val = ref->memory->get((uint16_t)address);
+		uint8_t cand_val = cand->memory->get((uint16_t)address);
+		if (ref_val != cand_val && num_bytes++ == 0) {
+			snprintf(text, sizeof(text), " mem[%04X]=%02X/%02X", address, ref_val, cand_val);
+			diff += text;
+		}
+	}
+	if (num_bytes > 1) {
+		snprintf(text, sizeof(text), " (%d bytes of memory differ)", num_bytes);
+		diff += text;
+	}
+
+	// PORTS =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	for (int port = 0; port < 256; port++) {
+		uint8_t ref_in = ref->io->input.get_port((unsigned char)port)->port_val.byte_val;
+		uint8_t cand_in = cand->io->input.get_port((unsigned char)port)->port_val.byte_val;
+		uint8_t ref_out = ref->io->output.get_port((unsigned char)port)->port_val.byte_val;
+		uint8_t cand_out = cand->io->output.get_port((unsigned char)port)->port_val.byte_val;
+		if (ref_in != cand_in) {
+			snprintf(text, sizeof(text), " in[%02X]=%02X/%02X", port, ref_in, cand_in);
+			diff += text;
+		}
+		if (ref_out != cand_out) {
+			snprintf(text, sizeof(text), " out[%02X]=%02X/%02X", port, ref_out, cand_out);
+			diff += text;
+		}
+	}
+	return diff;
+}
+
+/**
+ * [DESCRIPTION] Return the cpu state of a board as text
+ *
+ * [PARAM] machine
+ * [RETURN] std::string
+*/
+std::string SiDiff::describeCpu(SiMachine& machine)
+{
+	i8080* cpu = machine.cpu;
+	char text[160];
+	snprintf(text, sizeof(text),
+		"A=%02X BC=%02X%02X DE=%02X%02X HL=%02X%02X SP=%04X PC=%04X S=%d Z=%d AC=%d P=%d C=%d INTE=%d cycle=%llu",
+		cpu->registers->A.get(), cpu->registers->B.get(), cpu->registers->C.get(),
+		cpu->registers->D.get(), cpu->registers->E.get(), cpu->registers->H.get(), cpu->registers->L.get(),
+		cpu->registers->SP.get(), cpu->registers->PC.get(),
+		cpu->flags->S.get(), cpu->flags->Z.get(), cpu->flags->AC.get(), cpu->flags->P.get(), cpu->flags->C.get(),
+		cpu->flags->INTE.get(), (unsigned long long)cpu->clock->getCurrentCCs());
+	return text;
+}
+
+/**
+ * [DESCRIPTION] Describe the step the engines diverged on: the opcodes the
+ *               reference ran in it, the fields that differ and both cpu states
+ *
+ * [PARAM] reference
+ * [PARAM] candidate
+ * [PARAM] step
+ * [PARAM] diff - from compareState
+ * [RETURN] std::string
+*/
+std::string SiDiff::describeDivergence(Side& reference, Side& candidate, uint64_t step, const std::string& diff)
+{
+	char text[64];
+	snprintf(text, sizeof(text), "step %llu, the reference ran", (unsigned long long)step);
+	std::string report = text;
+	for (size_t i = 0; i < reference.trace.size() && i < 16; i++) {
+		uint16_t pc = reference.trace[i];
+		uint8_t bytes[3];
+		for (int j = 0; j < 3; j++) {
+			bytes[j] = reference.machine.cpu->memory->get(pc + j);
+		}
+		char instruction[32];
+		i8080_OpSpec::disassemble(bytes, instruction, sizeof(instruction));
+		snprintf(text, sizeof(text), "\n      %04X  %s", pc, instruction);
+		report += text;
+	}
+	if (reference.trace.size() > 16) {
+		report += "\n      ...";
+	}
+	report += "\n    differs (reference/candidate):" + diff;
+	report += "\n    reference: " + describeCpu(reference.machine);
+	report += "\n    candidate: " + describeCpu(candidate.machine);
+	return report;
+}
+
+// ENGINES =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Run one step of the recompiled engine: the block at the PC if
+ *               one starts there and ends before the goal and the next event,
+ *               otherwise one opcode on the interpreter (the same choice the
+ *               cabinet run loop makes)
+ *
+ * [PARAM] machine
+ * [PARAM] goal
+*/
+void SiDiff::stepRecompiled(SiMachine& machine, uint64_t goal)
+{
+	uint64_t now = machine.cpu->clock->getCurrentCCs();
+	uint64_t limit = goal < machine.nextEventCycle() ? goal : machine.nextEventCycle();
+	const SiRecompiled::Block* block = NULL;
+	if (machine.use_recompiled && !machine.cpu->flags->halted && now < limit) {
+		block = SiRecompiled::findBlock(machine.cpu->registers->PC.get());
+	}
+	if (block != NULL && now + block->max_cycles <= limit) {
+		machine.use_recompiled = SiRecompiled::run(machine, now + block->max_cycles);
+	}
+	if (machine.cpu->clock->getCurrentCCs() == now) {
+		machine.runInstruction();
+	}
+}
+
+/**
+ * [DESCRIPTION] Run a session on the interpreter and on the recompiled blocks
+ *               and compare them after every step
+ *
+ * [PARAM] session
+ * [PARAM] options - frames and board
+ * [PARAM] every - compare memory and ports every this many steps
+ * [PARAM] max_steps - stop after this many steps (0 = run every frame)
+ * [RETURN] Result
+*/
+SiDiff::Result SiDiff::runSession(const Session& session, const EmulatorOptions& options, uint64_t every, uint64_t max_steps)
+{
+	Result result = { session.id, session.source, 0, 0, false, false, "" };
+	const SiBoard& board = *SiBoard::find(options.board);
+	Side reference(board, session);
+	Side candidate(board, session);
+	if (!reference.setup(session, options) || !candidate.setup(session, options)) {
+		result.failed = true;
+		return result;
+	}
+	reference.machine.use_recompiled = false;
+
+	uint64_t frames = options.frames;
+	if (session.kind == SESSION_MOVIE && reference.movie.getEndCycle() / SiMachine::INTERRUPT_INTERVAL < frames) {
+		frames = reference.movie.getEndCycle() / SiMachine::INTERRUPT_INTERVAL;
+	}
+
+	bool done = false;
+	for (uint64_t frame = 0; frame < frames && !done; frame++) {
+		uint64_t frame_end = (frame + 1) * SiMachine::INTERRUPT_INTERVAL;
+		reference.startFrame(frame);
+		candidate.startFrame(frame);
+		while (!done && candidate.machine.cpu->clock->getCurrentCCs() < frame_end) {
+			stepRecompiled(candidate.machine, frame_end);
+			reference.catchUp(candidate.machine.cpu->clock->getCurrentCCs());
+			result.steps++;
+
+			std::string diff = compareState(reference.machine, candidate.machine, result.steps % every == 0);
+			if (!diff.empty()) {
+				result.diverged = true;
+				result.report = describeDivergence(reference, candidate, result.steps, diff);
+			}
+			done = result.diverged || reference.isFinished() || result.steps == max_steps;
+		}
+	}
+
+	// memory written since the last full comparison
+	if (!result.diverged) {
+		std::string diff = compareState(reference.machine, candidate.machine, true);
+		if (!diff.empty()) {
+			result.diverged = true;
+			result.report = describeDivergence(reference, candidate, result.steps, diff);
+		}
+	}
+	result.cycles = candidate.machine.cpu->clock->getCurrentCCs();
+	return result;
+}
+
+// RUN =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] List the sessions asked for on the command line: movies,
+ *               random policy games, random instruction streams and programs
+ *
+ * [PARAM] options
+ * [RETURN] std::vector<Session>
+*/
+std::vector<SiDiff::Session> SiDiff::listSessions(const EmulatorOptions& options)
+{
+	std::vector<Session> sessions;
+	for (const char* path : options.batch_movies) {
+		sessions.push_back({ (int)sessions.size(), SESSION_MOVIE, 0, path, path });
+	}
+	for (int i = 0; i < options.batch_runs; i++) {
+		uint64_t seed = options.batch_seed + i;
+		sessions.push_back({ (int)sessions.size(), SESSION_POLICY, seed, NULL, "seed:" + std::to_string(seed) });
+	}
+	for (int i = 0; i < options.diff_random; i++) {
+		uint64_t seed = options.batch_seed + i;
+		sessions.push_back({ (int)sessions.size(), SESSION_RANDOM, seed, NULL, "random:" + std::to_string(seed) });
+	}
+	for (const char* path : options.diff_programs) {
+		sessions.push_back({ (int)sessions.size(), SESSION_PROGRAM, 0, path, std::string("program:") + path });
+	}
+	return sessions;
+}
+
+/**
+ * [DESCRIPTION] Run every session against the engine picked with --diff across
+ *               every core and print the results as CSV, the report of every
+ *               divergence and the summary go to stderr so stdout stays CSV
+ *
+ * [PARAM] options
+ * [RETURN] int (0 if every session matched the reference)
+*/
+int SiDiff::run(const EmulatorOptions& options)
+{
+	std::vector<Session> sessions = listSessions(options);
+	std::vector<Result> results(sessions.size());
+	uint64_t every = options.diff_every;
+	WorkStealingPool pool(options.threads);
+
+	// every task only writes its own slots in results, a session that diverged
+	// is run again up to the divergence with memory compared on every step
+	for (const Session& session : sessions) {
+		const Session* entry = &session;
+		pool.submit([&results, entry, &options, every]() {
+			results[entry->id] = runSession(*entry, options, every, 0);
+			if (results[entry->id].diverged && every > 1) {
+				Result again = runSession(*entry, options, 1, results[entry->id].steps);
+				if (again.diverged) {
+					results[entry->id] = again;
+				}
+			}
+		});
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	pool.run();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	uint64_t total_steps = 0;
+	int num_diverged = 0;
+	int num_failed = 0;
+	printf("id,source,steps,cycles,result\n");
+	for (const Result& result : results) {
+		printf("%d,%s,%llu,%llu,%s\n", result.id, result.source.c_str(), (unsigned long long)result.steps,
+			(unsigned long long)result.cycles, result.failed ? "error" : (result.diverged ? "diverged" : "match"));
+		total_steps += result.steps;
+		num_diverged += result.diverged ? 1 : 0;
+		num_failed += result.failed ? 1 : 0;
+	}
+	for (const Result& result : results) {
+		if (result.diverged) {
+			fprintf(stderr, "run %d (%s) diverged at %s\n", result.id, result.source.c_str(), result.report.c_str());
+		}
+	}
+	fprintf(stderr, "%zu sessions, %llu %s steps compared against the interpreter on %zu threads in %.3f s: "
+		"%d diverged, %d could not be run\n", sessions.size(), (unsigned long long)total_steps,
+		options.diff_engine, pool.getWorkerCount(), seconds, num_diverged, num_failed);
+	return num_diverged == 0 && num_failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+/**
+ * [FILE] SiDiff.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a differential harness that runs the faster engine (the
+ *               recompiled ROM blocks) next to the reference interpreter and
+ *               reports the first state they disagree on
+ * [DATE] 2021-06-15
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include "SiBatch.h"
+#include "SiMovie.h"
+#include "../Emulator/EmulatorOptions.h"
+#include <string>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class which proves a candidate engine matches the interpreter
+ *      - Every session runs twice from the same input: on the interpreter
+ *        (i8080_OpCodes, the reference) and on the candidate
+ *      - After every candidate step the reference is run up to the same
+ *        clock cycle and the cpu state is compared, memory and the ports are
+ *        compared every --diff-every steps
+ *      - A session that diverges is run again with memory compared on every
+ *        step, so the report names the first step that differs
+ *      - A step of the recompiled engine is one block (or one opcode where
+ *        there is no block)
+*/
+class SiDiff {
+public:
+    static int      run(const EmulatorOptions& options);   // run every session, returns the exit code
+
+private:
+    enum Kind { SESSION_POLICY, SESSION_MOVIE, SESSION_RANDOM, SESSION_PROGRAM };
+
+    static const uint16_t PROGRAM_START = 0x0100;   // CP/M programs load and start here
+    static const uint16_t PROGRAM_BDOS = 0xF000;    // BDOS stub (a RET) and top of the stack
+
+    // an input source, the reference and the candidate are both built from it
+    struct Session {
+        int         id;
+        Kind        kind;
+        uint64_t    seed;               // policy/random sessions
+        const char* path;               // movie/program sessions
+        std::string source;             // shown in the report
+    };
+
+    /**
+     * [DESCRIPTION] A board and the input it is driven by
+     *
+    */
+    class Side {
+    public:
+        SiMachine   machine;
+        SiMovie     movie;
+        SiBatch::RandomPolicy policy;
+        Kind        kind;
+        std::vector<uint16_t> trace;    // PCs the reference ran in the current step
+
+        bool        setup(const Session& session, const EmulatorOptions& options);
+        void        startFrame(uint64_t frame);     // apply the policy input of the frame
+        bool        isFinished();       // a program returned to CP/M, random code halted for good
+        void        catchUp(uint64_t cycle);        // run the reference to the candidate's cycle
+        Side(const SiBoard& board, const Session& session);
+    };
+
+    // outcome of a session
+    struct Result {
+        int         id;
+        std::string source;
+        uint64_t    steps;              // steps that were compared
+        uint64_t    cycles;             // clock cycles that were run
+        bool        diverged;           // the engines disagree (see report)
+        bool        failed;             // the session could not be set up
+        std::string report;             // where and how the engines differ
+    };
+
+    static std::vector<Session> listSessions(const EmulatorOptions& options);
+    static void     stepRecompiled(SiMachine& machine, uint64_t goal);
+    static std::string compareState(SiMachine& reference, SiMachine& candidate, bool full);
+    static std::string describeCpu(SiMachine& machine);
+    static std::string describeDivergence(Side& reference, Side& candidate, uint64_t step, const std::string& diff);
+    static Result   runSession(const Session& session, const EmulatorOptions& options, uint64_t every, uint64_t max_steps);
+};
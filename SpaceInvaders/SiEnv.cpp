@@ -0,0 +1,237 @@
+/**
+ * [FILE] SiEnv.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the batched environment
+ * [DATE] 2021-06-09
+*/
+
+#include "SiEnv.h"
+#include <cstring>
+
+// port 1 bits for every Action (bit 4 = fire, bit 5 = left, bit 6 = right)
+static const uint8_t ACTION_PORT1[SiEnv::NUM_ACTIONS] = { 0x00, 0x10, 0x40, 0x20, 0x50, 0x30 };
+
+// the game is started by a coin on frames 60-69 and 1P start on frames 120-129
+static const int START_FRAMES = 130;
+
+/**
+ * [DESCRIPTION] Port 1 value for a frame of the scripted game start
+ *
+ * [PARAM] frame
+ * [RETURN] uint8_t
+*/
+static uint8_t startInput(int frame)
+{
+	if (frame >= 60 && frame < 70) {
+		return 0x01;
+	}
+	if (frame >= 120 && frame < START_FRAMES) {
+		return 0x04;
+	}
+	return 0x00;
+}
+
+/**
+ * [DESCRIPTION] Step the xorshift64 generator
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiEnv::nextRandom()
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+	return rng_state;
+}
+
+/**
+ * [DESCRIPTION] Finish starting an episode once the start button was pressed,
+ *               a random number of no-op frames keeps the envs from all
+ *               playing the same game
+ *
+ * [PARAM] env
+*/
+void SiEnv::startGame(int env)
+{
+	SiMachine* machine = machines[env];
+	machine->cpu->io->input.get_port(1)->port_val.byte_val = 0;
+	machine->runFrames(nextRandom() % (uint64_t)(noop_max + 1));
+	last_score[env] = machine->readScore(SiMachine::RAM_P1_SCORE);
+	episode_frame[env] = 0;
+}
+
+/**
+ * [DESCRIPTION] Return the number of environments in the batch
+ *
+*/
+int SiEnv::getNumEnvs()
+{
+	return (int)machines.size();
+}
+
+/**
+ * [DESCRIPTION] Start a new episode on every environment
+ *
+*/
+void SiEnv::reset()
+{
+	for (int env = 0; env < getNumEnvs(); env++) {
+		reset(env);
+	}
+}
+
+/**
+ * [DESCRIPTION] Start a new episode on a single environment
+ *
+ * [PARAM] env
+*/
+void SiEnv::reset(int env)
+{
+	SiMachine* machine = machines[env];
+	machine->reset();
+	for (int frame = 0; frame < START_FRAMES; frame++) {
+		machine->cpu->io->input.get_port(1)->port_val.byte_val = startInput(frame);
+		machine->runFrames(1);
+	}
+	startGame(env);
+}
+
+/**
+ * [DESCRIPTION] Hold every environment's action for frame_skip frames
+ *
+ * [PARAM] actions - num_envs Action values (anything out of range is a no-op)
+ * [PARAM] rewards - set to the P1 score gained during the step
+ * [PARAM] dones - set to 1 if the episode ended (the env was reset)
+*/
+void SiEnv::step(const uint8_t* actions, int32_t* rewards, uint8_t* dones)
+{
+	for (int env = 0; env < getNumEnvs(); env++) {
+		SiMachine* machine = machines[env];
+		uint8_t action = actions[env] < NUM_ACTIONS ? actions[env] : (uint8_t)ACTION_NOOP;
+		machine->cpu->io->input.get_port(1)->port_val.byte_val = ACTION_PORT1[action];
+		machine->runFrames(frame_skip);
+
+		int score = machine->readScore(SiMachine::RAM_P1_SCORE);
+		// the 4 digit score rolls over after 9990
+		rewards[env] = score >= last_score[env] ? score - last_score[env] : score + 10000 - last_score[env];
+		last_score[env] = score;
+		episode_frame[env] += frame_skip;
+
+		// the game goes back to attract mode once the last ship is lost
+		dones[env] = machine->cpu->memory->get(SiMachine::RAM_GAME_MODE) == 0;
+		if (dones[env]) {
+			reset(env);
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Return a zero copy view of an environment's VRAM
+ *      - VRAM_BYTES bytes, 32 bytes per screen column from the left, the
+ *        least significant bit of each byte is the lowest pixel
+ *
+ * [PARAM] env
+ * [RETURN] const uint8_t*
+*/
+const uint8_t* SiEnv::observation(int env)
+{
+	return machines[env]->getVRAM();
+}
+
+/**
+ * [DESCRIPTION] Write every environment's screen, upright and downscaled 2x2
+ *               to grayscale, into one contiguous caller owned array
+ *
+ * [PARAM] out - num_envs * OBS_HEIGHT * OBS_WIDTH bytes, row major from the top left
+*/
+void SiEnv::observations(uint8_t* out)
+{
+	// number of lit pixels in a 2x2 box to a gray level
+	static const uint8_t GRAY[5] = { 0, 64, 128, 191, 255 };
+
+	for (int env = 0; env < getNumEnvs(); env++) {
+		const uint8_t* vram = observation(env);
+		uint8_t* obs = out + (size_t)env * OBS_HEIGHT * OBS_WIDTH;
+		for (int col = 0; col < OBS_WIDTH; col++) {
+			const uint8_t* left = vram + (col * 2) * 32;
+			const uint8_t* right = left + 32;
+			for (int row = 0; row < OBS_HEIGHT; row++) {
+				// screen rows 2*row and 2*row+1 are VRAM bits 255-2*row and 254-2*row
+				int bit = 255 - row * 2;
+				int index = bit >> 3;
+				int shift = (bit & 0x07) - 1;
+				int lit = ((left[index] >> shift) & 0x01) + ((left[index] >> (shift + 1)) & 0x01) +
+					((right[index] >> shift) & 0x01) + ((right[index] >> (shift + 1)) & 0x01);
+				obs[row * OBS_WIDTH + col] = GRAY[lit];
+			}
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Copy every environment's VRAM into one contiguous caller owned array
+ *
+ * [PARAM] out - num_envs * VRAM_BYTES bytes
+*/
+void SiEnv::observationsVRAM(uint8_t* out)
+{
+	for (int env = 0; env < getNumEnvs(); env++) {
+		memcpy(out + (size_t)env * VRAM_BYTES, observation(env), VRAM_BYTES);
+	}
+}
+
+/**
+ * [DESCRIPTION] Return the number of frames since the environment's episode started
+ *
+ * [PARAM] env
+*/
+uint64_t SiEnv::getFrame(int env)
+{
+	return episode_frame[env];
+}
+
+/**
+ * [DESCRIPTION] Check if every board mapped the ROM set, nothing else should be
+ *               called on the SiEnv if this is false
+ *
+*/
+bool SiEnv::isLoaded()
+{
+	return loaded;
+}
+
+/**
+ * [DESCRIPTION] Construct a new SiEnv object, reset() has to be called before
+ *               the first step
+ *
+ * [PARAM] num_envs
+ * [PARAM] frame_skip - frames every action is held for
+ * [PARAM] seed - seed of the random no-op starts
+ * [PARAM] noop_max - most no-op frames after the start (0 for none)
+ * [PARAM] rom_dir - directory holding invaders.e-h
+*/
+SiEnv::SiEnv(int num_envs, int frame_skip, uint64_t seed, int noop_max, const char* rom_dir)
+{
+	loaded = true;
+	for (int env = 0; env < num_envs; env++) {
+		machines.push_back(new SiMachine);
+		loaded = loaded && machines.back()->loadRomFiles(rom_dir);
+	}
+	this->frame_skip = frame_skip > 0 ? frame_skip : 1;
+	this->noop_max = noop_max > 0 ? noop_max : 0;
+	// xorshift can not start from 0
+	rng_state = seed * 0x9E3779B97F4A7C15ull + 1;
+	last_score.assign(num_envs, 0);
+	episode_frame.assign(num_envs, 0);
+}
+
+/**
+ * [DESCRIPTION] Destroy the SiEnv object
+ *
+*/
+SiEnv::~SiEnv()
+{
+	for (SiMachine* machine : machines) {
+		delete machine;
+	}
+}
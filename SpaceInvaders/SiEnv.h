@@ -0,0 +1,68 @@
+/**
+ * [FILE] SiEnv.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains a batched reinforcement learning environment (reset/step/
+ *               observations) around the Space Invaders board
+ * [DATE] 2021-06-09
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class representing a batch of Space Invaders environments
+ *      - Every environment is its own board, each board runs its frames on the
+ *        recompiled ROM (the fastest engine) one after the other
+ *      - An episode starts with a coin and a one player start already done and
+ *        ends when the game goes back to attract mode (game over)
+ *      - Environments that finish during step() are reset straight away, the
+ *        done flag tells the caller the observation is from a new episode
+ *      - observation() is a zero copy view of the board's VRAM, it stays valid
+ *        for the life of the SiEnv (resets keep the memory in place)
+*/
+class SiEnv {
+public:
+    // minimal action set (the same six actions ALE uses for the game)
+    enum Action {
+        ACTION_NOOP,
+        ACTION_FIRE,
+        ACTION_RIGHT,
+        ACTION_LEFT,
+        ACTION_RIGHT_FIRE,
+        ACTION_LEFT_FIRE,
+        NUM_ACTIONS
+    };
+
+    static const int VRAM_BYTES = 256 * 224 / 8;   // 1bpp screen, one 32 byte column per x
+    static const int OBS_WIDTH = 112;              // downscaled grayscale observation (2x2 boxes)
+    static const int OBS_HEIGHT = 128;
+
+    int         getNumEnvs();
+    void        reset();                        // start a new episode on every environment
+    void        reset(int env);                 // start a new episode on one environment
+    void        step(const uint8_t* actions, int32_t* rewards, uint8_t* dones);
+    const uint8_t* observation(int env);        // zero copy view of the env's VRAM
+    void        observations(uint8_t* out);     // num_envs * OBS_HEIGHT * OBS_WIDTH grayscale
+    void        observationsVRAM(uint8_t* out); // num_envs * VRAM_BYTES packed VRAM copies
+    uint64_t    getFrame(int env);              // frames since the env's episode started
+    bool        isLoaded();                     // false if the ROM set could not be loaded
+
+    SiEnv(int num_envs, int frame_skip = 4, uint64_t seed = 0, int noop_max = 30,
+        const char* rom_dir = "SpaceInvaders/rom");
+    SiEnv(const SiEnv&) = delete;               // owns the boards
+    SiEnv& operator=(const SiEnv&) = delete;
+    ~SiEnv();
+
+private:
+    std::vector<SiMachine*> machines;           // one board per environment
+    bool        loaded;                         // true if every board mapped the ROM set
+    int         frame_skip;                     // frames every action is held for
+    int         noop_max;                       // most random no-op frames after the start
+    uint64_t    rng_state;                      // xorshift64 state for the no-op starts
+    std::vector<int>      last_score;           // P1 score after the previous step
+    std::vector<uint64_t> episode_frame;        // frames since the episode started
+
+    uint64_t    nextRandom();
+    void        startGame(int env);             // coin, start and no-op frames after a reset
+};
@@ -0,0 +1,194 @@
+/**
+ * [FILE] SiGolden.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the golden run hash stream
+ * [DATE] 2021-06-20
+*/
+
+#include "SiGolden.h"
+#include <cstring>
+
+/**
+ * [DESCRIPTION] Write a value to the file as little endian bytes
+ *
+ * [PARAM] f
+ * [PARAM] val
+ * [PARAM] num_bytes
+*/
+static void writeLE(FILE* f, uint64_t val, int num_bytes)
+{
+	uint8_t bytes[8];
+	for (int i = 0; i < num_bytes; i++) {
+		bytes[i] = (uint8_t)(val >> (8 * i));
+	}
+	fwrite(bytes, 1, num_bytes, f);
+}
+
+/**
+ * [DESCRIPTION] Read a little endian value from the file
+ *
+ * [PARAM] f
+ * [PARAM] val - set to the value read
+ * [PARAM] num_bytes
+ * [RETURN] false if the file ended early
+*/
+static bool readLE(FILE* f, uint64_t& val, int num_bytes)
+{
+	uint8_t bytes[8];
+	if (fread(bytes, 1, num_bytes, f) != (size_t)num_bytes) {
+		return false;
+	}
+	val = 0;
+	for (int i = 0; i < num_bytes; i++) {
+		val |= (uint64_t)bytes[i] << (8 * i);
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Create the hash stream, frames are appended as they are run
+ *
+ * [PARAM] p_path
+ * [RETURN] false if the file could not be created
+*/
+bool SiGolden::openWrite(const char* p_path)
+{
+#pragma warning(disable:4996)
+	file = fopen(p_path, "wb");
+	if (file == NULL) {
+		printf("ERROR OPENING %s\n", p_path);
+		return false;
+	}
+	path = p_path;
+	fwrite("SIGH", 1, 4, file);
+	writeLE(file, VERSION, 4);
+	writeLE(file, SiMachine::INTERRUPT_INTERVAL, 4);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Load the golden stream the run is checked against
+ *
+ * [PARAM] p_path
+ * [RETURN] false if it is not a hash stream of this version and frame length
+*/
+bool SiGolden::openCheck(const char* p_path)
+{
+#pragma warning(disable:4996)
+	FILE* f = fopen(p_path, "rb");
+	if (f == NULL) {
+		printf("ERROR OPENING %s\n", p_path);
+		return false;
+	}
+	path = p_path;
+
+	char magic[4];
+	uint64_t version = 0;
+	uint64_t cycles = 0;
+	bool read_ok = fread(magic, 1, 4, f) == 4 && memcmp(magic, "SIGH", 4) == 0;
+	read_ok = read_ok && readLE(f, version, 4) && version == VERSION;
+	read_ok = read_ok && readLE(f, cycles, 4) && cycles == (uint64_t)SiMachine::INTERRUPT_INTERVAL;
+	FrameHash hash;
+	while (read_ok && readLE(f, hash.frame, 8)) {
+		read_ok = readLE(f, hash.state, 8);
+		golden.push_back(hash);
+	}
+	fclose(f);
+
+	if (!read_ok) {
+		printf("ERROR READING GOLDEN HASHES %s\n", p_path);
+		golden.clear();
+		return false;
+	}
+	checking = true;
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Hash the frame that was just run and write it out or compare
+ *               it with the golden one
+ *
+ * [PARAM] machine
+ * [RETURN] false once a frame did not match (the run can stop there)
+*/
+bool SiGolden::addFrame(SiMachine& machine)
+{
+	FrameHash hash = { machine.hashFrame(), machine.hashState() };
+	uint64_t frame = frames++;
+	if (!checking) {
+		if (file != NULL) {
+			writeLE(file, hash.frame, 8);
+			writeLE(file, hash.state, 8);
+		}
+		return true;
+	}
+
+	if (frame >= golden.size()) {
+		printf("golden: the run is longer than %s (%zu frames)\n", path, golden.size());
+		mismatched = true;
+		return false;
+	}
+	if (hash.frame != golden[frame].frame || hash.state != golden[frame].state) {
+		printf("golden: frame %llu (cycle %llu) differs from %s:\n", (unsigned long long)frame,
+			(unsigned long long)machine.cpu->clock->getCurrentCCs(), path);
+		printf("  screen %016llx, golden %016llx%s\n", (unsigned long long)hash.frame,
+			(unsigned long long)golden[frame].frame, hash.frame != golden[frame].frame ? " <-" : "");
+		printf("  state  %016llx, golden %016llx%s\n", (unsigned long long)hash.state,
+			(unsigned long long)golden[frame].state, hash.state != golden[frame].state ? " <-" : "");
+		mismatched = true;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Close the stream or report the check
+ *
+ * [RETURN] false if the check failed (a mismatch or a shorter run)
+*/
+bool SiGolden::finish()
+{
+	if (file != NULL) {
+		fclose(file);
+		file = NULL;
+		printf("golden: %llu frame hashes written to %s\n", (unsigned long long)frames, path);
+		return true;
+	}
+	if (!checking) {
+		return true;
+	}
+	if (!mismatched && frames < golden.size()) {
+		printf("golden: the run ended after %llu of the %zu frames in %s\n", (unsigned long long)frames,
+			golden.size(), path);
+		mismatched = true;
+	}
+	if (!mismatched) {
+		printf("golden: all %llu frames match %s\n", (unsigned long long)frames, path);
+	}
+	checking = false;
+	return !mismatched;
+}
+
+/**
+ * [DESCRIPTION] Construct a new SiGolden object (neither writing nor checking)
+ *
+*/
+SiGolden::SiGolden()
+{
+	file = NULL;
+	path = NULL;
+	checking = false;
+	frames = 0;
+	mismatched = false;
+}
+
+/**
+ * [DESCRIPTION] Destroy the SiGolden object, closing a stream being written
+ *
+*/
+SiGolden::~SiGolden()
+{
+	if (file != NULL) {
+		fclose(file);
+	}
+}
@@ -0,0 +1,47 @@
+/**
+ * [FILE] SiGolden.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the per frame hash stream of a headless run and the check
+ *               of a run against a stored (golden) one
+ *      FILE LAYOUT (little endian):
+ *          "SIGH" | uint32 version | uint32 cycles per frame |
+ *          one record per frame: uint64 screen hash | uint64 state hash
+ * [DATE] 2021-06-20
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include <cstdio>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class writing or checking the hashes of every emulated frame
+ *      - The screen is hashed with hashFrame and the whole machine with
+ *        hashState, both XXH64, 16 bytes a frame (1.6 MB for 100,000 frames)
+ *      - A check stops at the first frame either hash differs on and names
+ *        it, the state usually gives a bug away frames before the screen
+*/
+class SiGolden {
+public:
+    static const uint32_t VERSION = 2;          // 2: the state hash covers the interrupt latch
+
+    bool        openWrite(const char* path);        // start writing a hash stream
+    bool        openCheck(const char* path);        // load a golden stream to check against
+    bool        addFrame(SiMachine& machine);       // write/check a frame, false on the first mismatch
+    bool        finish();                           // report, false if the check failed
+    SiGolden();
+    ~SiGolden();
+private:
+    // the two hashes of a frame
+    struct FrameHash {
+        uint64_t    frame;
+        uint64_t    state;
+    };
+
+    FILE*       file;                   // stream being written (NULL when checking)
+    const char* path;
+    std::vector<FrameHash> golden;      // hashes being checked against
+    bool        checking;
+    uint64_t    frames;                 // frames written/checked so far
+    bool        mismatched;
+};
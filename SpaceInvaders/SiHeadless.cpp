@@ -0,0 +1,111 @@
+/**
+ * [FILE] SiHeadless.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the headless runner
+ * [DATE] 2021-06-04
+*/
+
+#include "SiHeadless.h"
+#include "SiGolden.h"
+#include "SiVideo.h"
+#include "../Emulator/HostTimer.h"
+#include "../Emulator/MetricsExport.h"
+#include <chrono>
+
+/**
+ * [DESCRIPTION] Replay the movie from the options through a fresh board and
+ *               report the final state
+ *      - A watchpoint stop ends the replay early, the report is the state at
+ *        the stop and the frames are the ones run up to it
+ *
+ * [PARAM] options
+ * [RETURN] int (0 on success, 1 if the replay could not run, was stopped or
+ *          failed the golden check)
+*/
+int SiHeadless::run(const EmulatorOptions& options)
+{
+	SiMovie movie;
+	if (!movie.load(options.replay_path)) {
+		return 1;
+	}
+
+	SiMachine machine(*SiBoard::find(options.board));
+	if (!machine.loadRomFiles()) {
+		return 1;
+	}
+	machine.playMovie(&movie);
+	machine.use_recompiled = machine.use_recompiled && !options.interpreter;
+	machine.setTracing(options.trace);
+	machine.setProfiling(options.profile);
+	for (const EmulatorOptions::Watch& watch : options.watches) {
+		machine.addWatchpoint({ watch.first, watch.last, watch.kinds, watch.value });
+	}
+
+	MetricsExport metrics;
+	if (options.metrics && (!metrics.create() ||
+		(options.metrics_socket != nullptr && !metrics.serve(options.metrics_socket)))) {
+		return 1;
+	}
+	SiVideo::Recorder video;
+	if (options.record_video != nullptr && !video.open(options.record_video)) {
+		return 1;
+	}
+	machine.capture_sound = options.record_video != nullptr;
+	SiGolden golden;
+	if ((options.hash_out != nullptr && !golden.openWrite(options.hash_out)) ||
+		(options.hash_check != nullptr && !golden.openCheck(options.hash_check))) {
+		return 1;
+	}
+	bool hashing = options.hash_out != nullptr || options.hash_check != nullptr;
+
+	auto start = std::chrono::steady_clock::now();
+	bool finished = true;
+	bool matched = true;
+	if (options.metrics || options.record_video != nullptr || hashing) {
+		// a frame at a time so the published counters move while it runs,
+		// every frame is recorded (waiting for the encoder, nothing is dropped)
+		// and hashed, a check stops at the first frame that differs (the
+		// frame a watchpoint stopped in is not complete, it is not hashed)
+		while (finished && matched && machine.cpu->clock->getCurrentCCs() < movie.getEndCycle()) {
+			uint64_t frame_micro = HostTimer::nowMicro();
+			uint64_t goal = machine.cpu->clock->getCurrentCCs() + SiMachine::INTERRUPT_INTERVAL;
+			finished = machine.runUntil(goal < movie.getEndCycle() ? goal : movie.getEndCycle());
+			metrics.publishFrame({ machine.cpu->clock->getCurrentCCs(), machine.opcodes_run, machine.interrupts_run, 0 },
+				HostTimer::nowMicro() - frame_micro);
+			if (options.record_video != nullptr) {
+				video.addFrame(machine, true);
+				machine.sound_writes.clear();
+			}
+			if (hashing && finished) {
+				matched = golden.addFrame(machine);
+			}
+		}
+	}
+	else {
+		finished = machine.runUntil(movie.getEndCycle());
+	}
+	auto stop = std::chrono::steady_clock::now();
+
+	double seconds = std::chrono::duration<double>(stop - start).count();
+	uint64_t frames = movie.getEndCycle() / SiMachine::INTERRUPT_INTERVAL;
+	printf("cycles: %llu\n", (unsigned long long)machine.cpu->clock->getCurrentCCs());
+	if (finished) {
+		printf("frames: %llu\n", (unsigned long long)frames);
+	}
+	else {
+		printf("frames: %llu of %llu\n", (unsigned long long)(machine.stop.cycle / SiMachine::INTERRUPT_INTERVAL),
+			(unsigned long long)frames);
+	}
+	printf("events: %llu\n", (unsigned long long)movie.getEventCount());
+	printf("vram:   %016llx\n", (unsigned long long)machine.hashVRAM());
+	printf("score:  %04d\n", machine.readScore(SiMachine::RAM_P1_SCORE));
+	printf("time:   %.3f s\n", seconds);
+	if (!finished) {
+		printf("stop:   %s\n", machine.describeStop().c_str());
+	}
+	if (options.profile) {
+		printf("\n%s", machine.describeProfile(20).c_str());
+	}
+	bool golden_passed = !hashing || golden.finish();
+	return finished && golden_passed ? 0 : 1;
+}
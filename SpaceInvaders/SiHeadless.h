@@ -0,0 +1,20 @@
+/**
+ * [FILE] SiHeadless.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains an object that runs the Space Invaders board without a
+ *               window, as fast as the host allows
+ * [DATE] 2021-06-04
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include "../Emulator/EmulatorOptions.h"
+
+/**
+ * [DESCRIPTION] Class which runs a recorded movie through the board with no SDL
+ *
+*/
+class SiHeadless {
+public:
+    static int run(const EmulatorOptions& options);     // run the replay, returns the exit code
+};
@@ -0,0 +1,153 @@
+/**
+ * [FILE] SiLatency.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the input latency measurement of the game window
+ * [DATE] 2021-06-16
+*/
+
+#include "SiLatency.h"
+#include "../Emulator/HostTimer.h"
+#include <algorithm>
+#include <cstdio>
+
+/**
+ * [DESCRIPTION] Start measuring an input, the front end calls it once it wrote
+ *               new values to the input ports (ignored while one is in flight)
+ *
+ * [PARAM] machine
+ * [PARAM] p_event_micro - host time of the first event that changed the ports
+ *                         (0 if there was none, a joystick let go of)
+*/
+void SiLatency::inputChanged(SiMachine& machine, uint64_t p_event_micro)
+{
+	if (pending) {
+		return;
+	}
+	uint64_t now = HostTimer::nowMicro();
+	event_micro = (p_event_micro != 0 && p_event_micro < now) ? p_event_micro : now;
+	samples[STAGE_POLL].push_back((uint32_t)(now - event_micro));
+	vram_micro = 0;
+	change_cc = machine.cpu->clock->getCurrentCCs();
+	read_cc = UINT64_MAX;
+	vram_cc = UINT64_MAX;
+	pending = true;
+	machine.clearInputRead();
+	machine.probeVRAMWrite(true);
+}
+
+/**
+ * [DESCRIPTION] Pick up the input read and VRAM write the board found while it
+ *               ran, an input that is not shown within TIMEOUT_CYCLES is given up
+ *
+ * [PARAM] machine
+*/
+void SiLatency::update(SiMachine& machine)
+{
+	if (!pending) {
+		return;
+	}
+	if (read_cc == UINT64_MAX && machine.getInputRead() != UINT64_MAX) {
+		read_cc = machine.getInputRead();
+	}
+	if (vram_cc == UINT64_MAX && machine.getVRAMWrite() != UINT64_MAX) {
+		vram_cc = machine.getVRAMWrite();
+		vram_micro = HostTimer::nowMicro();
+	}
+	if (vram_cc == UINT64_MAX && machine.cpu->clock->getCurrentCCs() - change_cc > TIMEOUT_CYCLES) {
+		samples[STAGE_POLL].pop_back();
+		machine.probeVRAMWrite(false);
+		abandoned++;
+		pending = false;
+	}
+}
+
+/**
+ * [DESCRIPTION] Finish the input in flight if the frame that was just presented
+ *               has its VRAM write in it
+ *
+*/
+void SiLatency::framePresented()
+{
+	if (!pending || vram_cc == UINT64_MAX) {
+		return;
+	}
+	uint64_t now = HostTimer::nowMicro();
+	samples[STAGE_READ].push_back(cyclesToMicro(read_cc - change_cc));
+	samples[STAGE_VRAM].push_back(cyclesToMicro(vram_cc - read_cc));
+	samples[STAGE_PRESENT].push_back((uint32_t)(now - vram_micro));
+	samples[STAGE_TOTAL].push_back((uint32_t)(now - event_micro));
+	pending = false;
+}
+
+/**
+ * [DESCRIPTION] Print a histogram of every stage (inputs per bucket) with the
+ *               median and 99th percentile
+ *
+*/
+void SiLatency::print()
+{
+	static const char* const NAMES[NUM_STAGES] = {
+		"event -> port", "port -> read", "read -> VRAM", "VRAM -> present", "event -> present"
+	};
+
+	printf("input latency, %zu inputs (%d not shown within a second)\n", samples[STAGE_TOTAL].size(), abandoned);
+	printf("  %-18s %6s %6s %6s %6s %6s %6s %6s %6s %6s %8s %8s\n", "stage (ms)",
+		"<0.5", "<1", "<2", "<4", "<8", "<16", "<32", "<64", ">=64", "p50", "p99");
+	for (int stage = 0; stage < NUM_STAGES; stage++) {
+		int buckets[NUM_BUCKETS] = { 0 };
+		for (uint32_t micro : samples[stage]) {
+			int bucket = 0;
+			for (uint32_t limit = 500; micro >= limit && bucket < NUM_BUCKETS - 1; limit *= 2) {
+				bucket++;
+			}
+			buckets[bucket]++;
+		}
+		printf("  %-18s", NAMES[stage]);
+		for (int bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+			printf(" %6d", buckets[bucket]);
+		}
+		printf(" %8.2f %8.2f\n", percentile(samples[stage], 50) / 1000.0, percentile(samples[stage], 99) / 1000.0);
+	}
+}
+
+/**
+ * [DESCRIPTION] Convert emulated clock cycles to micro seconds of emulated time
+ *
+ * [PARAM] cycles
+ * [RETURN] uint32_t
+*/
+uint32_t SiLatency::cyclesToMicro(uint64_t cycles)
+{
+	return (uint32_t)(cycles / (i8080::i8080_Clock::CYCLES_PER_SECOND / 1000000));
+}
+
+/**
+ * [DESCRIPTION] Return a percentile of a stage's samples (sorts them)
+ *
+ * [PARAM] stage
+ * [PARAM] percent
+ * [RETURN] uint32_t (0 if there are no samples)
+*/
+uint32_t SiLatency::percentile(std::vector<uint32_t>& stage, int percent)
+{
+	if (stage.empty()) {
+		return 0;
+	}
+	std::sort(stage.begin(), stage.end());
+	return stage[(stage.size() - 1) * percent / 100];
+}
+
+/**
+ * [DESCRIPTION] Construct a new SiLatency object
+ *
+*/
+SiLatency::SiLatency()
+{
+	pending = false;
+	event_micro = 0;
+	vram_micro = 0;
+	change_cc = 0;
+	read_cc = UINT64_MAX;
+	vram_cc = UINT64_MAX;
+	abandoned = 0;
+}
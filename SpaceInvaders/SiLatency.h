@@ -0,0 +1,53 @@
+/**
+ * [FILE] SiLatency.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the input latency measurement of the game window, from the
+ *               host input event to the frame that shows its effect
+ * [DATE] 2021-06-16
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class measuring the latency chain of the player's input
+ *      - event -> port: the host event's timestamp to the input port write
+ *        (host time, waiting to be polled)
+ *      - port -> read: the port write to the first IN of the input ports
+ *        (emulated time, the game reads them once or twice a frame)
+ *      - read -> VRAM: that IN to the first VRAM write after it (emulated
+ *        time, the first write the input could have changed)
+ *      - VRAM -> present: the frame with that write being run to the
+ *        SDL_RenderPresent it was shown by returning (host time)
+ *      - The whole chain is measured in host time as event -> present
+ *      - One input is measured at a time, a change while one is in flight is
+ *        only applied
+*/
+class SiLatency {
+public:
+    static const uint64_t TIMEOUT_CYCLES = 60 * SiMachine::INTERRUPT_INTERVAL;    // give an input up after a second
+
+    void        inputChanged(SiMachine& machine, uint64_t event_micro);   // the ports were written from host events
+    void        update(SiMachine& machine);     // after the board ran
+    void        framePresented();               // after SDL_RenderPresent returned
+    void        print();                        // histograms of every stage
+    SiLatency();
+
+private:
+    // the stages of the chain, in the order they happen
+    enum Stage { STAGE_POLL, STAGE_READ, STAGE_VRAM, STAGE_PRESENT, STAGE_TOTAL, NUM_STAGES };
+    static const int NUM_BUCKETS = 9;           // <0.5 ms, doubling, the last one is open
+
+    std::vector<uint32_t> samples[NUM_STAGES];  // micro seconds
+    bool        pending;                        // an input is being measured
+    uint64_t    event_micro;                    // host time of the input event
+    uint64_t    vram_micro;                     // host time the VRAM write was run (0 until then)
+    uint64_t    change_cc;                      // clock cycle the ports were written on
+    uint64_t    read_cc;                        // first input read after it (UINT64_MAX until then)
+    uint64_t    vram_cc;                        // first VRAM write after that (UINT64_MAX until then)
+    int         abandoned;                      // inputs the game did not read or show in time
+
+    static uint32_t cyclesToMicro(uint64_t cycles);
+    static uint32_t percentile(std::vector<uint32_t>& stage, int percent);
+};
@@ -0,0 +1,860 @@
+/**
+ * [FILE] SiMachine.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the Space Invaders board
+ * [DATE] 2021-06-04
+*/
+
+#include "SiMachine.h"
+#include "SiRecompiled.h"
+#include "../Emulator/XxHash.h"
+#include "../i8080/i8080_OpSpec.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+/**
+ * [DESCRIPTION] Map the game ROM into memory from the board's ROM set manifest
+ *               in the passed directory (invaders.romset for Space Invaders),
+ *               every board in the process reads the same read only copy
+ * 
+ * [PARAM] rom_dir - directory holding the manifest and the ROM files
+ * [RETURN] false if the manifest or a ROM file is missing, does not match or
+ *          does not fit the board's ROM map
+*/
+bool SiMachine::loadRomFiles(const char* rom_dir)
+{
+	return loadRomSet(RomSet::open(std::string(rom_dir) + "/" + board.romset));
+}
+
+/**
+ * [DESCRIPTION] Map an opened ROM set into memory (the front end takes it from
+ *               its asset cache, which opened it at startup)
+ *
+ * [PARAM] loaded - NULL if the set could not be opened
+ * [RETURN] false if there is no set or it does not fit the board's ROM map
+*/
+bool SiMachine::loadRomSet(std::shared_ptr<const RomSet> loaded)
+{
+	if (!loaded) {
+		return false;
+	}
+	for (const RomSet::RomFile& file : loaded->getFiles()) {
+		if (!board.isRom(file.address) || !board.isRom((uint16_t)(file.address + file.size - 1))) {
+			printf("ROM %s AT 0x%04X IS OUTSIDE THE %s ROM MAP\n", file.name.c_str(), file.address, board.name);
+			return false;
+		}
+	}
+	rom_set = loaded;
+	for (const RomSet::RomFile& file : rom_set->getFiles()) {
+		cpu->memory->mapRom(file.address, file.data, file.size);
+	}
+	use_recompiled = SiRecompiled::matches(cpu->memory);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Power the board back on, the ROM stays loaded and the cpu and
+ *               memory keep their addresses (so VRAM pointers stay valid)
+ *
+*/
+void SiMachine::reset()
+{
+	cpu->reset();
+	// writing to ROM would give the board its own copy
+	for (uint32_t address = 0; address <= 0xFFFF; address++) {
+		if (!board.isRom((uint16_t)address)) {
+			cpu->memory->set((uint16_t)address, 0);
+		}
+	}
+	shift_register.set(0);
+	next_interrupt_cc = board.interrupt_interval;
+	next_interrupt_to_send = board.interrupts[0];
+	next_service_cc = UINT64_MAX;
+	movie = NULL;
+	next_movie_cc = UINT64_MAX;
+	sound_writes.clear();
+	cpu->memory->clearWatchpoints();
+	watching = false;
+	resuming = false;
+	input_read_cc = UINT64_MAX;
+	probing_vram = false;
+	vram_write_cc = UINT64_MAX;
+	updateNextEvent();
+}
+
+// RUN LOOP =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+/**
+ * [DESCRIPTION] Run a single opcode the way the policy asks for, the features a
+ *               policy turns off are not in its instantiation at all
+ *      - Execute and read watchpoints stop before the opcode runs, the next
+ *        call runs it without checking it again
+ *      - Write watchpoints stop after the opcode that wrote
+ *      - The input probe looks at the bytes the opcode writes before it runs
+ *        and stamps the VRAM write with the cycle the opcode finished on
+ *      - A halted cpu fetches nothing, the clock runs on to the next event
+ *        (the only way out of HLT is an interrupt)
+ *
+ * [RETURN] false if a watchpoint stopped the board (see stop)
+*/
+template <class Policy>
+bool SiMachine::runOpcode()
+{
+	// INTERRUPT/MOVIE INPUT =-=-=-=-=--=-=-=-=-=-=-=-=-=-
+	if (cpu->clock->getCurrentCCs() >= next_event_cc) {
+		deliverEvents();
+	}
+
+	// HALTED =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	if (cpu->flags->halted) {
+		uint64_t now = cpu->clock->getCurrentCCs();
+		if (next_event_cc != UINT64_MAX && next_event_cc > now) {
+			cpu->clock->setCurrentCCs(next_event_cc);
+		}
+		return true;
+	}
+
+	// CPU STEP =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	// step the cpu to the next cycle
+	cpu->step();
+	if (Policy::TRACE && tracing) {
+		trace.writeOpcode(cpu->memory->opCode_Array.data(), cpu->registers->PC.get(), cpu->clock->getCurrentCCs(),
+			cpu->registers->SP.get(), cpu->registers->A.get(), cpu->registers->B.get(), cpu->registers->C.get(),
+			cpu->registers->D.get(), cpu->registers->E.get(), cpu->registers->H.get(), cpu->registers->L.get(),
+			cpu->flags->Z.get(), cpu->flags->S.get(), cpu->flags->P.get(), cpu->flags->C.get(), cpu->flags->AC.get());
+	}
+
+	// WATCHPOINTS (BEFORE) =-=-=-=-=--=-=-=-=-=-=-=-=-=-=
+	uint16_t pc = cpu->registers->PC.get();
+	if (Policy::WATCH && !resuming) {
+		i8080::i8080_Memory* memory = cpu->memory;
+		if (memory->isWatched(pc, i8080::i8080_Memory::WATCH_EXECUTE)) {
+			memory->checkWatch(i8080::i8080_Memory::WATCH_EXECUTE, pc, memory->opCode_Array[0]);
+		}
+		uint16_t reads[2];
+		int num_reads = cpu->getDataReads(reads);
+		for (int i = 0; i < num_reads; i++) {
+			if (memory->isWatched(reads[i], i8080::i8080_Memory::WATCH_READ)) {
+				memory->checkWatch(i8080::i8080_Memory::WATCH_READ, reads[i], memory->get(reads[i]));
+			}
+		}
+		if (memory->takeWatchHit(stop.hit)) {
+			stop.pc = pc;
+			stop.cycle = cpu->clock->getCurrentCCs();
+			resuming = true;
+			return false;
+		}
+	}
+	if (Policy::WATCH) {
+		resuming = false;
+	}
+
+	// INPUT PROBE =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	// the first VRAM write after the game read the input ports
+	bool vram_written = false;
+	if (Policy::PROBE && probing_vram && input_read_cc != UINT64_MAX) {
+		uint16_t writes[2];
+		int num_writes = cpu->getDataWrites(writes);
+		for (int i = 0; i < num_writes; i++) {
+			vram_written |= (uint16_t)(writes[i] - board.vram) < board.getVRAMBytes();
+		}
+	}
+
+	// EXE CPU =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	// execute the opcode
+	uint64_t start_cc = Policy::PROFILE ? cpu->clock->getCurrentCCs() : 0;
+	cpu->execute->runOpCode();
+	opcodes_run++;
+	if (Policy::PROFILE && profiling) {
+		profile_runs[cpu->memory->opCode_Array[0]]++;
+		profile_cycles[cpu->memory->opCode_Array[0]] += cpu->clock->getCurrentCCs() - start_cc;
+	}
+
+	// IN/OUT/EI CHECK =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=
+	// check for shift condition, sound port writes, input port reads and
+	// an EI letting a latched interrupt in
+	switch (cpu->memory->opCode_Array[0]) {
+	case 0xD3:
+		portWritten(cpu->memory->opCode_Array[1], cpu->clock->getCurrentCCs());
+		break;
+	case 0xDB:
+		portRead(cpu->memory->opCode_Array[1], cpu->clock->getCurrentCCs());
+		break;
+	case 0xFB:
+		interruptsEnabled();
+		break;
+	default:
+		break;
+	}
+	if (Policy::PROBE && vram_written) {
+		vram_write_cc = cpu->clock->getCurrentCCs();
+		probing_vram = false;
+	}
+
+	// WATCHPOINTS (AFTER) =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-
+	if (Policy::WATCH && cpu->memory->takeWatchHit(stop.hit)) {
+		stop.pc = pc;
+		stop.cycle = cpu->clock->getCurrentCCs();
+		return false;
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Execute opcodes until the goal the way the policy asks for
+ *
+ * [PARAM] goal_clock_cycles
+ * [RETURN] false if a watchpoint stopped the board first (see stop)
+*/
+template <class Policy>
+bool SiMachine::runLoop(uint64_t goal_clock_cycles)
+{
+	while (cpu->clock->getCurrentCCs() < goal_clock_cycles) {
+		// RECOMPILED =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+		// run the native blocks up to the next event, the interpreter takes
+		// over where there is no block (or the next one would cross it)
+		if (Policy::RECOMPILED && use_recompiled && !cpu->flags->halted && cpu->clock->getCurrentCCs() < next_event_cc) {
+			uint64_t limit = goal_clock_cycles < next_event_cc ? goal_clock_cycles : next_event_cc;
+			use_recompiled = SiRecompiled::run(*this, limit);
+			if (cpu->clock->getCurrentCCs() >= goal_clock_cycles) {
+				break;
+			}
+		}
+		if (!runOpcode<Policy>()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Execute opcodes until the desired number of ccs has been reached,
+ *               on the fastest variant that has every feature the board needs
+ * 
+ * [PARAM] goal_clock_cycles
+ * [RETURN] false if a watchpoint stopped the board first (see stop)
+*/
+bool SiMachine::runUntil(uint64_t goal_clock_cycles)
+{
+	if (watching || tracing || profiling || probing_vram) {
+		return runLoop<DebugPolicy>(goal_clock_cycles);
+	}
+	if (use_recompiled) {
+		return runLoop<CabinetPolicy>(goal_clock_cycles);
+	}
+	return runLoop<InterpreterPolicy>(goal_clock_cycles);
+}
+
+/**
+ * [DESCRIPTION] Run a single opcode (and any due event) on the interpreter
+ *
+ * [RETURN] false if a watchpoint stopped the board (see stop)
+*/
+bool SiMachine::runInstruction()
+{
+	if (watching || tracing || profiling || probing_vram) {
+		return runOpcode<DebugPolicy>();
+	}
+	return runOpcode<InterpreterPolicy>();
+}
+
+/**
+ * [DESCRIPTION] Deliver the interrupt/movie input that is due on the current
+ *               cycle and work out when the next event is
+ *      - The board raises INT on its own schedule, the cpu latches the
+ *        request and takes it here once INTE lets it in, a request that
+ *        waits for an EI is not looked at until interruptsEnabled
+ *
+*/
+void SiMachine::deliverEvents()
+{
+	// INTERRUPT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	// raise the board's interrupt when it is due
+	if (cpu->clock->getCurrentCCs() >= next_interrupt_cc) {
+		cpu->requestInterrupt((uint8_t)next_interrupt_to_send);
+		next_interrupt_to_send = next_interrupt_to_send == board.interrupts[0] ? board.interrupts[1] : board.interrupts[0];
+		next_interrupt_cc += board.interrupt_interval;
+	}
+
+	// let the latched request in, only the EI delay can hold it back while
+	// INTE is set and that is over after the next opcode
+	next_service_cc = UINT64_MAX;
+	if (cpu->serviceInterrupt()) {
+		interrupts_run++;
+	}
+	else if (cpu->interrupt_pending && cpu->flags->INTE.get()) {
+		next_service_cc = cpu->clock->getCurrentCCs() + 1;
+	}
+
+	// MOVIE INPUT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	// apply recorded input on the exact cycle it was recorded on
+	if (cpu->clock->getCurrentCCs() >= next_movie_cc) {
+		applyMovieInput();
+	}
+	updateNextEvent();
+}
+
+/**
+ * [DESCRIPTION] An EI ran on the interpreter (the recompiled blocks leave EI
+ *               to it), a latched request is looked at on the next opcode
+ *               boundary, which holds it back one more opcode
+ *
+*/
+void SiMachine::interruptsEnabled()
+{
+	if (cpu->interrupt_pending) {
+		next_service_cc = cpu->clock->getCurrentCCs();
+		updateNextEvent();
+	}
+}
+
+/**
+ * [DESCRIPTION] Emulate the board side of an OUT, called by the interpreter and
+ *               by the recompiled blocks
+ *
+ * [PARAM] port
+ * [PARAM] cycle - clock cycle the OUT finished on
+*/
+void SiMachine::portWritten(uint8_t port, uint64_t cycle)
+{
+	if (port == board.shift_data_port) {
+		performShift();
+	}
+	else if (capture_sound && (port == board.sound_ports[0] || port == board.sound_ports[1])) {
+		sound_writes.push_back({ cycle, port, cpu->io->output.get_port(port)->port_val.byte_val });
+	}
+}
+
+/**
+ * [DESCRIPTION] Emulate the board side of an IN, called by the interpreter and
+ *               by the recompiled blocks, only the first read of the input
+ *               ports since clearInputRead is kept
+ *
+ * [PARAM] port
+ * [PARAM] cycle - clock cycle the IN finished on
+*/
+void SiMachine::portRead(uint8_t port, uint64_t cycle)
+{
+	if (input_read_cc == UINT64_MAX && (port == board.input_ports[0] || port == board.input_ports[1])) {
+		input_read_cc = cycle;
+	}
+}
+
+/**
+ * [DESCRIPTION] Forget the last input port read, the front end calls it when
+ *               it writes new values to the input ports
+ *
+*/
+void SiMachine::clearInputRead()
+{
+	input_read_cc = UINT64_MAX;
+}
+
+/**
+ * [DESCRIPTION] Return the cycle of the first input port read since
+ *               clearInputRead
+ *
+ * [RETURN] uint64_t (UINT64_MAX if the game has not read them yet)
+*/
+uint64_t SiMachine::getInputRead()
+{
+	return input_read_cc;
+}
+
+/**
+ * [DESCRIPTION] Look for the first VRAM write after the next input port read,
+ *               the board runs on the debug variant until it is found (or the
+ *               probe is turned off)
+ *
+ * [PARAM] p_probing
+*/
+void SiMachine::probeVRAMWrite(bool p_probing)
+{
+	probing_vram = p_probing;
+	vram_write_cc = UINT64_MAX;
+}
+
+/**
+ * [DESCRIPTION] Return the cycle of the VRAM write probeVRAMWrite found
+ *
+ * [RETURN] uint64_t (UINT64_MAX until it is found)
+*/
+uint64_t SiMachine::getVRAMWrite()
+{
+	return vram_write_cc;
+}
+
+/**
+ * [DESCRIPTION] Recompute the cycle the next interrupt or movie event is due on
+ *
+*/
+void SiMachine::updateNextEvent()
+{
+	next_event_cc = next_interrupt_cc < next_movie_cc ? next_interrupt_cc : next_movie_cc;
+	next_event_cc = next_service_cc < next_event_cc ? next_service_cc : next_event_cc;
+}
+
+/**
+ * [DESCRIPTION] Return the clock cycle the next interrupt or movie event is due
+ *               on, opcodes before it only depend on the cpu state
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiMachine::nextEventCycle()
+{
+	return next_event_cc;
+}
+
+/**
+ * [DESCRIPTION] Run the passed number of frames (one interrupt interval each)
+ *
+ * [PARAM] num_frames
+ * [RETURN] false if a watchpoint stopped the board first (see stop)
+*/
+bool SiMachine::runFrames(uint64_t num_frames)
+{
+	uint64_t frame_start = cpu->clock->getCurrentCCs() - (cpu->clock->getCurrentCCs() % INTERRUPT_INTERVAL);
+	return runUntil(frame_start + num_frames * INTERRUPT_INTERVAL);
+}
+
+/**
+ * [DESCRIPTION] Arm a watchpoint, from now on the board runs on the debug
+ *               variant (a board without watchpoints never pays for them)
+ *
+ * [PARAM] watchpoint
+*/
+void SiMachine::addWatchpoint(const i8080::i8080_Memory::Watchpoint& watchpoint)
+{
+	cpu->memory->addWatchpoint(watchpoint);
+	watching = true;
+}
+
+/**
+ * [DESCRIPTION] Log every opcode run (and the cpu state before it) to the
+ *               TestWriter file, the board runs on the debug variant meanwhile
+ *
+ * [PARAM] p_tracing
+*/
+void SiMachine::setTracing(bool p_tracing)
+{
+	tracing = p_tracing;
+}
+
+/**
+ * [DESCRIPTION] Count every opcode run and the cycles it took (the counts
+ *               start over), the board runs on the debug variant meanwhile
+ *
+ * [PARAM] p_profiling
+*/
+void SiMachine::setProfiling(bool p_profiling)
+{
+	profiling = p_profiling;
+	profile_runs.assign(256, 0);
+	profile_cycles.assign(256, 0);
+}
+
+/**
+ * [DESCRIPTION] Describe the profile by instruction (the opcodes of a row of
+ *               the instruction set table are added up: MOV, ADD, Jcc...)
+ *
+ * [PARAM] num_rows - most cycles first
+ * [RETURN] std::string
+*/
+std::string SiMachine::describeProfile(int num_rows)
+{
+	struct Row {
+		std::string mnemonic;
+		uint64_t    runs;
+		uint64_t    cycles;
+	};
+	std::vector<Row> rows;
+	uint64_t total_cycles = 0;
+	for (int op = 0; op < (int)profile_runs.size(); op++) {
+		if (profile_runs[op] == 0) {
+			continue;
+		}
+		std::string mnemonic = i8080_OpSpec::find((uint8_t)op).mnemonic;
+		if (mnemonic.size() == 2 && mnemonic[1] == '*') {
+			mnemonic = mnemonic.substr(0, 1) + "cc";
+		}
+		size_t i = 0;
+		while (i < rows.size() && rows[i].mnemonic != mnemonic) {
+			i++;
+		}
+		if (i == rows.size()) {
+			rows.push_back({ mnemonic, 0, 0 });
+		}
+		rows[i].runs += profile_runs[op];
+		rows[i].cycles += profile_cycles[op];
+		total_cycles += profile_cycles[op];
+	}
+	std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.cycles > b.cycles; });
+
+	std::string text = "instruction        runs        cycles  share\n";
+	char line[96];
+	for (int i = 0; i < (int)rows.size() && i < num_rows; i++) {
+		snprintf(line, sizeof(line), "%-8s %14llu %13llu %5.1f%%\n", rows[i].mnemonic.c_str(),
+			(unsigned long long)rows[i].runs, (unsigned long long)rows[i].cycles,
+			total_cycles == 0 ? 0.0 : 100.0 * rows[i].cycles / total_cycles);
+		text += line;
+	}
+	return text;
+}
+
+/**
+ * [DESCRIPTION] Copy everything the board can change into the passed state, a
+ *               state that is reused does not allocate again
+ *
+ * [PARAM] state
+*/
+void SiMachine::saveState(State& state)
+{
+	state.registers = *cpu->registers;
+	state.flags[0] = cpu->flags->S.get();
+	state.flags[1] = cpu->flags->Z.get();
+	state.flags[2] = cpu->flags->AC.get();
+	state.flags[3] = cpu->flags->P.get();
+	state.flags[4] = cpu->flags->C.get();
+	state.flags[5] = cpu->flags->INTE.get();
+	state.io = *cpu->io;
+	state.cycles = cpu->clock->getCurrentCCs();
+	state.shift_register = shift_register.get();
+	state.next_interrupt_cc = next_interrupt_cc;
+	state.next_interrupt_to_send = next_interrupt_to_send;
+	state.interrupt_pending = cpu->interrupt_pending;
+	state.interrupt_rst = cpu->interrupt_rst;
+	state.ei_cycle = cpu->flags->ei_cycle;
+	state.halted = cpu->flags->halted;
+	state.ram.resize(board.ram.last - board.ram.first + 1);
+	memcpy(state.ram.data(), cpu->memory->returnPtrToMem(board.ram.first), state.ram.size());
+}
+
+/**
+ * [DESCRIPTION] Put the board back into a state saveState took from it, the
+ *               pacing of the clock and the front end's settings are kept
+ *
+ * [PARAM] state
+*/
+void SiMachine::loadState(const State& state)
+{
+	*cpu->registers = state.registers;
+	cpu->flags->S.set(state.flags[0]);
+	cpu->flags->Z.set(state.flags[1]);
+	cpu->flags->AC.set(state.flags[2]);
+	cpu->flags->P.set(state.flags[3]);
+	cpu->flags->C.set(state.flags[4]);
+	cpu->flags->INTE.set(state.flags[5]);
+	*cpu->io = state.io;
+	cpu->clock->setCurrentCCs(state.cycles);
+	shift_register.set(state.shift_register);
+	next_interrupt_cc = state.next_interrupt_cc;
+	next_interrupt_to_send = state.next_interrupt_to_send;
+	cpu->interrupt_pending = state.interrupt_pending;
+	cpu->interrupt_rst = state.interrupt_rst;
+	cpu->flags->ei_cycle = state.ei_cycle;
+	cpu->flags->halted = state.halted;
+	memcpy(cpu->memory->returnPtrToMem(board.ram.first), state.ram.data(), state.ram.size());
+	// a latched request is looked at straight away (deliverEvents waits out an EI delay)
+	next_service_cc = cpu->interrupt_pending && cpu->flags->INTE.get() ? state.cycles : UINT64_MAX;
+	updateNextEvent();
+}
+
+/**
+ * [DESCRIPTION] Describe the last watchpoint stop and the cpu state at it
+ *
+ * [RETURN] std::string
+*/
+std::string SiMachine::describeStop()
+{
+	const char* kind = "execute";
+	if (stop.hit.kind == i8080::i8080_Memory::WATCH_READ) {
+		kind = "read";
+	}
+	else if (stop.hit.kind == i8080::i8080_Memory::WATCH_WRITE) {
+		kind = "write";
+	}
+
+	uint8_t bytes[3];
+	for (int i = 0; i < 3; i++) {
+		bytes[i] = cpu->memory->get(stop.pc + i);
+	}
+	char instruction[32];
+	i8080_OpSpec::disassemble(bytes, instruction, sizeof(instruction));
+
+	char text[256];
+	snprintf(text, sizeof(text),
+		"%s %04X=%02X pc=%04X (%s) cycle=%llu A=%02X BC=%02X%02X DE=%02X%02X HL=%02X%02X SP=%04X PC=%04X S=%d Z=%d AC=%d P=%d C=%d",
+		kind, stop.hit.address, stop.hit.value, stop.pc, instruction, (unsigned long long)stop.cycle,
+		cpu->registers->A.get(), cpu->registers->B.get(), cpu->registers->C.get(),
+		cpu->registers->D.get(), cpu->registers->E.get(), cpu->registers->H.get(), cpu->registers->L.get(),
+		cpu->registers->SP.get(), cpu->registers->PC.get(),
+		cpu->flags->S.get(), cpu->flags->Z.get(), cpu->flags->AC.get(), cpu->flags->P.get(), cpu->flags->C.get());
+	return text;
+}
+
+/**
+ * [DESCRIPTION] Apply every movie event that is due to the input ports
+ *
+*/
+void SiMachine::applyMovieInput()
+{
+	while (movie->nextCycle() <= cpu->clock->getCurrentCCs()) {
+		SiMovie::Event evnt = movie->nextEvent();
+		cpu->io->input.get_port(evnt.port)->port_val.byte_val = evnt.value;
+	}
+	next_movie_cc = movie->nextCycle();
+}
+
+/**
+ * [DESCRIPTION] Feed the input ports from the passed movie instead of the user
+ *
+ * [PARAM] p_movie
+*/
+void SiMachine::playMovie(SiMovie* p_movie)
+{
+	movie = p_movie;
+	next_movie_cc = movie->nextCycle();
+	updateNextEvent();
+}
+
+/**
+ * [DESCRIPTION] Returns a pointer to the start of the 1bpp VRAM
+ *
+ * [RETURN] uint8_t*
+*/
+uint8_t* SiMachine::getVRAM()
+{
+	return (uint8_t*)cpu->memory->returnPtrToMem(board.vram);
+}
+
+/**
+ * [DESCRIPTION] Fingerprint the current screen (64 bit FNV-1a) so runs can be
+ *               compared without keeping the frames
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiMachine::hashVRAM()
+{
+	uint64_t hash = 14695981039346656037ull;
+	uint8_t* vram = getVRAM();
+	for (int i = 0; i < board.getVRAMBytes(); i++) {
+		hash = (hash ^ vram[i]) * 1099511628211ull;
+	}
+	return hash;
+}
+
+/**
+ * [DESCRIPTION] Hash the current screen with XXH64, the per frame fingerprint
+ *               golden runs are checked with
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiMachine::hashFrame()
+{
+	return XxHash::hash64(getVRAM(), board.getVRAMBytes());
+}
+
+/**
+ * [DESCRIPTION] Hash everything saveState keeps: the registers, flags, the
+ *               board's ports, the shift register, the interrupt timing and
+ *               latch, the clock and the whole RAM
+ *      - The cpu state is packed byte by byte first so padding never gets
+ *        into the hash, the RAM is then hashed seeded with it
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiMachine::hashState()
+{
+	uint8_t packed[64];
+	int size = 0;
+	i8080::i8080_Registers* registers = cpu->registers;
+	packed[size++] = registers->A.get();
+	packed[size++] = registers->B.get();
+	packed[size++] = registers->C.get();
+	packed[size++] = registers->D.get();
+	packed[size++] = registers->E.get();
+	packed[size++] = registers->H.get();
+	packed[size++] = registers->L.get();
+	packed[size++] = (uint8_t)registers->SP.get();
+	packed[size++] = (uint8_t)(registers->SP.get() >> 8);
+	packed[size++] = (uint8_t)registers->PC.get();
+	packed[size++] = (uint8_t)(registers->PC.get() >> 8);
+	packed[size++] = (uint8_t)(cpu->flags->S.get() | cpu->flags->Z.get() << 1 | cpu->flags->AC.get() << 2 |
+		cpu->flags->P.get() << 3 | cpu->flags->C.get() << 4 | cpu->flags->INTE.get() << 5 | cpu->flags->halted << 6);
+	packed[size++] = cpu->io->input.get_port(board.input_ports[0])->port_val.byte_val;
+	packed[size++] = cpu->io->input.get_port(board.input_ports[1])->port_val.byte_val;
+	packed[size++] = cpu->io->output.get_port(board.sound_ports[0])->port_val.byte_val;
+	packed[size++] = cpu->io->output.get_port(board.sound_ports[1])->port_val.byte_val;
+	packed[size++] = cpu->io->output.get_port(board.shift_amount_port)->port_val.byte_val;
+	uint16_t shift = shift_register.get();
+	packed[size++] = (uint8_t)shift;
+	packed[size++] = (uint8_t)(shift >> 8);
+	packed[size++] = (uint8_t)next_interrupt_to_send;
+	packed[size++] = (uint8_t)(cpu->interrupt_pending ? 0x08 | cpu->interrupt_rst : 0);
+	uint64_t words[3] = { cpu->clock->getCurrentCCs(), next_interrupt_cc, cpu->flags->ei_cycle };
+	for (uint64_t word : words) {
+		for (int i = 0; i < 8; i++) {
+			packed[size++] = (uint8_t)(word >> (8 * i));
+		}
+	}
+
+	uint64_t seed = XxHash::hash64(packed, size);
+	return XxHash::hash64(cpu->memory->returnPtrToMem(board.ram.first), board.ram.last - board.ram.first + 1, seed);
+}
+
+/**
+ * [DESCRIPTION] Decode a 4 digit BCD score stored LSB first in work RAM
+ *
+ * [PARAM] address - one of the RAM_*_SCORE locations
+ * [RETURN] int
+*/
+int SiMachine::readScore(uint16_t address)
+{
+	uint8_t lsb = cpu->memory->get(address);
+	uint8_t msb = cpu->memory->get(address + 1);
+	return (msb >> 4) * 1000 + (msb & 0x0f) * 100 + (lsb >> 4) * 10 + (lsb & 0x0f);
+}
+
+/**
+ * [DESCRIPTION] Emulate the SI register shift
+ * 
+*/
+void SiMachine::performShift()
+{
+	// https://computerarcheology.com/Arcade/SpaceInvaders/Hardware.html
+	//f              0	bit
+	//	xxxxxxxxyyyyyyyy
+
+	//	Writing to Port 4 shifts x into y, and the new value into x, eg.
+	//	$0000,
+	//	write $aa->$aa00,
+	//	write $ff->$ffaa,
+	//	write $12->$12ff, ..
+	//printf("PreShiftRegister: %4X\n", shift_register.get());
+	uint16_t uint16_InitialShiftRegister = shift_register.get();
+	uint16_t uint16_ShiftRegisterTemp = 0x0000;
+	uint8_t uint8_ShiftLow = 0x00;
+	uint8_t uint8_ShiftHigh = 0x00;
+
+	uint8_ShiftLow = uint8_ShiftLow | uint16_InitialShiftRegister;
+	uint8_ShiftHigh = uint8_ShiftHigh | (uint16_InitialShiftRegister >> 8);
+
+	uint16_ShiftRegisterTemp = uint16_ShiftRegisterTemp | cpu->io->output.get_port(board.shift_data_port)->port_val.byte_val;
+	uint16_ShiftRegisterTemp = uint16_ShiftRegisterTemp << 0x08;
+	uint16_ShiftRegisterTemp = uint16_ShiftRegisterTemp | uint8_ShiftHigh;
+		
+	shift_register.set(uint16_ShiftRegisterTemp);
+	//printf("PostShiftRegister: %4X\n", shift_register.get());
+
+	//	Writing to Port 2 (bits 0, 1, 2) sets the offset for the 8 bit result, eg.
+	
+	uint8_t uint8_Offset = (cpu->io->output.get_port(board.shift_amount_port)->port_val.byte_val & 0x07);
+	uint8_t uint8_RegisterTemp = 0x00;
+	//printf("Offset: %4X\n", uint8_Offset);
+	// 
+	//	offset 0:
+	//rrrrrrrr		result = xxxxxxxx
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x00) {
+		uint8_RegisterTemp = shift_register.get() >> 0x08;
+	}
+
+	//	offset 1:
+	//rrrrrrrr		result = xxxxxxxy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x01) {
+		uint8_RegisterTemp = shift_register.get() >> 0x07;
+	}
+
+	//	offset 2 :
+	//	rrrrrrrr	result = xxxxxxyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x02) {
+		uint8_RegisterTemp = shift_register.get() >> 0x06;
+	}
+
+	//	offset 3:
+	//rrrrrrrr		result = xxxxxyyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x03) {
+		uint8_RegisterTemp = shift_register.get() >> 0x05;
+	}
+
+	//	offset 4:
+	//rrrrrrrr		result = xxxxyyyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x04) {
+		uint8_RegisterTemp = shift_register.get() >> 0x04;
+	}
+
+	//	offset 5:
+	//rrrrrrrr		result = xxxyyyyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x05) {
+		uint8_RegisterTemp = shift_register.get() >> 0x03;
+	}
+
+	//	offset 6:
+	//rrrrrrrr		result = xxyyyyyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x06) {
+		uint8_RegisterTemp = shift_register.get() >> 0x02;
+	}
+
+	//	offset 7 :
+	//	rrrrrrrr	result = xyyyyyyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x07) {
+		uint8_RegisterTemp = shift_register.get() >> 0x01;
+	}
+
+	//	offset 8 :
+	//	rrrrrrrr	result = yyyyyyyy
+	//	xxxxxxxxyyyyyyyy
+	if (uint8_Offset == 0x08) {
+		uint8_RegisterTemp = shift_register.get() >> 0x00;
+	}
+
+	cpu->io->input.get_port(board.shift_result_port)->port_val.byte_val = uint8_RegisterTemp;
+	// cpu->io->input.set(3, uint8_RegisterTemp);
+
+}
+
+/**
+ * [DESCRIPTION] Construct a new SiMachine object
+ *
+ * [PARAM] p_board - the board to build (Space Invaders by default)
+*/
+SiMachine::SiMachine(const SiBoard& p_board) : board(p_board)
+{
+	cpu = new i8080;
+	shift_register.set(0);
+	next_interrupt_cc = board.interrupt_interval;
+	next_interrupt_to_send = board.interrupts[0];
+	next_service_cc = UINT64_MAX;
+	movie = NULL;
+	next_movie_cc = UINT64_MAX;
+	capture_sound = false;
+	use_recompiled = false;
+	opcodes_run = 0;
+	interrupts_run = 0;
+	watching = false;
+	resuming = false;
+	tracing = false;
+	profiling = false;
+	input_read_cc = UINT64_MAX;
+	probing_vram = false;
+	vram_write_cc = UINT64_MAX;
+	updateNextEvent();
+}
+
+/**
+ * [DESCRIPTION] Destroy the SiMachine object
+ *
+*/
+SiMachine::~SiMachine()
+{
+	delete cpu;
+}
@@ -0,0 +1,162 @@
+/**
+ * [FILE] SiMachine.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains an object that represents the Space Invaders board (cpu,
+ *               shift hardware and interrupt timing) without any SDL dependency so
+ *               it can be run headless, the other boards of the family are built
+ *               from their SiBoard description
+ * [DATE] 2021-06-04
+*/
+
+#pragma once
+#include "../i8080/i8080.h"
+#include "SiBoard.h"
+#include "SiMovie.h"
+#include "../testWriter.h"
+#include "../Emulator/RomSet.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class representing the Space Invaders arcade board
+ *      - Everything the game needs to run lives here, the SDL front end
+ *        only reads the VRAM/sound ports and writes the input ports
+*/
+class SiMachine {
+private:
+    i8080::i8080_Registers::Register_16Bit shift_register;   // special i8080 hardware
+    uint64_t    next_interrupt_cc;      // clock cycle the next interrupt is due on
+    int         next_interrupt_to_send; // RST number of the next interrupt
+    uint64_t    next_service_cc;        // cycle a latched interrupt is looked at again (UINT64_MAX while INTE is clear)
+    SiMovie*    movie;                  // movie to play input back from (NULL if none)
+    uint64_t    next_movie_cc;          // clock cycle the next movie event is due on
+    uint64_t    next_event_cc;          // min(next_interrupt_cc, next_service_cc, next_movie_cc)
+    bool        watching;               // a watchpoint is armed (runs on DebugPolicy)
+    bool        resuming;               // skip the read/execute checks of the opcode a stop was on
+    bool        tracing;                // log every opcode (runs on DebugPolicy)
+    bool        profiling;              // count every opcode and its cycles (runs on DebugPolicy)
+    std::vector<uint64_t> profile_runs;     // runs of every opcode while profiling
+    std::vector<uint64_t> profile_cycles;   // cycles they took
+    uint64_t    input_read_cc;          // first IN of an input port since clearInputRead (UINT64_MAX if none)
+    bool        probing_vram;           // look for the first VRAM write after it (runs on DebugPolicy)
+    uint64_t    vram_write_cc;          // cycle of that write (UINT64_MAX until found)
+    TestWriter  trace;                  // opcode log used for debugging
+    std::shared_ptr<const RomSet> rom_set;  // keeps the shared ROM pages mapped
+    void        performShift();         // special i8080 hardware
+    void        applyMovieInput();      // apply every movie event that is due
+    void        updateNextEvent();      // recompute next_event_cc
+    void        deliverEvents();        // interrupt/movie input due on the current cycle
+    void        interruptsEnabled();    // an EI ran, a latched interrupt can go in after the next opcode
+
+    template <class Policy> bool runOpcode();                       // one opcode on a variant
+    template <class Policy> bool runLoop(uint64_t goal_clock_cycles);   // opcodes until the goal
+public:
+    /* the run loop is built once per policy, a feature a policy turns off is
+        not in its variant at all (runUntil picks the variant per call) */
+    struct CabinetPolicy {              // production: recompiled blocks, nothing else
+        static const bool RECOMPILED = true;    // cycles accounted per block where there is one
+        static const bool TRACE = false;
+        static const bool WATCH = false;
+        static const bool PROBE = false;
+        static const bool PROFILE = false;
+    };
+    struct InterpreterPolicy {          // reference: every opcode on the interpreter
+        static const bool RECOMPILED = false;
+        static const bool TRACE = false;
+        static const bool WATCH = false;
+        static const bool PROBE = false;
+        static const bool PROFILE = false;
+    };
+    struct DebugPolicy {                // instrumented: interpreter, opcode trace/profile (if on), watchpoints, input probe
+        static const bool RECOMPILED = false;
+        static const bool TRACE = true;
+        static const bool WATCH = true;
+        static const bool PROBE = true;         // VRAM writes while probeVRAMWrite is on
+        static const bool PROFILE = true;
+    };
+
+    /* 2 clock cycles per micro second, 1/60 second = 16666 micro seconds
+        so interrupt every 2 * 16666 = 33333 clock cycles (every board of
+        the family runs on it, see SiBoard.h) */
+    static const int INTERRUPT_INTERVAL = SiBoards::INVADERS.interrupt_interval;
+
+    // WORK RAM LOCATIONS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // https://computerarcheology.com/Arcade/SpaceInvaders/RAMUse.html
+    static const uint16_t RAM_HI_SCORE = 0x20F4;    // BCD score, LSB first
+    static const uint16_t RAM_P1_SCORE = 0x20F8;    // BCD score, LSB first
+    static const uint16_t RAM_P2_SCORE = 0x20FC;    // BCD score, LSB first
+    static const uint16_t RAM_GAME_MODE = 0x20EF;   // 1 while a game is being played
+
+    // why and where a watchpoint stopped the board
+    struct Stop {
+        i8080::i8080_Memory::WatchHit hit;
+        uint16_t    pc;                 // opcode that made the access
+        uint64_t    cycle;
+    };
+
+    /* everything running the board can change, the ROM and the configuration
+        are not in it and the board has nothing but ROM and RAM (run-ahead
+        saves and loads one every frame, so it is a flat copy) */
+    struct State {
+        i8080::i8080_Registers registers;
+        bool        flags[6];           // S, Z, AC, P, C, INTE
+        i8080::i8080_IO io;             // input and output ports
+        uint64_t    cycles;
+        uint16_t    shift_register;
+        uint64_t    next_interrupt_cc;
+        int         next_interrupt_to_send;
+        bool        interrupt_pending;  // the cpu's latched request
+        uint8_t     interrupt_rst;
+        uint64_t    ei_cycle;
+        bool        halted;             // a HLT is waiting for an interrupt
+        std::vector<uint8_t> ram;       // the board's RAM (sized by the first save)
+    };
+
+    // a write to one of the sound ports (3 or 5) and the cycle it happened on
+    struct SoundWrite {
+        uint64_t    cycle;
+        uint8_t     port;
+        uint8_t     value;
+    };
+
+    const SiBoard board;                // hardware the machine was built from
+    i8080*      cpu;                    // cpu to run the game on
+    bool        capture_sound;          // collect sound port writes (off for headless runs)
+    bool        use_recompiled;         // run the recompiled ROM blocks (set by loadRomFiles)
+    uint64_t    opcodes_run;            // opcodes run on either engine since the board was built
+    uint64_t    interrupts_run;         // interrupts the cpu took since the board was built
+    std::vector<SoundWrite> sound_writes;   // writes since the front end last cleared them
+
+    bool        loadRomFiles(const char* rom_dir = "SpaceInvaders/rom");   // map the board's verified rom set
+    bool        loadRomSet(std::shared_ptr<const RomSet> loaded);       // map a set that is already open
+    void        reset();                // power the board back on (the ROM stays loaded)
+    bool        runUntil(uint64_t goal_clock_cycles);   // run until the clock reaches the goal
+    bool        runFrames(uint64_t num_frames);         // run whole frames of emulated time
+    bool        runInstruction();                       // run a single opcode (and any due event)
+    void        portWritten(uint8_t port, uint64_t cycle);  // board side of an OUT
+    void        portRead(uint8_t port, uint64_t cycle);     // board side of an IN
+    void        clearInputRead();                       // forget the last input port read
+    uint64_t    getInputRead();                         // first input port read since (UINT64_MAX if none)
+    void        probeVRAMWrite(bool p_probing);         // find the first VRAM write after an input read
+    uint64_t    getVRAMWrite();                         // cycle of that write (UINT64_MAX until found)
+    void        addWatchpoint(const i8080::i8080_Memory::Watchpoint& watchpoint);
+    void        setTracing(bool p_tracing);             // log every opcode to the TestWriter file
+    void        setProfiling(bool p_profiling);         // count every opcode and the cycles it took
+    std::string describeProfile(int num_rows);          // the instructions that took the most cycles
+    void        saveState(State& state);                // copy the running state out
+    void        loadState(const State& state);          // put a saved state back
+    Stop        stop;                                   // filled in when a run returns false
+    std::string describeStop();                         // the stop and the cpu state as text
+    uint64_t    nextEventCycle();                       // cycle of the next interrupt/movie event or latched interrupt
+    void        playMovie(SiMovie* p_movie);            // feed the input ports from a movie
+    uint8_t*    getVRAM();              // pointer to the start of the 1bpp VRAM
+    uint64_t    hashVRAM();             // fingerprint of the current screen
+    uint64_t    hashFrame();            // XXH64 of the screen (golden runs)
+    uint64_t    hashState();            // XXH64 of everything a save state holds
+    int         readScore(uint16_t address);    // decode a BCD score from work RAM
+    SiMachine(const SiBoard& p_board = SiBoards::INVADERS);
+    SiMachine(const SiMachine&) = delete;               // owns the cpu
+    SiMachine& operator=(const SiMachine&) = delete;
+    ~SiMachine();
+};
@@ -0,0 +1,204 @@
+/**
+ * [FILE] SiMovie.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the input movie recorder/player
+ * [DATE] 2021-06-04
+*/
+
+#include "SiMovie.h"
+#include <cstring>
+
+/**
+ * [DESCRIPTION] Write a value to the file as little endian bytes
+ *
+ * [PARAM] f
+ * [PARAM] val
+ * [PARAM] num_bytes
+*/
+static void writeLE(FILE* f, uint64_t val, int num_bytes)
+{
+	for (int i = 0; i < num_bytes; i++) {
+		fputc((int)((val >> (8 * i)) & 0xff), f);
+	}
+}
+
+/**
+ * [DESCRIPTION] Read a little endian value from the file
+ *
+ * [PARAM] f
+ * [PARAM] val - set to the value read
+ * [PARAM] num_bytes
+ * [RETURN] false if the file ended early
+*/
+static bool readLE(FILE* f, uint64_t& val, int num_bytes)
+{
+	val = 0;
+	for (int i = 0; i < num_bytes; i++) {
+		int c = fgetc(f);
+		if (c == EOF) {
+			return false;
+		}
+		val |= (uint64_t)c << (8 * i);
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Compare the input ports to the last recorded values and store
+ *               an event for every port that changed
+ *
+ * [PARAM] cycle - clock cycle the new values become visible to the cpu
+ * [PARAM] port_1
+ * [PARAM] port_2
+*/
+void SiMovie::recordInput(uint64_t cycle, uint8_t port_1, uint8_t port_2)
+{
+	if (port_1 != last_port_1) {
+		events.push_back({ cycle, 1, port_1 });
+		last_port_1 = port_1;
+	}
+	if (port_2 != last_port_2) {
+		events.push_back({ cycle, 2, port_2 });
+		last_port_2 = port_2;
+	}
+}
+
+/**
+ * [DESCRIPTION] Mark the clock cycle the recorded session ended on
+ *
+ * [PARAM] cycle
+*/
+void SiMovie::finish(uint64_t cycle)
+{
+	end_cycle = cycle;
+}
+
+/**
+ * [DESCRIPTION] Write the movie to the passed file
+ *
+ * [PARAM] fileName
+ * [RETURN] true on success
+*/
+bool SiMovie::save(const char* fileName)
+{
+#pragma warning(disable:4996)
+	FILE* f = fopen(fileName, "wb");
+	if (f == NULL) {
+		printf("ERROR OPENING %s\n", fileName);
+		return false;
+	}
+
+	fwrite("SIMV", 1, 4, f);
+	writeLE(f, VERSION, 4);
+	writeLE(f, end_cycle, 8);
+	writeLE(f, events.size(), 8);
+	for (const Event& evnt : events) {
+		writeLE(f, evnt.cycle, 8);
+		writeLE(f, evnt.port, 1);
+		writeLE(f, evnt.value, 1);
+	}
+
+	fclose(f);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Read a movie from the passed file and rewind playback
+ *
+ * [PARAM] fileName
+ * [RETURN] true on success
+*/
+bool SiMovie::load(const char* fileName)
+{
+#pragma warning(disable:4996)
+	FILE* f = fopen(fileName, "rb");
+	if (f == NULL) {
+		printf("ERROR OPENING %s\n", fileName);
+		return false;
+	}
+
+	char magic[4];
+	uint64_t version = 0;
+	uint64_t count = 0;
+	bool read_ok = fread(magic, 1, 4, f) == 4 && memcmp(magic, "SIMV", 4) == 0;
+	read_ok = read_ok && readLE(f, version, 4) && version == VERSION;
+	read_ok = read_ok && readLE(f, end_cycle, 8) && readLE(f, count, 8);
+
+	events.clear();
+	for (uint64_t i = 0; read_ok && i < count; i++) {
+		uint64_t cycle, port, value;
+		read_ok = readLE(f, cycle, 8) && readLE(f, port, 1) && readLE(f, value, 1);
+		if (read_ok) {
+			events.push_back({ cycle, (uint8_t)port, (uint8_t)value });
+		}
+	}
+	fclose(f);
+
+	if (!read_ok) {
+		printf("ERROR READING MOVIE %s\n", fileName);
+		events.clear();
+		end_cycle = 0;
+	}
+	play_index = 0;
+	return read_ok;
+}
+
+/**
+ * [DESCRIPTION] Check if every event has been played back
+ *
+ * [RETURN] true when playback is done
+*/
+bool SiMovie::atEnd()
+{
+	return play_index >= events.size();
+}
+
+/**
+ * [DESCRIPTION] Get the clock cycle the next event is due on
+ *
+ * [RETURN] uint64_t (UINT64_MAX when there are no events left)
+*/
+uint64_t SiMovie::nextCycle()
+{
+	return atEnd() ? UINT64_MAX : events[play_index].cycle;
+}
+
+/**
+ * [DESCRIPTION] Pop the next event to play back
+ *
+ * [RETURN] Event
+*/
+SiMovie::Event SiMovie::nextEvent()
+{
+	return events[play_index++];
+}
+
+/**
+ * [DESCRIPTION] Return the clock cycle the session ended on
+ *
+*/
+uint64_t SiMovie::getEndCycle()
+{
+	return end_cycle;
+}
+
+/**
+ * [DESCRIPTION] Return the number of events in the movie
+ *
+*/
+size_t SiMovie::getEventCount()
+{
+	return events.size();
+}
+
+/**
+ * [DESCRIPTION] Construct a new empty SiMovie object
+ *
+*/
+SiMovie::SiMovie()
+{
+	play_index = 0;
+	end_cycle = 0;
+	last_port_1 = 0;
+	last_port_2 = 0;
+}
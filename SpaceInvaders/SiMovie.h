@@ -0,0 +1,49 @@
+/**
+ * [FILE] SiMovie.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains an object that records and plays back the input ports of
+ *               the Space Invaders board so that a run can be reproduced exactly
+ *      FILE LAYOUT (little endian):
+ *          "SIMV" | uint32 version | uint64 end cycle | uint64 event count |
+ *          event count * (uint64 cycle | uint8 port | uint8 value)
+ * [DATE] 2021-06-04
+*/
+
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class representing a recorded input session
+ *      - Only changes of input port 1 and port 2 are stored, each stamped
+ *        with the emulated clock cycle the change became visible to the cpu
+*/
+class SiMovie {
+public:
+    // a single change of an input port
+    struct Event {
+        uint64_t    cycle;              // clock cycle the value was applied on
+        uint8_t     port;               // input port number (1 or 2)
+        uint8_t     value;              // new value of the whole port
+    };
+
+    static const uint32_t VERSION = 1;
+
+    void        recordInput(uint64_t cycle, uint8_t port_1, uint8_t port_2);   // store any port changes
+    void        finish(uint64_t cycle);             // mark the end of the session
+    bool        save(const char* fileName);         // write the movie to disk
+    bool        load(const char* fileName);         // read a movie from disk
+    bool        atEnd();                            // true once every event was played back
+    uint64_t    nextCycle();                        // clock cycle of the next event to play back
+    Event       nextEvent();                        // pop the next event to play back
+    uint64_t    getEndCycle();                      // clock cycle the session ended on
+    size_t      getEventCount();                    // number of events in the movie
+    SiMovie();
+private:
+    std::vector<Event> events;          // every recorded port change in order
+    size_t      play_index;             // index of the next event to play back
+    uint64_t    end_cycle;              // clock cycle the session ended on
+    uint8_t     last_port_1;            // last recorded value of port 1
+    uint8_t     last_port_2;            // last recorded value of port 2
+};
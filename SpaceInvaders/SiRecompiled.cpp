@@ -0,0 +1,198 @@
+/**
+ * [FILE] SiRecompiled.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the dispatcher of the recompiled ROM blocks, the blocks
+ *               themselves are generated into SiRecompiledBlocks.cpp
+ * [DATE] 2021-06-13
+*/
+
+#include "SiRecompiled.h"
+#include "SiMachine.h"
+#include <vector>
+
+/**
+ * [DESCRIPTION] IN port, the board's input ports are read straight from the cpu,
+ *               the board is told on the cycle the IN finishes (the block adds
+ *               its 10 cycles afterwards)
+ *
+ * [PARAM] port
+*/
+void SiRecompiled::Context::in(uint8_t port)
+{
+	A = cpu->io->input.get_port(port)->port_val.byte_val;
+	machine->portRead(port, cycles + 10);
+}
+
+/**
+ * [DESCRIPTION] OUT port, the board reacts the same as when the interpreter
+ *               runs the OUT (shift register, sound capture)
+ *
+ * [PARAM] port
+*/
+void SiRecompiled::Context::out(uint8_t port)
+{
+	cpu->io->output.get_port(port)->port_val.byte_val = A;
+	machine->portWritten(port, cycles);
+}
+
+/**
+ * [DESCRIPTION] DI, interrupts are only delivered between runs of blocks so
+ *               the flag can be cleared on the cpu straight away (EI ends the
+ *               block, the board has to schedule the latched interrupt)
+ *
+*/
+void SiRecompiled::Context::disableInterrupts()
+{
+	cpu->flags->INTE.set(false);
+}
+
+/**
+ * [DESCRIPTION] Fingerprint the ROM area of memory (64 bit FNV-1a)
+ *
+ * [PARAM] memory
+ * [RETURN] uint64_t
+*/
+uint64_t SiRecompiled::romHash(i8080::i8080_Memory* memory)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (uint32_t address = 0; address < ROM_SIZE; address++) {
+		hash = (hash ^ memory->get((uint16_t)address)) * 1099511628211ull;
+	}
+	return hash;
+}
+
+/**
+ * [DESCRIPTION] Check the blocks were generated from the ROM that is loaded
+ *
+ * [PARAM] memory
+ * [RETURN] false if the ROM differs (the interpreter has to run everything)
+*/
+bool SiRecompiled::matches(i8080::i8080_Memory* memory)
+{
+	return romIntact(memory) && romHash(memory) == rom_hash;
+}
+
+/**
+ * [DESCRIPTION] Check no write has given the board its own copy of a ROM page
+ *
+ * [PARAM] memory
+ * [RETURN] bool
+*/
+bool SiRecompiled::romIntact(i8080::i8080_Memory* memory)
+{
+	for (uint32_t address = 0; address < ROM_SIZE; address += i8080::i8080_Memory::PAGE_SIZE) {
+		if (!memory->isShared((uint16_t)address)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Return the block starting at every ROM address, built once
+ *               from the generated list
+ *
+ * [RETURN] const Block* const* (ROM_SIZE entries, NULL where no block starts)
+*/
+const SiRecompiled::Block* const* SiRecompiled::getTable()
+{
+	static const std::vector<const Block*> table = []() {
+		std::vector<const Block*> built(ROM_SIZE, NULL);
+		for (size_t i = 0; i < num_blocks; i++) {
+			built[blocks[i].address] = &blocks[i];
+		}
+		return built;
+	}();
+	return table.data();
+}
+
+/**
+ * [DESCRIPTION] Return the block starting at the passed address
+ *
+ * [PARAM] pc
+ * [RETURN] const Block* (NULL if no block starts there)
+*/
+const SiRecompiled::Block* SiRecompiled::findBlock(uint16_t pc)
+{
+	return pc < ROM_SIZE ? getTable()[pc] : NULL;
+}
+
+/**
+ * [DESCRIPTION] Run blocks from the board's PC until the next one would reach
+ *               the limit or there is no block for the PC
+ *      - Nothing is loaded unless the first block can run, so a PC the
+ *        interpreter has to handle costs a single lookup
+ *
+ * [PARAM] machine
+ * [PARAM] limit - every opcode run has to start before this cycle
+ * [RETURN] false if the ROM was written to (the blocks can not be used anymore)
+*/
+bool SiRecompiled::run(SiMachine& machine, uint64_t limit)
+{
+	static const Block* const* table = getTable();
+	i8080* cpu = machine.cpu;
+	uint16_t pc = cpu->registers->PC.get();
+	if (pc >= ROM_SIZE || table[pc] == NULL) {
+		return true;
+	}
+	uint64_t start_cycles = cpu->clock->getCurrentCCs();
+	const Block* block = table[pc];
+	if (start_cycles + block->max_cycles > limit) {
+		return true;
+	}
+	if (!romIntact(cpu->memory)) {
+		return false;
+	}
+
+	// LOAD =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+	Context ctx;
+	ctx.A = cpu->registers->A.get();
+	ctx.B = cpu->registers->B.get();
+	ctx.C = cpu->registers->C.get();
+	ctx.D = cpu->registers->D.get();
+	ctx.E = cpu->registers->E.get();
+	ctx.H = cpu->registers->H.get();
+	ctx.L = cpu->registers->L.get();
+	ctx.flag_S = cpu->flags->S.get();
+	ctx.flag_Z = cpu->flags->Z.get();
+	ctx.flag_AC = cpu->flags->AC.get();
+	ctx.flag_P = cpu->flags->P.get();
+	ctx.flag_C = cpu->flags->C.get();
+	ctx.PC = pc;
+	ctx.SP = cpu->registers->SP.get();
+	ctx.cycles = start_cycles;
+	ctx.rom_written = false;
+	ctx.cpu = cpu;
+	ctx.memory = cpu->memory;
+	ctx.machine = &machine;
+
+	// RUN =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	uint64_t opcodes = 0;
+	do {
+		block->run(ctx);
+		opcodes += block->num_opcodes;
+		if (ctx.PC >= ROM_SIZE || ctx.rom_written) {
+			break;
+		}
+		block = table[ctx.PC];
+	} while (block != NULL && ctx.cycles + block->max_cycles <= limit);
+
+	// STORE =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	cpu->registers->A.set(ctx.A);
+	cpu->registers->B.set(ctx.B);
+	cpu->registers->C.set(ctx.C);
+	cpu->registers->D.set(ctx.D);
+	cpu->registers->E.set(ctx.E);
+	cpu->registers->H.set(ctx.H);
+	cpu->registers->L.set(ctx.L);
+	cpu->flags->S.set(ctx.flag_S != 0);
+	cpu->flags->Z.set(ctx.flag_Z != 0);
+	cpu->flags->AC.set(ctx.flag_AC != 0);
+	cpu->flags->P.set(ctx.flag_P != 0);
+	cpu->flags->C.set(ctx.flag_C != 0);
+	cpu->registers->PC.set(ctx.PC);
+	cpu->registers->SP.set(ctx.SP);
+	cpu->clock->incClockCycles((int)(ctx.cycles - start_cycles));
+	machine.opcodes_run += opcodes;
+	return !ctx.rom_written;
+}
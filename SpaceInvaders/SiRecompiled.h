@@ -0,0 +1,109 @@
+/**
+ * [FILE] SiRecompiled.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the native fast path built from the Space Invaders ROM
+ *               ahead of time by SiRecompiler (SiRecompiledBlocks.cpp)
+ * [DATE] 2021-06-13
+*/
+
+#pragma once
+#include "../i8080/i8080.h"
+#include <cstddef>
+#include <cstdint>
+
+class SiMachine;
+
+/**
+ * [DESCRIPTION] Class which runs the recompiled basic blocks of the ROM
+ *      - Every block found by the static analysis is a C++ function that
+ *        works on a copy of the cpu state, the interpreter runs everything
+ *        else (code that was not found, opcodes with no native form)
+ *      - A block only runs if all of its opcodes start before the next
+ *        interrupt/movie event, so the board sees the same opcode boundaries
+ *        as the interpreter and the runs stay cycle exact
+ *      - The blocks are only used while the loaded ROM is the one they were
+ *        built from and no write has landed in it
+*/
+class SiRecompiled {
+public:
+    /**
+     * [DESCRIPTION] The cpu state the blocks work on, loaded from the board
+     *               when the fast path is entered and stored back when it leaves
+     *
+    */
+    struct Context {
+        uint8_t     A, B, C, D, E, H, L;
+        uint8_t     flag_S, flag_Z, flag_AC, flag_P, flag_C;    // 0 or 1
+        uint16_t    PC;
+        uint16_t    SP;
+        uint64_t    cycles;
+        bool        rom_written;        // a block wrote below ROM_SIZE, stop using the blocks
+        i8080*      cpu;
+        i8080::i8080_Memory* memory;
+        SiMachine*  machine;
+
+        uint16_t    getBC() { return (uint16_t)((B << 8) | C); }
+        uint16_t    getDE() { return (uint16_t)((D << 8) | E); }
+        uint16_t    getHL() { return (uint16_t)((H << 8) | L); }
+        void        setBC(uint16_t val) { B = (uint8_t)(val >> 8); C = (uint8_t)val; }
+        void        setDE(uint16_t val) { D = (uint8_t)(val >> 8); E = (uint8_t)val; }
+        void        setHL(uint16_t val) { H = (uint8_t)(val >> 8); L = (uint8_t)val; }
+
+        uint8_t     read(uint16_t address) { return memory->get(address); }
+        void        write(uint16_t address, uint8_t val)
+        {
+            memory->set(address, val);
+            rom_written |= address < ROM_SIZE;
+        }
+        void        push(uint16_t val)
+        {
+            write((uint16_t)(SP - 1), (uint8_t)(val >> 8));
+            write((uint16_t)(SP - 2), (uint8_t)val);
+            SP = (uint16_t)(SP - 2);
+        }
+        uint16_t    pop()
+        {
+            uint8_t low = read(SP);
+            uint8_t high = read((uint16_t)(SP + 1));
+            SP = (uint16_t)(SP + 2);
+            return (uint16_t)((high << 8) | low);
+        }
+        void        setSZP(uint8_t res)
+        {
+            uint8_t parity = res ^ (res >> 4);
+            parity ^= parity >> 2;
+            parity ^= parity >> 1;
+            flag_S = res >> 7;
+            flag_Z = res == 0;
+            flag_P = (parity & 1) ^ 1;
+        }
+        void        in(uint8_t port);   // IN port (A <- input port)
+        void        out(uint8_t port);  // OUT port, after the cycles of the OUT were added
+        void        disableInterrupts();            // DI (EI is left to the interpreter)
+    };
+
+    typedef void (*BlockFunction)(Context& ctx);
+
+    // a basic block of the ROM, the most cycles it can take and its opcodes
+    struct Block {
+        uint16_t        address;
+        uint16_t        max_cycles;
+        uint16_t        num_opcodes;    // every run of the block runs all of them
+        BlockFunction   run;
+    };
+
+    static const uint16_t ROM_SIZE = 0x2000;    // the blocks only cover the ROM
+
+    // GENERATED (SiRecompiledBlocks.cpp) =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    static const Block      blocks[];           // sorted by address
+    static const size_t     num_blocks;
+    static const uint64_t   rom_hash;           // romHash() of the ROM the blocks came from
+
+    static uint64_t romHash(i8080::i8080_Memory* memory);   // fingerprint the loaded ROM
+    static bool     matches(i8080::i8080_Memory* memory);   // the blocks fit the loaded ROM
+    static bool     run(SiMachine& machine, uint64_t limit);    // run blocks until limit
+    static const Block* findBlock(uint16_t pc);                 // block starting at pc (or NULL)
+private:
+    static const Block* const* getTable();     // block starting at every ROM address (or NULL)
+    static bool     romIntact(i8080::i8080_Memory* memory);
+};
@@ -0,0 +1,8270 @@
+/**
+ * [FILE] SiRecompiledBlocks.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] GENERATED by SiRecompiler from the Space Invaders ROM, do not edit,
+ *               rebuild it with: Emulator_8080 --recompile SpaceInvaders/SiRecompiledBlocks.cpp
+ * [DATE] 2021-06-13
+*/
+
+#include "SiRecompiled.h"
+
+static void block_0000(SiRecompiled::Context& ctx)
+{
+	// 0000  00
+	ctx.cycles += 4;
+	// 0001  00
+	ctx.cycles += 4;
+	// 0002  00
+	ctx.cycles += 4;
+	// 0003  C3 D4 18
+	ctx.PC = 0x18D4;
+	ctx.cycles += 10;
+}
+
+static void block_0009(SiRecompiled::Context& ctx)
+{
+	// 0009  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 000A  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 000B  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 000C  C3 8C 00
+	ctx.PC = 0x008C;
+	ctx.cycles += 10;
+}
+
+static void block_0011(SiRecompiled::Context& ctx)
+{
+	// 0011  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 0012  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 0013  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0014  3E 80
+	ctx.A = 0x80;
+	ctx.cycles += 7;
+	// 0016  32 72 20
+	ctx.write(0x2072, ctx.A);
+	ctx.cycles += 13;
+	// 0019  21 C0 20
+	ctx.setHL(0x20C0);
+	ctx.cycles += 10;
+	// 001C  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 001D  CD CD 17
+	ctx.push(0x0020);
+	ctx.PC = 0x17CD;
+	ctx.cycles += 17;
+}
+
+static void block_0018(SiRecompiled::Context& ctx)
+{
+	// 0018  20
+	ctx.cycles += 4;
+	// 0019  21 C0 20
+	ctx.setHL(0x20C0);
+	ctx.cycles += 10;
+	// 001C  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 001D  CD CD 17
+	ctx.push(0x0020);
+	ctx.PC = 0x17CD;
+	ctx.cycles += 17;
+}
+
+static void block_0020(SiRecompiled::Context& ctx)
+{
+	// 0020  DB 01
+	ctx.in(0x01);
+	ctx.cycles += 10;
+	// 0022  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0023  DA 67 00
+	ctx.PC = (ctx.flag_C != 0) ? 0x0067 : 0x0026;
+	ctx.cycles += 10;
+}
+
+static void block_0026(SiRecompiled::Context& ctx)
+{
+	// 0026  3A EA 20
+	ctx.A = ctx.read(0x20EA);
+	ctx.cycles += 13;
+	// 0029  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 002A  CA 42 00
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0042 : 0x002D;
+	ctx.cycles += 10;
+}
+
+static void block_0028(SiRecompiled::Context& ctx)
+{
+	// 0028  20
+	ctx.cycles += 4;
+	// 0029  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 002A  CA 42 00
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0042 : 0x002D;
+	ctx.cycles += 10;
+}
+
+static void block_002D(SiRecompiled::Context& ctx)
+{
+	// 002D  3A EB 20
+	ctx.A = ctx.read(0x20EB);
+	ctx.cycles += 13;
+	ctx.PC = 0x0030;
+}
+
+static void block_0030(SiRecompiled::Context& ctx)
+{
+	// 0030  FE 99
+	{ uint8_t val = 0x99; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0032  CA 3E 00
+	ctx.PC = (ctx.flag_Z != 0) ? 0x003E : 0x0035;
+	ctx.cycles += 10;
+}
+
+static void block_0035(SiRecompiled::Context& ctx)
+{
+	// 0035  C6 01
+	{ uint8_t val = 0x01; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	ctx.PC = 0x0037;
+}
+
+static void block_0038(SiRecompiled::Context& ctx)
+{
+	// 0038  32 EB 20
+	ctx.write(0x20EB, ctx.A);
+	ctx.cycles += 13;
+	// 003B  CD 47 19
+	ctx.push(0x003E);
+	ctx.PC = 0x1947;
+	ctx.cycles += 17;
+}
+
+static void block_003E(SiRecompiled::Context& ctx)
+{
+	// 003E  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x003F;
+}
+
+static void block_003F(SiRecompiled::Context& ctx)
+{
+	// 003F  32 EA 20
+	ctx.write(0x20EA, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0042;
+}
+
+static void block_0042(SiRecompiled::Context& ctx)
+{
+	// 0042  3A E9 20
+	ctx.A = ctx.read(0x20E9);
+	ctx.cycles += 13;
+	// 0045  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0046  CA 82 00
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0082 : 0x0049;
+	ctx.cycles += 10;
+}
+
+static void block_0049(SiRecompiled::Context& ctx)
+{
+	// 0049  3A EF 20
+	ctx.A = ctx.read(0x20EF);
+	ctx.cycles += 13;
+	// 004C  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 004D  C2 6F 00
+	ctx.PC = (ctx.flag_Z == 0) ? 0x006F : 0x0050;
+	ctx.cycles += 10;
+}
+
+static void block_0050(SiRecompiled::Context& ctx)
+{
+	// 0050  3A EB 20
+	ctx.A = ctx.read(0x20EB);
+	ctx.cycles += 13;
+	// 0053  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0054  C2 5D 00
+	ctx.PC = (ctx.flag_Z == 0) ? 0x005D : 0x0057;
+	ctx.cycles += 10;
+}
+
+static void block_0057(SiRecompiled::Context& ctx)
+{
+	// 0057  CD BF 0A
+	ctx.push(0x005A);
+	ctx.PC = 0x0ABF;
+	ctx.cycles += 17;
+}
+
+static void block_005A(SiRecompiled::Context& ctx)
+{
+	// 005A  C3 82 00
+	ctx.PC = 0x0082;
+	ctx.cycles += 10;
+}
+
+static void block_005D(SiRecompiled::Context& ctx)
+{
+	// 005D  3A 93 20
+	ctx.A = ctx.read(0x2093);
+	ctx.cycles += 13;
+	// 0060  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0061  C2 82 00
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0082 : 0x0064;
+	ctx.cycles += 10;
+}
+
+static void block_0064(SiRecompiled::Context& ctx)
+{
+	// 0064  C3 65 07
+	ctx.PC = 0x0765;
+	ctx.cycles += 10;
+}
+
+static void block_0067(SiRecompiled::Context& ctx)
+{
+	// 0067  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 0069  32 EA 20
+	ctx.write(0x20EA, ctx.A);
+	ctx.cycles += 13;
+	// 006C  C3 3F 00
+	ctx.PC = 0x003F;
+	ctx.cycles += 10;
+}
+
+static void block_006F(SiRecompiled::Context& ctx)
+{
+	// 006F  CD 40 17
+	ctx.push(0x0072);
+	ctx.PC = 0x1740;
+	ctx.cycles += 17;
+}
+
+static void block_0072(SiRecompiled::Context& ctx)
+{
+	// 0072  3A 32 20
+	ctx.A = ctx.read(0x2032);
+	ctx.cycles += 13;
+	// 0075  32 80 20
+	ctx.write(0x2080, ctx.A);
+	ctx.cycles += 13;
+	// 0078  CD 00 01
+	ctx.push(0x007B);
+	ctx.PC = 0x0100;
+	ctx.cycles += 17;
+}
+
+static void block_007B(SiRecompiled::Context& ctx)
+{
+	// 007B  CD 48 02
+	ctx.push(0x007E);
+	ctx.PC = 0x0248;
+	ctx.cycles += 17;
+}
+
+static void block_007E(SiRecompiled::Context& ctx)
+{
+	// 007E  CD 13 09
+	ctx.push(0x0081);
+	ctx.PC = 0x0913;
+	ctx.cycles += 17;
+}
+
+static void block_0081(SiRecompiled::Context& ctx)
+{
+	// 0081  00
+	ctx.cycles += 4;
+	ctx.PC = 0x0082;
+}
+
+static void block_0082(SiRecompiled::Context& ctx)
+{
+	// 0082  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 0083  D1
+	ctx.setDE(ctx.pop());
+	ctx.cycles += 10;
+	// 0084  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	ctx.PC = 0x0085;
+}
+
+static void block_0087(SiRecompiled::Context& ctx)
+{
+	// 0087  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_008C(SiRecompiled::Context& ctx)
+{
+	// 008C  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 008D  32 72 20
+	ctx.write(0x2072, ctx.A);
+	ctx.cycles += 13;
+	// 0090  3A E9 20
+	ctx.A = ctx.read(0x20E9);
+	ctx.cycles += 13;
+	// 0093  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0094  CA 82 00
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0082 : 0x0097;
+	ctx.cycles += 10;
+}
+
+static void block_0097(SiRecompiled::Context& ctx)
+{
+	// 0097  3A EF 20
+	ctx.A = ctx.read(0x20EF);
+	ctx.cycles += 13;
+	// 009A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 009B  C2 A5 00
+	ctx.PC = (ctx.flag_Z == 0) ? 0x00A5 : 0x009E;
+	ctx.cycles += 10;
+}
+
+static void block_009E(SiRecompiled::Context& ctx)
+{
+	// 009E  3A C1 20
+	ctx.A = ctx.read(0x20C1);
+	ctx.cycles += 13;
+	// 00A1  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 00A2  D2 82 00
+	ctx.PC = (ctx.flag_C == 0) ? 0x0082 : 0x00A5;
+	ctx.cycles += 10;
+}
+
+static void block_00A5(SiRecompiled::Context& ctx)
+{
+	// 00A5  21 20 20
+	ctx.setHL(0x2020);
+	ctx.cycles += 10;
+	// 00A8  CD 4B 02
+	ctx.push(0x00AB);
+	ctx.PC = 0x024B;
+	ctx.cycles += 17;
+}
+
+static void block_00AB(SiRecompiled::Context& ctx)
+{
+	// 00AB  CD 41 01
+	ctx.push(0x00AE);
+	ctx.PC = 0x0141;
+	ctx.cycles += 17;
+}
+
+static void block_00AE(SiRecompiled::Context& ctx)
+{
+	// 00AE  C3 82 00
+	ctx.PC = 0x0082;
+	ctx.cycles += 10;
+}
+
+static void block_00B1(SiRecompiled::Context& ctx)
+{
+	// 00B1  CD 86 08
+	ctx.push(0x00B4);
+	ctx.PC = 0x0886;
+	ctx.cycles += 17;
+}
+
+static void block_00B4(SiRecompiled::Context& ctx)
+{
+	// 00B4  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 00B5  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 00B6  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 00B7  66
+	ctx.H = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 00B8  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 00B9  22 09 20
+	ctx.write(0x2009, ctx.L);
+	ctx.write(0x200A, ctx.H);
+	ctx.cycles += 16;
+	// 00BC  22 0B 20
+	ctx.write(0x200B, ctx.L);
+	ctx.write(0x200C, ctx.H);
+	ctx.cycles += 16;
+	// 00BF  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 00C0  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 00C1  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 00C2  FE 03
+	{ uint8_t val = 0x03; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 00C4  C2 C8 00
+	ctx.PC = (ctx.flag_Z == 0) ? 0x00C8 : 0x00C7;
+	ctx.cycles += 10;
+}
+
+static void block_00C7(SiRecompiled::Context& ctx)
+{
+	// 00C7  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	ctx.PC = 0x00C8;
+}
+
+static void block_00C8(SiRecompiled::Context& ctx)
+{
+	// 00C8  32 08 20
+	ctx.write(0x2008, ctx.A);
+	ctx.cycles += 13;
+	// 00CB  FE FE
+	{ uint8_t val = 0xFE; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 00CD  3E 00
+	ctx.A = 0x00;
+	ctx.cycles += 7;
+	// 00CF  C2 D3 00
+	ctx.PC = (ctx.flag_Z == 0) ? 0x00D3 : 0x00D2;
+	ctx.cycles += 10;
+}
+
+static void block_00D2(SiRecompiled::Context& ctx)
+{
+	// 00D2  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	ctx.PC = 0x00D3;
+}
+
+static void block_00D3(SiRecompiled::Context& ctx)
+{
+	// 00D3  32 0D 20
+	ctx.write(0x200D, ctx.A);
+	ctx.cycles += 13;
+	// 00D6  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_00D7(SiRecompiled::Context& ctx)
+{
+	// 00D7  3E 02
+	ctx.A = 0x02;
+	ctx.cycles += 7;
+	// 00D9  32 FB 21
+	ctx.write(0x21FB, ctx.A);
+	ctx.cycles += 13;
+	// 00DC  32 FB 22
+	ctx.write(0x22FB, ctx.A);
+	ctx.cycles += 13;
+	// 00DF  C3 E4 08
+	ctx.PC = 0x08E4;
+	ctx.cycles += 10;
+}
+
+static void block_0100(SiRecompiled::Context& ctx)
+{
+	// 0100  21 02 20
+	ctx.setHL(0x2002);
+	ctx.cycles += 10;
+	// 0103  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0104  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0105  C2 38 15
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1538 : 0x0108;
+	ctx.cycles += 10;
+}
+
+static void block_0108(SiRecompiled::Context& ctx)
+{
+	// 0108  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0109  3A 06 20
+	ctx.A = ctx.read(0x2006);
+	ctx.cycles += 13;
+	// 010C  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 010D  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 0110  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 0111  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0112  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0113  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 0114  CA 36 01
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0136 : 0x0117;
+	ctx.cycles += 10;
+}
+
+static void block_0117(SiRecompiled::Context& ctx)
+{
+	// 0117  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0118  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0119  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 011A  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 011B  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 011C  E6 FE
+	{ uint8_t res = ctx.A & 0xFE; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 011E  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 011F  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0120  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0121  5F
+	ctx.E = ctx.A;
+	ctx.cycles += 5;
+	// 0122  16 00
+	ctx.D = 0x00;
+	ctx.cycles += 7;
+	// 0124  21 00 1C
+	ctx.setHL(0x1C00);
+	ctx.cycles += 10;
+	// 0127  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 0128  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 0129  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 012A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 012B  C4 3B 01
+	if (ctx.flag_Z == 0) { ctx.push(0x012E); ctx.PC = 0x013B; ctx.cycles += 17; }
+	else { ctx.PC = 0x012E; ctx.cycles += 11; }
+}
+
+static void block_012E(SiRecompiled::Context& ctx)
+{
+	// 012E  2A 0B 20
+	ctx.L = ctx.read(0x200B);
+	ctx.H = ctx.read(0x200C);
+	ctx.cycles += 16;
+	// 0131  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 0133  CD D3 15
+	ctx.push(0x0136);
+	ctx.PC = 0x15D3;
+	ctx.cycles += 17;
+}
+
+static void block_0136(SiRecompiled::Context& ctx)
+{
+	// 0136  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0137  32 00 20
+	ctx.write(0x2000, ctx.A);
+	ctx.cycles += 13;
+	// 013A  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_013B(SiRecompiled::Context& ctx)
+{
+	// 013B  21 30 00
+	ctx.setHL(0x0030);
+	ctx.cycles += 10;
+	// 013E  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 013F  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 0140  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0141(SiRecompiled::Context& ctx)
+{
+	// 0141  3A 68 20
+	ctx.A = ctx.read(0x2068);
+	ctx.cycles += 13;
+	// 0144  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0145  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x0146; ctx.cycles += 5; }
+}
+
+static void block_0146(SiRecompiled::Context& ctx)
+{
+	// 0146  3A 00 20
+	ctx.A = ctx.read(0x2000);
+	ctx.cycles += 13;
+	// 0149  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 014A  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x014B; ctx.cycles += 5; }
+}
+
+static void block_014B(SiRecompiled::Context& ctx)
+{
+	// 014B  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 014E  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 014F  3A 06 20
+	ctx.A = ctx.read(0x2006);
+	ctx.cycles += 13;
+	// 0152  16 02
+	ctx.D = 0x02;
+	ctx.cycles += 7;
+	ctx.PC = 0x0154;
+}
+
+static void block_0154(SiRecompiled::Context& ctx)
+{
+	// 0154  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0155  FE 37
+	{ uint8_t val = 0x37; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0157  CC A1 01
+	if (ctx.flag_Z != 0) { ctx.push(0x015A); ctx.PC = 0x01A1; ctx.cycles += 17; }
+	else { ctx.PC = 0x015A; ctx.cycles += 11; }
+}
+
+static void block_015A(SiRecompiled::Context& ctx)
+{
+	// 015A  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 015B  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 015C  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 015D  C2 54 01
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0154 : 0x0160;
+	ctx.cycles += 10;
+}
+
+static void block_0160(SiRecompiled::Context& ctx)
+{
+	// 0160  32 06 20
+	ctx.write(0x2006, ctx.A);
+	ctx.cycles += 13;
+	// 0163  CD 7A 01
+	ctx.push(0x0166);
+	ctx.PC = 0x017A;
+	ctx.cycles += 17;
+}
+
+static void block_0166(SiRecompiled::Context& ctx)
+{
+	// 0166  61
+	ctx.H = ctx.C;
+	ctx.cycles += 5;
+	// 0167  22 0B 20
+	ctx.write(0x200B, ctx.L);
+	ctx.write(0x200C, ctx.H);
+	ctx.cycles += 16;
+	// 016A  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 016B  FE 28
+	{ uint8_t val = 0x28; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 016D  DA 71 19
+	ctx.PC = (ctx.flag_C != 0) ? 0x1971 : 0x0170;
+	ctx.cycles += 10;
+}
+
+static void block_0170(SiRecompiled::Context& ctx)
+{
+	// 0170  7A
+	ctx.A = ctx.D;
+	ctx.cycles += 5;
+	// 0171  32 04 20
+	ctx.write(0x2004, ctx.A);
+	ctx.cycles += 13;
+	// 0174  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 0176  32 00 20
+	ctx.write(0x2000, ctx.A);
+	ctx.cycles += 13;
+	// 0179  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_017A(SiRecompiled::Context& ctx)
+{
+	// 017A  16 00
+	ctx.D = 0x00;
+	ctx.cycles += 7;
+	// 017C  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 017D  21 09 20
+	ctx.setHL(0x2009);
+	ctx.cycles += 10;
+	// 0180  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0181  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0182  4E
+	ctx.C = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	ctx.PC = 0x0183;
+}
+
+static void block_0183(SiRecompiled::Context& ctx)
+{
+	// 0183  FE 0B
+	{ uint8_t val = 0x0B; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0185  FA 94 01
+	ctx.PC = (ctx.flag_S != 0) ? 0x0194 : 0x0188;
+	ctx.cycles += 10;
+}
+
+static void block_018A(SiRecompiled::Context& ctx)
+{
+	// 018A  5F
+	ctx.E = ctx.A;
+	ctx.cycles += 5;
+	// 018B  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 018C  C6 10
+	{ uint8_t val = 0x10; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 018E  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	// 018F  7B
+	ctx.A = ctx.E;
+	ctx.cycles += 5;
+	// 0190  14
+	{ uint8_t val = ctx.D; uint8_t res = (uint8_t)(val + 1);
+	  ctx.D = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0191  C3 83 01
+	ctx.PC = 0x0183;
+	ctx.cycles += 10;
+}
+
+static void block_0194(SiRecompiled::Context& ctx)
+{
+	// 0194  68
+	ctx.L = ctx.B;
+	ctx.cycles += 5;
+	ctx.PC = 0x0195;
+}
+
+static void block_0195(SiRecompiled::Context& ctx)
+{
+	// 0195  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0196  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x0197; ctx.cycles += 5; }
+}
+
+static void block_0197(SiRecompiled::Context& ctx)
+{
+	// 0197  5F
+	ctx.E = ctx.A;
+	ctx.cycles += 5;
+	// 0198  79
+	ctx.A = ctx.C;
+	ctx.cycles += 5;
+	// 0199  C6 10
+	{ uint8_t val = 0x10; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 019B  4F
+	ctx.C = ctx.A;
+	ctx.cycles += 5;
+	// 019C  7B
+	ctx.A = ctx.E;
+	ctx.cycles += 5;
+	// 019D  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 019E  C3 95 01
+	ctx.PC = 0x0195;
+	ctx.cycles += 10;
+}
+
+static void block_01A1(SiRecompiled::Context& ctx)
+{
+	// 01A1  15
+	{ uint8_t val = ctx.D; uint8_t res = (uint8_t)(val - 1);
+	  ctx.D = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 01A2  CA CD 01
+	ctx.PC = (ctx.flag_Z != 0) ? 0x01CD : 0x01A5;
+	ctx.cycles += 10;
+}
+
+static void block_01A5(SiRecompiled::Context& ctx)
+{
+	// 01A5  21 06 20
+	ctx.setHL(0x2006);
+	ctx.cycles += 10;
+	// 01A8  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 01AA  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 01AB  4E
+	ctx.C = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 01AC  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 01AE  CD D9 01
+	ctx.push(0x01B1);
+	ctx.PC = 0x01D9;
+	ctx.cycles += 17;
+}
+
+static void block_01B1(SiRecompiled::Context& ctx)
+{
+	// 01B1  21 05 20
+	ctx.setHL(0x2005);
+	ctx.cycles += 10;
+	// 01B4  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 01B5  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 01B6  E6 01
+	{ uint8_t res = ctx.A & 0x01; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 01B8  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 01B9  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 01BA  21 67 20
+	ctx.setHL(0x2067);
+	ctx.cycles += 10;
+	// 01BD  66
+	ctx.H = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 01BE  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_01C0(SiRecompiled::Context& ctx)
+{
+	// 01C0  21 00 21
+	ctx.setHL(0x2100);
+	ctx.cycles += 10;
+	ctx.PC = 0x01C3;
+}
+
+static void block_01C3(SiRecompiled::Context& ctx)
+{
+	// 01C3  06 37
+	ctx.B = 0x37;
+	ctx.cycles += 7;
+	ctx.PC = 0x01C5;
+}
+
+static void block_01C5(SiRecompiled::Context& ctx)
+{
+	// 01C5  36 01
+	ctx.write(ctx.getHL(), 0x01);
+	ctx.cycles += 10;
+	// 01C7  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 01C8  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 01C9  C2 C5 01
+	ctx.PC = (ctx.flag_Z == 0) ? 0x01C5 : 0x01CC;
+	ctx.cycles += 10;
+}
+
+static void block_01CC(SiRecompiled::Context& ctx)
+{
+	// 01CC  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_01CD(SiRecompiled::Context& ctx)
+{
+	// 01CD  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 01CE  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_01CF(SiRecompiled::Context& ctx)
+{
+	// 01CF  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 01D1  06 E0
+	ctx.B = 0xE0;
+	ctx.cycles += 7;
+	// 01D3  21 02 24
+	ctx.setHL(0x2402);
+	ctx.cycles += 10;
+	// 01D6  C3 CC 14
+	ctx.PC = 0x14CC;
+	ctx.cycles += 10;
+}
+
+static void block_01D9(SiRecompiled::Context& ctx)
+{
+	// 01D9  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 01DA  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 01DB  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 01DC  79
+	ctx.A = ctx.C;
+	ctx.cycles += 5;
+	// 01DD  86
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 01DE  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 01DF  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 01E0  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 01E1  86
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 01E2  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 01E3  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_01E4(SiRecompiled::Context& ctx)
+{
+	// 01E4  06 C0
+	ctx.B = 0xC0;
+	ctx.cycles += 7;
+	ctx.PC = 0x01E6;
+}
+
+static void block_01E6(SiRecompiled::Context& ctx)
+{
+	// 01E6  11 00 1B
+	ctx.setDE(0x1B00);
+	ctx.cycles += 10;
+	// 01E9  21 00 20
+	ctx.setHL(0x2000);
+	ctx.cycles += 10;
+	// 01EC  C3 32 1A
+	ctx.PC = 0x1A32;
+	ctx.cycles += 10;
+}
+
+static void block_01EF(SiRecompiled::Context& ctx)
+{
+	// 01EF  21 42 21
+	ctx.setHL(0x2142);
+	ctx.cycles += 10;
+	// 01F2  C3 F8 01
+	ctx.PC = 0x01F8;
+	ctx.cycles += 10;
+}
+
+static void block_01F5(SiRecompiled::Context& ctx)
+{
+	// 01F5  21 42 22
+	ctx.setHL(0x2242);
+	ctx.cycles += 10;
+	ctx.PC = 0x01F8;
+}
+
+static void block_01F8(SiRecompiled::Context& ctx)
+{
+	// 01F8  0E 04
+	ctx.C = 0x04;
+	ctx.cycles += 7;
+	// 01FA  11 20 1D
+	ctx.setDE(0x1D20);
+	ctx.cycles += 10;
+	ctx.PC = 0x01FD;
+}
+
+static void block_01FD(SiRecompiled::Context& ctx)
+{
+	// 01FD  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 01FE  06 2C
+	ctx.B = 0x2C;
+	ctx.cycles += 7;
+	// 0200  CD 32 1A
+	ctx.push(0x0203);
+	ctx.PC = 0x1A32;
+	ctx.cycles += 17;
+}
+
+static void block_0203(SiRecompiled::Context& ctx)
+{
+	// 0203  D1
+	ctx.setDE(ctx.pop());
+	ctx.cycles += 10;
+	// 0204  0D
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val - 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0205  C2 FD 01
+	ctx.PC = (ctx.flag_Z == 0) ? 0x01FD : 0x0208;
+	ctx.cycles += 10;
+}
+
+static void block_0208(SiRecompiled::Context& ctx)
+{
+	// 0208  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0209(SiRecompiled::Context& ctx)
+{
+	// 0209  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 020B  C3 1B 02
+	ctx.PC = 0x021B;
+	ctx.cycles += 10;
+}
+
+static void block_020E(SiRecompiled::Context& ctx)
+{
+	// 020E  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 0210  C3 14 02
+	ctx.PC = 0x0214;
+	ctx.cycles += 10;
+}
+
+static void block_0213(SiRecompiled::Context& ctx)
+{
+	// 0213  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x0214;
+}
+
+static void block_0214(SiRecompiled::Context& ctx)
+{
+	// 0214  11 42 22
+	ctx.setDE(0x2242);
+	ctx.cycles += 10;
+	// 0217  C3 1E 02
+	ctx.PC = 0x021E;
+	ctx.cycles += 10;
+}
+
+static void block_021A(SiRecompiled::Context& ctx)
+{
+	// 021A  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x021B;
+}
+
+static void block_021B(SiRecompiled::Context& ctx)
+{
+	// 021B  11 42 21
+	ctx.setDE(0x2142);
+	ctx.cycles += 10;
+	ctx.PC = 0x021E;
+}
+
+static void block_021E(SiRecompiled::Context& ctx)
+{
+	// 021E  32 81 20
+	ctx.write(0x2081, ctx.A);
+	ctx.cycles += 13;
+	// 0221  01 02 16
+	ctx.setBC(0x1602);
+	ctx.cycles += 10;
+	// 0224  21 06 28
+	ctx.setHL(0x2806);
+	ctx.cycles += 10;
+	// 0227  3E 04
+	ctx.A = 0x04;
+	ctx.cycles += 7;
+	ctx.PC = 0x0229;
+}
+
+static void block_022A(SiRecompiled::Context& ctx)
+{
+	// 022A  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 022B  3A 81 20
+	ctx.A = ctx.read(0x2081);
+	ctx.cycles += 13;
+	// 022E  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 022F  C2 42 02
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0242 : 0x0232;
+	ctx.cycles += 10;
+}
+
+static void block_0232(SiRecompiled::Context& ctx)
+{
+	// 0232  CD 69 1A
+	ctx.push(0x0235);
+	ctx.PC = 0x1A69;
+	ctx.cycles += 17;
+}
+
+static void block_0235(SiRecompiled::Context& ctx)
+{
+	// 0235  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	ctx.PC = 0x0236;
+}
+
+static void block_0237(SiRecompiled::Context& ctx)
+{
+	// 0237  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0238  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x0239; ctx.cycles += 5; }
+}
+
+static void block_0239(SiRecompiled::Context& ctx)
+{
+	// 0239  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 023A  11 E0 02
+	ctx.setDE(0x02E0);
+	ctx.cycles += 10;
+	// 023D  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 023E  D1
+	ctx.setDE(ctx.pop());
+	ctx.cycles += 10;
+	// 023F  C3 29 02
+	ctx.PC = 0x0229;
+	ctx.cycles += 10;
+}
+
+static void block_0242(SiRecompiled::Context& ctx)
+{
+	// 0242  CD 7C 14
+	ctx.push(0x0245);
+	ctx.PC = 0x147C;
+	ctx.cycles += 17;
+}
+
+static void block_0245(SiRecompiled::Context& ctx)
+{
+	// 0245  C3 35 02
+	ctx.PC = 0x0235;
+	ctx.cycles += 10;
+}
+
+static void block_0248(SiRecompiled::Context& ctx)
+{
+	// 0248  21 10 20
+	ctx.setHL(0x2010);
+	ctx.cycles += 10;
+	ctx.PC = 0x024B;
+}
+
+static void block_024B(SiRecompiled::Context& ctx)
+{
+	// 024B  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 024C  FE FF
+	{ uint8_t val = 0xFF; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 024E  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x024F; ctx.cycles += 5; }
+}
+
+static void block_024F(SiRecompiled::Context& ctx)
+{
+	// 024F  FE FE
+	{ uint8_t val = 0xFE; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0251  CA 81 02
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0281 : 0x0254;
+	ctx.cycles += 10;
+}
+
+static void block_0254(SiRecompiled::Context& ctx)
+{
+	// 0254  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0255  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0256  4F
+	ctx.C = ctx.A;
+	ctx.cycles += 5;
+	// 0257  B0
+	{ uint8_t res = ctx.A | ctx.B; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0258  79
+	ctx.A = ctx.C;
+	ctx.cycles += 5;
+	// 0259  C2 77 02
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0277 : 0x025C;
+	ctx.cycles += 10;
+}
+
+static void block_025C(SiRecompiled::Context& ctx)
+{
+	// 025C  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 025D  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 025E  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 025F  C2 88 02
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0288 : 0x0262;
+	ctx.cycles += 10;
+}
+
+static void block_0262(SiRecompiled::Context& ctx)
+{
+	// 0262  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0263  5E
+	ctx.E = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0264  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0265  56
+	ctx.D = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0266  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0267  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 0268  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0269  21 6F 02
+	ctx.setHL(0x026F);
+	ctx.cycles += 10;
+	// 026C  E3
+	{ uint8_t l = ctx.read(ctx.SP); uint8_t h = ctx.read((uint16_t)(ctx.SP + 1));
+	  ctx.write(ctx.SP, ctx.L); ctx.write((uint16_t)(ctx.SP + 1), ctx.H); ctx.H = h; ctx.L = l; }
+	ctx.cycles += 18;
+	// 026D  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 026E  E9
+	ctx.PC = ctx.getHL();
+	ctx.cycles += 5;
+}
+
+static void block_0277(SiRecompiled::Context& ctx)
+{
+	// 0277  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0278  04
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val + 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0279  C2 7D 02
+	ctx.PC = (ctx.flag_Z == 0) ? 0x027D : 0x027C;
+	ctx.cycles += 10;
+}
+
+static void block_027C(SiRecompiled::Context& ctx)
+{
+	// 027C  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	ctx.PC = 0x027D;
+}
+
+static void block_027D(SiRecompiled::Context& ctx)
+{
+	// 027D  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 027E  70
+	ctx.write(ctx.getHL(), ctx.B);
+	ctx.cycles += 7;
+	// 027F  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 0280  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	ctx.PC = 0x0281;
+}
+
+static void block_0281(SiRecompiled::Context& ctx)
+{
+	// 0281  11 10 00
+	ctx.setDE(0x0010);
+	ctx.cycles += 10;
+	// 0284  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 0285  C3 4B 02
+	ctx.PC = 0x024B;
+	ctx.cycles += 10;
+}
+
+static void block_0288(SiRecompiled::Context& ctx)
+{
+	// 0288  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 0289  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 028A  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 028B  C3 81 02
+	ctx.PC = 0x0281;
+	ctx.cycles += 10;
+}
+
+static void block_02ED(SiRecompiled::Context& ctx)
+{
+	// 02ED  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	ctx.PC = 0x02F0;
+}
+
+static void block_02F1(SiRecompiled::Context& ctx)
+{
+	// 02F1  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 02F2  DA 32 03
+	ctx.PC = (ctx.flag_C != 0) ? 0x0332 : 0x02F5;
+	ctx.cycles += 10;
+}
+
+static void block_02F5(SiRecompiled::Context& ctx)
+{
+	// 02F5  CD 0E 02
+	ctx.push(0x02F8);
+	ctx.PC = 0x020E;
+	ctx.cycles += 17;
+}
+
+static void block_02F8(SiRecompiled::Context& ctx)
+{
+	// 02F8  CD 78 08
+	ctx.push(0x02FB);
+	ctx.PC = 0x0878;
+	ctx.cycles += 17;
+}
+
+static void block_02FB(SiRecompiled::Context& ctx)
+{
+	// 02FB  73
+	ctx.write(ctx.getHL(), ctx.E);
+	ctx.cycles += 7;
+	// 02FC  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 02FD  72
+	ctx.write(ctx.getHL(), ctx.D);
+	ctx.cycles += 7;
+	// 02FE  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 02FF  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 0300  70
+	ctx.write(ctx.getHL(), ctx.B);
+	ctx.cycles += 7;
+	// 0301  00
+	ctx.cycles += 4;
+	// 0302  CD E4 01
+	ctx.push(0x0305);
+	ctx.PC = 0x01E4;
+	ctx.cycles += 17;
+}
+
+static void block_0306(SiRecompiled::Context& ctx)
+{
+	// 0306  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0307  3E 21
+	ctx.A = 0x21;
+	ctx.cycles += 7;
+	// 0309  06 00
+	ctx.B = 0x00;
+	ctx.cycles += 7;
+	// 030B  D2 12 03
+	ctx.PC = (ctx.flag_C == 0) ? 0x0312 : 0x030E;
+	ctx.cycles += 10;
+}
+
+static void block_030E(SiRecompiled::Context& ctx)
+{
+	// 030E  06 20
+	ctx.B = 0x20;
+	ctx.cycles += 7;
+	// 0310  3E 22
+	ctx.A = 0x22;
+	ctx.cycles += 7;
+	ctx.PC = 0x0312;
+}
+
+static void block_0312(SiRecompiled::Context& ctx)
+{
+	// 0312  32 67 20
+	ctx.write(0x2067, ctx.A);
+	ctx.cycles += 13;
+	// 0315  CD B6 0A
+	ctx.push(0x0318);
+	ctx.PC = 0x0AB6;
+	ctx.cycles += 17;
+}
+
+static void block_0318(SiRecompiled::Context& ctx)
+{
+	// 0318  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0319  32 11 20
+	ctx.write(0x2011, ctx.A);
+	ctx.cycles += 13;
+	// 031C  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 031D  D3 05
+	ctx.cycles += 10;
+	ctx.out(0x05);
+	// 031F  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0320  32 98 20
+	ctx.write(0x2098, ctx.A);
+	ctx.cycles += 13;
+	// 0323  CD D6 09
+	ctx.push(0x0326);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_0326(SiRecompiled::Context& ctx)
+{
+	// 0326  CD 7F 1A
+	ctx.push(0x0329);
+	ctx.PC = 0x1A7F;
+	ctx.cycles += 17;
+}
+
+static void block_0329(SiRecompiled::Context& ctx)
+{
+	// 0329  C3 F9 07
+	ctx.PC = 0x07F9;
+	ctx.cycles += 10;
+}
+
+static void block_0332(SiRecompiled::Context& ctx)
+{
+	// 0332  CD 09 02
+	ctx.push(0x0335);
+	ctx.PC = 0x0209;
+	ctx.cycles += 17;
+}
+
+static void block_0335(SiRecompiled::Context& ctx)
+{
+	// 0335  C3 F8 02
+	ctx.PC = 0x02F8;
+	ctx.cycles += 10;
+}
+
+static void block_0707(SiRecompiled::Context& ctx)
+{
+	// 0707  06 FE
+	ctx.B = 0xFE;
+	ctx.cycles += 7;
+	// 0709  C3 DC 19
+	ctx.PC = 0x19DC;
+	ctx.cycles += 10;
+}
+
+static void block_0765(SiRecompiled::Context& ctx)
+{
+	// 0765  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 0767  32 93 20
+	ctx.write(0x2093, ctx.A);
+	ctx.cycles += 13;
+	// 076A  31 00 24
+	ctx.SP = 0x2400;
+	ctx.cycles += 10;
+	ctx.PC = 0x076D;
+}
+
+static void block_076E(SiRecompiled::Context& ctx)
+{
+	// 076E  CD 79 19
+	ctx.push(0x0771);
+	ctx.PC = 0x1979;
+	ctx.cycles += 17;
+}
+
+static void block_0771(SiRecompiled::Context& ctx)
+{
+	// 0771  CD D6 09
+	ctx.push(0x0774);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_0774(SiRecompiled::Context& ctx)
+{
+	// 0774  21 13 30
+	ctx.setHL(0x3013);
+	ctx.cycles += 10;
+	// 0777  11 F3 1F
+	ctx.setDE(0x1FF3);
+	ctx.cycles += 10;
+	// 077A  0E 04
+	ctx.C = 0x04;
+	ctx.cycles += 7;
+	// 077C  CD F3 08
+	ctx.push(0x077F);
+	ctx.PC = 0x08F3;
+	ctx.cycles += 17;
+}
+
+static void block_077F(SiRecompiled::Context& ctx)
+{
+	// 077F  3A EB 20
+	ctx.A = ctx.read(0x20EB);
+	ctx.cycles += 13;
+	// 0782  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0783  21 10 28
+	ctx.setHL(0x2810);
+	ctx.cycles += 10;
+	// 0786  0E 14
+	ctx.C = 0x14;
+	ctx.cycles += 7;
+	// 0788  C2 57 08
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0857 : 0x078B;
+	ctx.cycles += 10;
+}
+
+static void block_078B(SiRecompiled::Context& ctx)
+{
+	// 078B  11 CF 1A
+	ctx.setDE(0x1ACF);
+	ctx.cycles += 10;
+	// 078E  CD F3 08
+	ctx.push(0x0791);
+	ctx.PC = 0x08F3;
+	ctx.cycles += 17;
+}
+
+static void block_0791(SiRecompiled::Context& ctx)
+{
+	// 0791  DB 01
+	ctx.in(0x01);
+	ctx.cycles += 10;
+	// 0793  E6 04
+	{ uint8_t res = ctx.A & 0x04; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0795  CA 7F 07
+	ctx.PC = (ctx.flag_Z != 0) ? 0x077F : 0x0798;
+	ctx.cycles += 10;
+}
+
+static void block_0798(SiRecompiled::Context& ctx)
+{
+	// 0798  06 99
+	ctx.B = 0x99;
+	ctx.cycles += 7;
+	// 079A  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x079B;
+}
+
+static void block_079B(SiRecompiled::Context& ctx)
+{
+	// 079B  32 CE 20
+	ctx.write(0x20CE, ctx.A);
+	ctx.cycles += 13;
+	// 079E  3A EB 20
+	ctx.A = ctx.read(0x20EB);
+	ctx.cycles += 13;
+	// 07A1  80
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x07A2;
+}
+
+static void block_07A3(SiRecompiled::Context& ctx)
+{
+	// 07A3  32 EB 20
+	ctx.write(0x20EB, ctx.A);
+	ctx.cycles += 13;
+	// 07A6  CD 47 19
+	ctx.push(0x07A9);
+	ctx.PC = 0x1947;
+	ctx.cycles += 17;
+}
+
+static void block_07A9(SiRecompiled::Context& ctx)
+{
+	// 07A9  21 00 00
+	ctx.setHL(0x0000);
+	ctx.cycles += 10;
+	// 07AC  22 F8 20
+	ctx.write(0x20F8, ctx.L);
+	ctx.write(0x20F9, ctx.H);
+	ctx.cycles += 16;
+	// 07AF  22 FC 20
+	ctx.write(0x20FC, ctx.L);
+	ctx.write(0x20FD, ctx.H);
+	ctx.cycles += 16;
+	// 07B2  CD 25 19
+	ctx.push(0x07B5);
+	ctx.PC = 0x1925;
+	ctx.cycles += 17;
+}
+
+static void block_07B5(SiRecompiled::Context& ctx)
+{
+	// 07B5  CD 2B 19
+	ctx.push(0x07B8);
+	ctx.PC = 0x192B;
+	ctx.cycles += 17;
+}
+
+static void block_07B8(SiRecompiled::Context& ctx)
+{
+	// 07B8  CD D7 19
+	ctx.push(0x07BB);
+	ctx.PC = 0x19D7;
+	ctx.cycles += 17;
+}
+
+static void block_07BB(SiRecompiled::Context& ctx)
+{
+	// 07BB  21 01 01
+	ctx.setHL(0x0101);
+	ctx.cycles += 10;
+	// 07BE  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 07BF  32 EF 20
+	ctx.write(0x20EF, ctx.A);
+	ctx.cycles += 13;
+	// 07C2  22 E7 20
+	ctx.write(0x20E7, ctx.L);
+	ctx.write(0x20E8, ctx.H);
+	ctx.cycles += 16;
+	// 07C5  22 E5 20
+	ctx.write(0x20E5, ctx.L);
+	ctx.write(0x20E6, ctx.H);
+	ctx.cycles += 16;
+	// 07C8  CD 56 19
+	ctx.push(0x07CB);
+	ctx.PC = 0x1956;
+	ctx.cycles += 17;
+}
+
+static void block_07CB(SiRecompiled::Context& ctx)
+{
+	// 07CB  CD EF 01
+	ctx.push(0x07CE);
+	ctx.PC = 0x01EF;
+	ctx.cycles += 17;
+}
+
+static void block_07CE(SiRecompiled::Context& ctx)
+{
+	// 07CE  CD F5 01
+	ctx.push(0x07D1);
+	ctx.PC = 0x01F5;
+	ctx.cycles += 17;
+}
+
+static void block_07D1(SiRecompiled::Context& ctx)
+{
+	// 07D1  CD D1 08
+	ctx.push(0x07D4);
+	ctx.PC = 0x08D1;
+	ctx.cycles += 17;
+}
+
+static void block_07D4(SiRecompiled::Context& ctx)
+{
+	// 07D4  32 FF 21
+	ctx.write(0x21FF, ctx.A);
+	ctx.cycles += 13;
+	// 07D7  32 FF 22
+	ctx.write(0x22FF, ctx.A);
+	ctx.cycles += 13;
+	// 07DA  CD D7 00
+	ctx.push(0x07DD);
+	ctx.PC = 0x00D7;
+	ctx.cycles += 17;
+}
+
+static void block_07DD(SiRecompiled::Context& ctx)
+{
+	// 07DD  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 07DE  32 FE 21
+	ctx.write(0x21FE, ctx.A);
+	ctx.cycles += 13;
+	// 07E1  32 FE 22
+	ctx.write(0x22FE, ctx.A);
+	ctx.cycles += 13;
+	// 07E4  CD C0 01
+	ctx.push(0x07E7);
+	ctx.PC = 0x01C0;
+	ctx.cycles += 17;
+}
+
+static void block_07E7(SiRecompiled::Context& ctx)
+{
+	// 07E7  CD 04 19
+	ctx.push(0x07EA);
+	ctx.PC = 0x1904;
+	ctx.cycles += 17;
+}
+
+static void block_07EA(SiRecompiled::Context& ctx)
+{
+	// 07EA  21 78 38
+	ctx.setHL(0x3878);
+	ctx.cycles += 10;
+	// 07ED  22 FC 21
+	ctx.write(0x21FC, ctx.L);
+	ctx.write(0x21FD, ctx.H);
+	ctx.cycles += 16;
+	// 07F0  22 FC 22
+	ctx.write(0x22FC, ctx.L);
+	ctx.write(0x22FD, ctx.H);
+	ctx.cycles += 16;
+	// 07F3  CD E4 01
+	ctx.push(0x07F6);
+	ctx.PC = 0x01E4;
+	ctx.cycles += 17;
+}
+
+static void block_07F6(SiRecompiled::Context& ctx)
+{
+	// 07F6  CD 7F 1A
+	ctx.push(0x07F9);
+	ctx.PC = 0x1A7F;
+	ctx.cycles += 17;
+}
+
+static void block_07F9(SiRecompiled::Context& ctx)
+{
+	// 07F9  CD 8D 08
+	ctx.push(0x07FC);
+	ctx.PC = 0x088D;
+	ctx.cycles += 17;
+}
+
+static void block_07FC(SiRecompiled::Context& ctx)
+{
+	// 07FC  CD D6 09
+	ctx.push(0x07FF);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_07FF(SiRecompiled::Context& ctx)
+{
+	// 07FF  00
+	ctx.cycles += 4;
+	// 0800  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0801  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0804;
+}
+
+static void block_0804(SiRecompiled::Context& ctx)
+{
+	// 0804  CD CF 01
+	ctx.push(0x0807);
+	ctx.PC = 0x01CF;
+	ctx.cycles += 17;
+}
+
+static void block_0807(SiRecompiled::Context& ctx)
+{
+	// 0807  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 080A  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 080B  DA 72 08
+	ctx.PC = (ctx.flag_C != 0) ? 0x0872 : 0x080E;
+	ctx.cycles += 10;
+}
+
+static void block_080E(SiRecompiled::Context& ctx)
+{
+	// 080E  CD 13 02
+	ctx.push(0x0811);
+	ctx.PC = 0x0213;
+	ctx.cycles += 17;
+}
+
+static void block_0811(SiRecompiled::Context& ctx)
+{
+	// 0811  CD CF 01
+	ctx.push(0x0814);
+	ctx.PC = 0x01CF;
+	ctx.cycles += 17;
+}
+
+static void block_0814(SiRecompiled::Context& ctx)
+{
+	// 0814  CD B1 00
+	ctx.push(0x0817);
+	ctx.PC = 0x00B1;
+	ctx.cycles += 17;
+}
+
+static void block_0817(SiRecompiled::Context& ctx)
+{
+	// 0817  CD D1 19
+	ctx.push(0x081A);
+	ctx.PC = 0x19D1;
+	ctx.cycles += 17;
+}
+
+static void block_081A(SiRecompiled::Context& ctx)
+{
+	// 081A  06 20
+	ctx.B = 0x20;
+	ctx.cycles += 7;
+	// 081C  CD FA 18
+	ctx.push(0x081F);
+	ctx.PC = 0x18FA;
+	ctx.cycles += 17;
+}
+
+static void block_081F(SiRecompiled::Context& ctx)
+{
+	// 081F  CD 18 16
+	ctx.push(0x0822);
+	ctx.PC = 0x1618;
+	ctx.cycles += 17;
+}
+
+static void block_0822(SiRecompiled::Context& ctx)
+{
+	// 0822  CD 0A 19
+	ctx.push(0x0825);
+	ctx.PC = 0x190A;
+	ctx.cycles += 17;
+}
+
+static void block_0825(SiRecompiled::Context& ctx)
+{
+	// 0825  CD F3 15
+	ctx.push(0x0828);
+	ctx.PC = 0x15F3;
+	ctx.cycles += 17;
+}
+
+static void block_0828(SiRecompiled::Context& ctx)
+{
+	// 0828  CD 88 09
+	ctx.push(0x082B);
+	ctx.PC = 0x0988;
+	ctx.cycles += 17;
+}
+
+static void block_082B(SiRecompiled::Context& ctx)
+{
+	// 082B  3A 82 20
+	ctx.A = ctx.read(0x2082);
+	ctx.cycles += 13;
+	// 082E  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 082F  CA EF 09
+	ctx.PC = (ctx.flag_Z != 0) ? 0x09EF : 0x0832;
+	ctx.cycles += 10;
+}
+
+static void block_0832(SiRecompiled::Context& ctx)
+{
+	// 0832  CD 0E 17
+	ctx.push(0x0835);
+	ctx.PC = 0x170E;
+	ctx.cycles += 17;
+}
+
+static void block_0835(SiRecompiled::Context& ctx)
+{
+	// 0835  CD 35 09
+	ctx.push(0x0838);
+	ctx.PC = 0x0935;
+	ctx.cycles += 17;
+}
+
+static void block_0838(SiRecompiled::Context& ctx)
+{
+	// 0838  CD D8 08
+	ctx.push(0x083B);
+	ctx.PC = 0x08D8;
+	ctx.cycles += 17;
+}
+
+static void block_083B(SiRecompiled::Context& ctx)
+{
+	// 083B  CD 2C 17
+	ctx.push(0x083E);
+	ctx.PC = 0x172C;
+	ctx.cycles += 17;
+}
+
+static void block_083E(SiRecompiled::Context& ctx)
+{
+	// 083E  CD 59 0A
+	ctx.push(0x0841);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_0841(SiRecompiled::Context& ctx)
+{
+	// 0841  CA 49 08
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0849 : 0x0844;
+	ctx.cycles += 10;
+}
+
+static void block_0844(SiRecompiled::Context& ctx)
+{
+	// 0844  06 04
+	ctx.B = 0x04;
+	ctx.cycles += 7;
+	// 0846  CD FA 18
+	ctx.push(0x0849);
+	ctx.PC = 0x18FA;
+	ctx.cycles += 17;
+}
+
+static void block_0849(SiRecompiled::Context& ctx)
+{
+	// 0849  CD 75 17
+	ctx.push(0x084C);
+	ctx.PC = 0x1775;
+	ctx.cycles += 17;
+}
+
+static void block_084C(SiRecompiled::Context& ctx)
+{
+	// 084C  D3 06
+	ctx.cycles += 10;
+	ctx.out(0x06);
+	// 084E  CD 04 18
+	ctx.push(0x0851);
+	ctx.PC = 0x1804;
+	ctx.cycles += 17;
+}
+
+static void block_0851(SiRecompiled::Context& ctx)
+{
+	// 0851  C3 1F 08
+	ctx.PC = 0x081F;
+	ctx.cycles += 10;
+}
+
+static void block_0857(SiRecompiled::Context& ctx)
+{
+	// 0857  11 BA 1A
+	ctx.setDE(0x1ABA);
+	ctx.cycles += 10;
+	// 085A  CD F3 08
+	ctx.push(0x085D);
+	ctx.PC = 0x08F3;
+	ctx.cycles += 17;
+}
+
+static void block_085D(SiRecompiled::Context& ctx)
+{
+	// 085D  06 98
+	ctx.B = 0x98;
+	ctx.cycles += 7;
+	// 085F  DB 01
+	ctx.in(0x01);
+	ctx.cycles += 10;
+	// 0861  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0862  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0863  DA 6D 08
+	ctx.PC = (ctx.flag_C != 0) ? 0x086D : 0x0866;
+	ctx.cycles += 10;
+}
+
+static void block_0866(SiRecompiled::Context& ctx)
+{
+	// 0866  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0867  DA 98 07
+	ctx.PC = (ctx.flag_C != 0) ? 0x0798 : 0x086A;
+	ctx.cycles += 10;
+}
+
+static void block_086A(SiRecompiled::Context& ctx)
+{
+	// 086A  C3 7F 07
+	ctx.PC = 0x077F;
+	ctx.cycles += 10;
+}
+
+static void block_086D(SiRecompiled::Context& ctx)
+{
+	// 086D  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 086F  C3 9B 07
+	ctx.PC = 0x079B;
+	ctx.cycles += 10;
+}
+
+static void block_0872(SiRecompiled::Context& ctx)
+{
+	// 0872  CD 1A 02
+	ctx.push(0x0875);
+	ctx.PC = 0x021A;
+	ctx.cycles += 17;
+}
+
+static void block_0875(SiRecompiled::Context& ctx)
+{
+	// 0875  C3 14 08
+	ctx.PC = 0x0814;
+	ctx.cycles += 10;
+}
+
+static void block_0878(SiRecompiled::Context& ctx)
+{
+	// 0878  3A 08 20
+	ctx.A = ctx.read(0x2008);
+	ctx.cycles += 13;
+	// 087B  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	// 087C  2A 09 20
+	ctx.L = ctx.read(0x2009);
+	ctx.H = ctx.read(0x200A);
+	ctx.cycles += 16;
+	// 087F  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 0880  C3 86 08
+	ctx.PC = 0x0886;
+	ctx.cycles += 10;
+}
+
+static void block_0886(SiRecompiled::Context& ctx)
+{
+	// 0886  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 0889  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 088A  2E FC
+	ctx.L = 0xFC;
+	ctx.cycles += 7;
+	// 088C  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_088D(SiRecompiled::Context& ctx)
+{
+	// 088D  21 11 2B
+	ctx.setHL(0x2B11);
+	ctx.cycles += 10;
+	// 0890  11 70 1B
+	ctx.setDE(0x1B70);
+	ctx.cycles += 10;
+	// 0893  0E 0E
+	ctx.C = 0x0E;
+	ctx.cycles += 7;
+	// 0895  CD F3 08
+	ctx.push(0x0898);
+	ctx.PC = 0x08F3;
+	ctx.cycles += 17;
+}
+
+static void block_0898(SiRecompiled::Context& ctx)
+{
+	// 0898  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 089B  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 089C  3E 1C
+	ctx.A = 0x1C;
+	ctx.cycles += 7;
+	// 089E  21 11 37
+	ctx.setHL(0x3711);
+	ctx.cycles += 10;
+	// 08A1  D4 FF 08
+	if (ctx.flag_C == 0) { ctx.push(0x08A4); ctx.PC = 0x08FF; ctx.cycles += 17; }
+	else { ctx.PC = 0x08A4; ctx.cycles += 11; }
+}
+
+static void block_08A4(SiRecompiled::Context& ctx)
+{
+	// 08A4  3E B0
+	ctx.A = 0xB0;
+	ctx.cycles += 7;
+	// 08A6  32 C0 20
+	ctx.write(0x20C0, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x08A9;
+}
+
+static void block_08A9(SiRecompiled::Context& ctx)
+{
+	// 08A9  3A C0 20
+	ctx.A = ctx.read(0x20C0);
+	ctx.cycles += 13;
+	// 08AC  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 08AD  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x08AE; ctx.cycles += 5; }
+}
+
+static void block_08AE(SiRecompiled::Context& ctx)
+{
+	// 08AE  E6 04
+	{ uint8_t res = ctx.A & 0x04; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 08B0  C2 BC 08
+	ctx.PC = (ctx.flag_Z == 0) ? 0x08BC : 0x08B3;
+	ctx.cycles += 10;
+}
+
+static void block_08B3(SiRecompiled::Context& ctx)
+{
+	// 08B3  CD CA 09
+	ctx.push(0x08B6);
+	ctx.PC = 0x09CA;
+	ctx.cycles += 17;
+}
+
+static void block_08B6(SiRecompiled::Context& ctx)
+{
+	// 08B6  CD 31 19
+	ctx.push(0x08B9);
+	ctx.PC = 0x1931;
+	ctx.cycles += 17;
+}
+
+static void block_08B9(SiRecompiled::Context& ctx)
+{
+	// 08B9  C3 A9 08
+	ctx.PC = 0x08A9;
+	ctx.cycles += 10;
+}
+
+static void block_08BC(SiRecompiled::Context& ctx)
+{
+	// 08BC  06 20
+	ctx.B = 0x20;
+	ctx.cycles += 7;
+	// 08BE  21 1C 27
+	ctx.setHL(0x271C);
+	ctx.cycles += 10;
+	// 08C1  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 08C4  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 08C5  DA CB 08
+	ctx.PC = (ctx.flag_C != 0) ? 0x08CB : 0x08C8;
+	ctx.cycles += 10;
+}
+
+static void block_08C8(SiRecompiled::Context& ctx)
+{
+	// 08C8  21 1C 39
+	ctx.setHL(0x391C);
+	ctx.cycles += 10;
+	ctx.PC = 0x08CB;
+}
+
+static void block_08CB(SiRecompiled::Context& ctx)
+{
+	// 08CB  CD CB 14
+	ctx.push(0x08CE);
+	ctx.PC = 0x14CB;
+	ctx.cycles += 17;
+}
+
+static void block_08CE(SiRecompiled::Context& ctx)
+{
+	// 08CE  C3 A9 08
+	ctx.PC = 0x08A9;
+	ctx.cycles += 10;
+}
+
+static void block_08D1(SiRecompiled::Context& ctx)
+{
+	// 08D1  DB 02
+	ctx.in(0x02);
+	ctx.cycles += 10;
+	// 08D3  E6 03
+	{ uint8_t res = ctx.A & 0x03; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 08D5  C6 03
+	{ uint8_t val = 0x03; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 08D7  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_08D8(SiRecompiled::Context& ctx)
+{
+	// 08D8  3A 82 20
+	ctx.A = ctx.read(0x2082);
+	ctx.cycles += 13;
+	// 08DB  FE 09
+	{ uint8_t val = 0x09; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 08DD  D0
+	if (ctx.flag_C == 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x08DE; ctx.cycles += 5; }
+}
+
+static void block_08DE(SiRecompiled::Context& ctx)
+{
+	// 08DE  3E FB
+	ctx.A = 0xFB;
+	ctx.cycles += 7;
+	// 08E0  32 7E 20
+	ctx.write(0x207E, ctx.A);
+	ctx.cycles += 13;
+	// 08E3  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_08E4(SiRecompiled::Context& ctx)
+{
+	// 08E4  3A CE 20
+	ctx.A = ctx.read(0x20CE);
+	ctx.cycles += 13;
+	// 08E7  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 08E8  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x08E9; ctx.cycles += 5; }
+}
+
+static void block_08E9(SiRecompiled::Context& ctx)
+{
+	// 08E9  21 1C 39
+	ctx.setHL(0x391C);
+	ctx.cycles += 10;
+	// 08EC  06 20
+	ctx.B = 0x20;
+	ctx.cycles += 7;
+	// 08EE  C3 CB 14
+	ctx.PC = 0x14CB;
+	ctx.cycles += 10;
+}
+
+static void block_08F3(SiRecompiled::Context& ctx)
+{
+	// 08F3  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 08F4  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 08F5  CD FF 08
+	ctx.push(0x08F8);
+	ctx.PC = 0x08FF;
+	ctx.cycles += 17;
+}
+
+static void block_08F8(SiRecompiled::Context& ctx)
+{
+	// 08F8  D1
+	ctx.setDE(ctx.pop());
+	ctx.cycles += 10;
+	// 08F9  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 08FA  0D
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val - 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 08FB  C2 F3 08
+	ctx.PC = (ctx.flag_Z == 0) ? 0x08F3 : 0x08FE;
+	ctx.cycles += 10;
+}
+
+static void block_08FE(SiRecompiled::Context& ctx)
+{
+	// 08FE  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_08FF(SiRecompiled::Context& ctx)
+{
+	// 08FF  11 00 1E
+	ctx.setDE(0x1E00);
+	ctx.cycles += 10;
+	// 0902  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0903  26 00
+	ctx.H = 0x00;
+	ctx.cycles += 7;
+	// 0905  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 0906  29
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getHL(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 0907  29
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getHL(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 0908  29
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getHL(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 0909  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 090A  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 090B  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 090C  06 08
+	ctx.B = 0x08;
+	ctx.cycles += 7;
+	// 090E  D3 06
+	ctx.cycles += 10;
+	ctx.out(0x06);
+	// 0910  C3 39 14
+	ctx.PC = 0x1439;
+	ctx.cycles += 10;
+}
+
+static void block_0913(SiRecompiled::Context& ctx)
+{
+	// 0913  3A 09 20
+	ctx.A = ctx.read(0x2009);
+	ctx.cycles += 13;
+	// 0916  FE 78
+	{ uint8_t val = 0x78; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0918  D0
+	if (ctx.flag_C == 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x0919; ctx.cycles += 5; }
+}
+
+static void block_0919(SiRecompiled::Context& ctx)
+{
+	// 0919  2A 91 20
+	ctx.L = ctx.read(0x2091);
+	ctx.H = ctx.read(0x2092);
+	ctx.cycles += 16;
+	// 091C  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 091D  B4
+	{ uint8_t res = ctx.A | ctx.H; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 091E  C2 29 09
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0929 : 0x0921;
+	ctx.cycles += 10;
+}
+
+static void block_0921(SiRecompiled::Context& ctx)
+{
+	// 0921  21 00 06
+	ctx.setHL(0x0600);
+	ctx.cycles += 10;
+	// 0924  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 0926  32 83 20
+	ctx.write(0x2083, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0929;
+}
+
+static void block_0929(SiRecompiled::Context& ctx)
+{
+	// 0929  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 092A  22 91 20
+	ctx.write(0x2091, ctx.L);
+	ctx.write(0x2092, ctx.H);
+	ctx.cycles += 16;
+	// 092D  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_092E(SiRecompiled::Context& ctx)
+{
+	// 092E  CD 11 16
+	ctx.push(0x0931);
+	ctx.PC = 0x1611;
+	ctx.cycles += 17;
+}
+
+static void block_0931(SiRecompiled::Context& ctx)
+{
+	// 0931  2E FF
+	ctx.L = 0xFF;
+	ctx.cycles += 7;
+	// 0933  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0934  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0935(SiRecompiled::Context& ctx)
+{
+	// 0935  CD 10 19
+	ctx.push(0x0938);
+	ctx.PC = 0x1910;
+	ctx.cycles += 17;
+}
+
+static void block_0938(SiRecompiled::Context& ctx)
+{
+	// 0938  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 0939  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 093A  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 093B  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 093C  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x093D; ctx.cycles += 5; }
+}
+
+static void block_093D(SiRecompiled::Context& ctx)
+{
+	// 093D  06 15
+	ctx.B = 0x15;
+	ctx.cycles += 7;
+	// 093F  DB 02
+	ctx.in(0x02);
+	ctx.cycles += 10;
+	// 0941  E6 08
+	{ uint8_t res = ctx.A & 0x08; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0943  CA 48 09
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0948 : 0x0946;
+	ctx.cycles += 10;
+}
+
+static void block_0946(SiRecompiled::Context& ctx)
+{
+	// 0946  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	ctx.PC = 0x0948;
+}
+
+static void block_0948(SiRecompiled::Context& ctx)
+{
+	// 0948  CD CA 09
+	ctx.push(0x094B);
+	ctx.PC = 0x09CA;
+	ctx.cycles += 17;
+}
+
+static void block_094B(SiRecompiled::Context& ctx)
+{
+	// 094B  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 094C  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 094D  B8
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 094E  D8
+	if (ctx.flag_C != 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x094F; ctx.cycles += 5; }
+}
+
+static void block_094F(SiRecompiled::Context& ctx)
+{
+	// 094F  CD 2E 09
+	ctx.push(0x0952);
+	ctx.PC = 0x092E;
+	ctx.cycles += 17;
+}
+
+static void block_0952(SiRecompiled::Context& ctx)
+{
+	// 0952  34
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val + 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 0953  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	ctx.PC = 0x0954;
+}
+
+static void block_0955(SiRecompiled::Context& ctx)
+{
+	// 0955  21 01 25
+	ctx.setHL(0x2501);
+	ctx.cycles += 10;
+	ctx.PC = 0x0958;
+}
+
+static void block_0958(SiRecompiled::Context& ctx)
+{
+	// 0958  24
+	{ uint8_t val = ctx.H; uint8_t res = (uint8_t)(val + 1);
+	  ctx.H = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0959  24
+	{ uint8_t val = ctx.H; uint8_t res = (uint8_t)(val + 1);
+	  ctx.H = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 095A  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 095B  C2 58 09
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0958 : 0x095E;
+	ctx.cycles += 10;
+}
+
+static void block_095E(SiRecompiled::Context& ctx)
+{
+	// 095E  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 0960  11 60 1C
+	ctx.setDE(0x1C60);
+	ctx.cycles += 10;
+	// 0963  CD 39 14
+	ctx.push(0x0966);
+	ctx.PC = 0x1439;
+	ctx.cycles += 17;
+}
+
+static void block_0967(SiRecompiled::Context& ctx)
+{
+	// 0967  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0968  CD 8B 1A
+	ctx.push(0x096B);
+	ctx.PC = 0x1A8B;
+	ctx.cycles += 17;
+}
+
+static void block_096B(SiRecompiled::Context& ctx)
+{
+	// 096B  CD 10 19
+	ctx.push(0x096E);
+	ctx.PC = 0x1910;
+	ctx.cycles += 17;
+}
+
+static void block_096E(SiRecompiled::Context& ctx)
+{
+	// 096E  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 096F  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 0970  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 0972  3E FF
+	ctx.A = 0xFF;
+	ctx.cycles += 7;
+	// 0974  32 99 20
+	ctx.write(0x2099, ctx.A);
+	ctx.cycles += 13;
+	// 0977  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 0979  C3 FA 18
+	ctx.PC = 0x18FA;
+	ctx.cycles += 10;
+}
+
+static void block_097C(SiRecompiled::Context& ctx)
+{
+	// 097C  21 A0 1D
+	ctx.setHL(0x1DA0);
+	ctx.cycles += 10;
+	// 097F  FE 02
+	{ uint8_t val = 0x02; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0981  D8
+	if (ctx.flag_C != 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x0982; ctx.cycles += 5; }
+}
+
+static void block_0982(SiRecompiled::Context& ctx)
+{
+	// 0982  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0983  FE 04
+	{ uint8_t val = 0x04; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0985  D8
+	if (ctx.flag_C != 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x0986; ctx.cycles += 5; }
+}
+
+static void block_0986(SiRecompiled::Context& ctx)
+{
+	// 0986  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0987  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0988(SiRecompiled::Context& ctx)
+{
+	// 0988  CD CA 09
+	ctx.push(0x098B);
+	ctx.PC = 0x09CA;
+	ctx.cycles += 17;
+}
+
+static void block_098B(SiRecompiled::Context& ctx)
+{
+	// 098B  3A F1 20
+	ctx.A = ctx.read(0x20F1);
+	ctx.cycles += 13;
+	// 098E  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 098F  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x0990; ctx.cycles += 5; }
+}
+
+static void block_0990(SiRecompiled::Context& ctx)
+{
+	// 0990  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0991  32 F1 20
+	ctx.write(0x20F1, ctx.A);
+	ctx.cycles += 13;
+	// 0994  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0995  2A F2 20
+	ctx.L = ctx.read(0x20F2);
+	ctx.H = ctx.read(0x20F3);
+	ctx.cycles += 16;
+	// 0998  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 0999  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 099A  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 099B  83
+	{ uint8_t val = ctx.E; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x099C;
+}
+
+static void block_099D(SiRecompiled::Context& ctx)
+{
+	// 099D  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 099E  5F
+	ctx.E = ctx.A;
+	ctx.cycles += 5;
+	// 099F  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 09A0  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 09A1  8A
+	{ uint8_t val = ctx.D; uint8_t a = (uint8_t)(ctx.A + ctx.flag_C); uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x09A2;
+}
+
+static void block_09A3(SiRecompiled::Context& ctx)
+{
+	// 09A3  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 09A4  57
+	ctx.D = ctx.A;
+	ctx.cycles += 5;
+	// 09A5  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 09A6  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 09A7  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 09A8  66
+	ctx.H = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 09A9  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 09AA  C3 AD 09
+	ctx.PC = 0x09AD;
+	ctx.cycles += 10;
+}
+
+static void block_09AD(SiRecompiled::Context& ctx)
+{
+	// 09AD  7A
+	ctx.A = ctx.D;
+	ctx.cycles += 5;
+	// 09AE  CD B2 09
+	ctx.push(0x09B1);
+	ctx.PC = 0x09B2;
+	ctx.cycles += 17;
+}
+
+static void block_09B1(SiRecompiled::Context& ctx)
+{
+	// 09B1  7B
+	ctx.A = ctx.E;
+	ctx.cycles += 5;
+	ctx.PC = 0x09B2;
+}
+
+static void block_09B2(SiRecompiled::Context& ctx)
+{
+	// 09B2  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	ctx.PC = 0x09B3;
+}
+
+static void block_09B4(SiRecompiled::Context& ctx)
+{
+	// 09B4  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 09B5  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 09B6  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 09B7  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 09B8  E6 0F
+	{ uint8_t res = ctx.A & 0x0F; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 09BA  CD C5 09
+	ctx.push(0x09BD);
+	ctx.PC = 0x09C5;
+	ctx.cycles += 17;
+}
+
+static void block_09BE(SiRecompiled::Context& ctx)
+{
+	// 09BE  E6 0F
+	{ uint8_t res = ctx.A & 0x0F; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 09C0  CD C5 09
+	ctx.push(0x09C3);
+	ctx.PC = 0x09C5;
+	ctx.cycles += 17;
+}
+
+static void block_09C3(SiRecompiled::Context& ctx)
+{
+	// 09C3  D1
+	ctx.setDE(ctx.pop());
+	ctx.cycles += 10;
+	// 09C4  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_09C5(SiRecompiled::Context& ctx)
+{
+	// 09C5  C6 1A
+	{ uint8_t val = 0x1A; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 09C7  C3 FF 08
+	ctx.PC = 0x08FF;
+	ctx.cycles += 10;
+}
+
+static void block_09CA(SiRecompiled::Context& ctx)
+{
+	// 09CA  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 09CD  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 09CE  21 F8 20
+	ctx.setHL(0x20F8);
+	ctx.cycles += 10;
+	// 09D1  D8
+	if (ctx.flag_C != 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x09D2; ctx.cycles += 5; }
+}
+
+static void block_09D2(SiRecompiled::Context& ctx)
+{
+	// 09D2  21 FC 20
+	ctx.setHL(0x20FC);
+	ctx.cycles += 10;
+	// 09D5  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_09D6(SiRecompiled::Context& ctx)
+{
+	// 09D6  21 02 24
+	ctx.setHL(0x2402);
+	ctx.cycles += 10;
+	ctx.PC = 0x09D9;
+}
+
+static void block_09D9(SiRecompiled::Context& ctx)
+{
+	// 09D9  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 09DB  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 09DC  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 09DD  E6 1F
+	{ uint8_t res = ctx.A & 0x1F; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 09DF  FE 1C
+	{ uint8_t val = 0x1C; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 09E1  DA E8 09
+	ctx.PC = (ctx.flag_C != 0) ? 0x09E8 : 0x09E4;
+	ctx.cycles += 10;
+}
+
+static void block_09E4(SiRecompiled::Context& ctx)
+{
+	// 09E4  11 06 00
+	ctx.setDE(0x0006);
+	ctx.cycles += 10;
+	// 09E7  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	ctx.PC = 0x09E8;
+}
+
+static void block_09E8(SiRecompiled::Context& ctx)
+{
+	// 09E8  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 09E9  FE 40
+	{ uint8_t val = 0x40; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 09EB  DA D9 09
+	ctx.PC = (ctx.flag_C != 0) ? 0x09D9 : 0x09EE;
+	ctx.cycles += 10;
+}
+
+static void block_09EE(SiRecompiled::Context& ctx)
+{
+	// 09EE  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_09EF(SiRecompiled::Context& ctx)
+{
+	// 09EF  CD 3C 0A
+	ctx.push(0x09F2);
+	ctx.PC = 0x0A3C;
+	ctx.cycles += 17;
+}
+
+static void block_09F2(SiRecompiled::Context& ctx)
+{
+	// 09F2  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 09F3  32 E9 20
+	ctx.write(0x20E9, ctx.A);
+	ctx.cycles += 13;
+	// 09F6  CD D6 09
+	ctx.push(0x09F9);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_09F9(SiRecompiled::Context& ctx)
+{
+	// 09F9  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	ctx.PC = 0x09FC;
+}
+
+static void block_09FD(SiRecompiled::Context& ctx)
+{
+	// 09FD  CD E4 01
+	ctx.push(0x0A00);
+	ctx.PC = 0x01E4;
+	ctx.cycles += 17;
+}
+
+static void block_0A01(SiRecompiled::Context& ctx)
+{
+	// 0A01  32 67 20
+	ctx.write(0x2067, ctx.A);
+	ctx.cycles += 13;
+	// 0A04  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 0A07  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 0A08  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 0A09  2E FE
+	ctx.L = 0xFE;
+	ctx.cycles += 7;
+	// 0A0B  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0A0C  E6 07
+	{ uint8_t res = ctx.A & 0x07; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0A0E  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0A0F  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 0A10  21 A2 1D
+	ctx.setHL(0x1DA2);
+	ctx.cycles += 10;
+	ctx.PC = 0x0A13;
+}
+
+static void block_0A13(SiRecompiled::Context& ctx)
+{
+	// 0A13  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0A14  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0A15  C2 13 0A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0A13 : 0x0A18;
+	ctx.cycles += 10;
+}
+
+static void block_0A18(SiRecompiled::Context& ctx)
+{
+	// 0A18  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0A19  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 0A1A  2E FC
+	ctx.L = 0xFC;
+	ctx.cycles += 7;
+	// 0A1C  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 0A1D  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 0A1E  36 38
+	ctx.write(ctx.getHL(), 0x38);
+	ctx.cycles += 10;
+	// 0A20  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 0A21  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0A22  DA 33 0A
+	ctx.PC = (ctx.flag_C != 0) ? 0x0A33 : 0x0A25;
+	ctx.cycles += 10;
+}
+
+static void block_0A25(SiRecompiled::Context& ctx)
+{
+	// 0A25  3E 21
+	ctx.A = 0x21;
+	ctx.cycles += 7;
+	// 0A27  32 98 20
+	ctx.write(0x2098, ctx.A);
+	ctx.cycles += 13;
+	// 0A2A  CD F5 01
+	ctx.push(0x0A2D);
+	ctx.PC = 0x01F5;
+	ctx.cycles += 17;
+}
+
+static void block_0A2D(SiRecompiled::Context& ctx)
+{
+	// 0A2D  CD 04 19
+	ctx.push(0x0A30);
+	ctx.PC = 0x1904;
+	ctx.cycles += 17;
+}
+
+static void block_0A30(SiRecompiled::Context& ctx)
+{
+	// 0A30  C3 04 08
+	ctx.PC = 0x0804;
+	ctx.cycles += 10;
+}
+
+static void block_0A33(SiRecompiled::Context& ctx)
+{
+	// 0A33  CD EF 01
+	ctx.push(0x0A36);
+	ctx.PC = 0x01EF;
+	ctx.cycles += 17;
+}
+
+static void block_0A36(SiRecompiled::Context& ctx)
+{
+	// 0A36  CD C0 01
+	ctx.push(0x0A39);
+	ctx.PC = 0x01C0;
+	ctx.cycles += 17;
+}
+
+static void block_0A39(SiRecompiled::Context& ctx)
+{
+	// 0A39  C3 04 08
+	ctx.PC = 0x0804;
+	ctx.cycles += 10;
+}
+
+static void block_0A3C(SiRecompiled::Context& ctx)
+{
+	// 0A3C  CD 59 0A
+	ctx.push(0x0A3F);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_0A3F(SiRecompiled::Context& ctx)
+{
+	// 0A3F  C2 52 0A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0A52 : 0x0A42;
+	ctx.cycles += 10;
+}
+
+static void block_0A42(SiRecompiled::Context& ctx)
+{
+	// 0A42  3E 30
+	ctx.A = 0x30;
+	ctx.cycles += 7;
+	// 0A44  32 C0 20
+	ctx.write(0x20C0, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0A47;
+}
+
+static void block_0A47(SiRecompiled::Context& ctx)
+{
+	// 0A47  3A C0 20
+	ctx.A = ctx.read(0x20C0);
+	ctx.cycles += 13;
+	// 0A4A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0A4B  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x0A4C; ctx.cycles += 5; }
+}
+
+static void block_0A4C(SiRecompiled::Context& ctx)
+{
+	// 0A4C  CD 59 0A
+	ctx.push(0x0A4F);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_0A4F(SiRecompiled::Context& ctx)
+{
+	// 0A4F  CA 47 0A
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0A47 : 0x0A52;
+	ctx.cycles += 10;
+}
+
+static void block_0A52(SiRecompiled::Context& ctx)
+{
+	// 0A52  CD 59 0A
+	ctx.push(0x0A55);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_0A55(SiRecompiled::Context& ctx)
+{
+	// 0A55  C2 52 0A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0A52 : 0x0A58;
+	ctx.cycles += 10;
+}
+
+static void block_0A58(SiRecompiled::Context& ctx)
+{
+	// 0A58  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0A59(SiRecompiled::Context& ctx)
+{
+	// 0A59  3A 15 20
+	ctx.A = ctx.read(0x2015);
+	ctx.cycles += 13;
+	// 0A5C  FE FF
+	{ uint8_t val = 0xFF; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0A5E  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0A5F(SiRecompiled::Context& ctx)
+{
+	// 0A5F  3A EF 20
+	ctx.A = ctx.read(0x20EF);
+	ctx.cycles += 13;
+	// 0A62  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0A63  CA 7C 0A
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0A7C : 0x0A66;
+	ctx.cycles += 10;
+}
+
+static void block_0A66(SiRecompiled::Context& ctx)
+{
+	// 0A66  48
+	ctx.C = ctx.B;
+	ctx.cycles += 5;
+	// 0A67  06 08
+	ctx.B = 0x08;
+	ctx.cycles += 7;
+	// 0A69  CD FA 18
+	ctx.push(0x0A6C);
+	ctx.PC = 0x18FA;
+	ctx.cycles += 17;
+}
+
+static void block_0A6C(SiRecompiled::Context& ctx)
+{
+	// 0A6C  41
+	ctx.B = ctx.C;
+	ctx.cycles += 5;
+	// 0A6D  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 0A6E  CD 7C 09
+	ctx.push(0x0A71);
+	ctx.PC = 0x097C;
+	ctx.cycles += 17;
+}
+
+static void block_0A71(SiRecompiled::Context& ctx)
+{
+	// 0A71  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0A72  21 F3 20
+	ctx.setHL(0x20F3);
+	ctx.cycles += 10;
+	// 0A75  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 0A77  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 0A78  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 0A79  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 0A7A  36 01
+	ctx.write(ctx.getHL(), 0x01);
+	ctx.cycles += 10;
+	ctx.PC = 0x0A7C;
+}
+
+static void block_0A7C(SiRecompiled::Context& ctx)
+{
+	// 0A7C  21 62 20
+	ctx.setHL(0x2062);
+	ctx.cycles += 10;
+	// 0A7F  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0A80(SiRecompiled::Context& ctx)
+{
+	// 0A80  3E 02
+	ctx.A = 0x02;
+	ctx.cycles += 7;
+	// 0A82  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0A85;
+}
+
+static void block_0A85(SiRecompiled::Context& ctx)
+{
+	// 0A85  D3 06
+	ctx.cycles += 10;
+	ctx.out(0x06);
+	// 0A87  3A CB 20
+	ctx.A = ctx.read(0x20CB);
+	ctx.cycles += 13;
+	// 0A8A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0A8B  CA 85 0A
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0A85 : 0x0A8E;
+	ctx.cycles += 10;
+}
+
+static void block_0A8E(SiRecompiled::Context& ctx)
+{
+	// 0A8E  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0A8F  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	// 0A92  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0A93(SiRecompiled::Context& ctx)
+{
+	// 0A93  D5
+	ctx.push(ctx.getDE());
+	ctx.cycles += 11;
+	// 0A94  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 0A95  CD FF 08
+	ctx.push(0x0A98);
+	ctx.PC = 0x08FF;
+	ctx.cycles += 17;
+}
+
+static void block_0A98(SiRecompiled::Context& ctx)
+{
+	// 0A98  D1
+	ctx.setDE(ctx.pop());
+	ctx.cycles += 10;
+	// 0A99  3E 07
+	ctx.A = 0x07;
+	ctx.cycles += 7;
+	// 0A9B  32 C0 20
+	ctx.write(0x20C0, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0A9E;
+}
+
+static void block_0A9E(SiRecompiled::Context& ctx)
+{
+	// 0A9E  3A C0 20
+	ctx.A = ctx.read(0x20C0);
+	ctx.cycles += 13;
+	// 0AA1  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0AA2  C2 9E 0A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0A9E : 0x0AA5;
+	ctx.cycles += 10;
+}
+
+static void block_0AA5(SiRecompiled::Context& ctx)
+{
+	// 0AA5  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 0AA6  0D
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val - 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0AA7  C2 93 0A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0A93 : 0x0AAA;
+	ctx.cycles += 10;
+}
+
+static void block_0AAA(SiRecompiled::Context& ctx)
+{
+	// 0AAA  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0AAB(SiRecompiled::Context& ctx)
+{
+	// 0AAB  21 50 20
+	ctx.setHL(0x2050);
+	ctx.cycles += 10;
+	// 0AAE  C3 4B 02
+	ctx.PC = 0x024B;
+	ctx.cycles += 10;
+}
+
+static void block_0AB1(SiRecompiled::Context& ctx)
+{
+	// 0AB1  3E 40
+	ctx.A = 0x40;
+	ctx.cycles += 7;
+	// 0AB3  C3 D7 0A
+	ctx.PC = 0x0AD7;
+	ctx.cycles += 10;
+}
+
+static void block_0AB6(SiRecompiled::Context& ctx)
+{
+	// 0AB6  3E 80
+	ctx.A = 0x80;
+	ctx.cycles += 7;
+	// 0AB8  C3 D7 0A
+	ctx.PC = 0x0AD7;
+	ctx.cycles += 10;
+}
+
+static void block_0ABB(SiRecompiled::Context& ctx)
+{
+	// 0ABB  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 0ABC  C3 72 00
+	ctx.PC = 0x0072;
+	ctx.cycles += 10;
+}
+
+static void block_0ABF(SiRecompiled::Context& ctx)
+{
+	// 0ABF  3A C1 20
+	ctx.A = ctx.read(0x20C1);
+	ctx.cycles += 13;
+	// 0AC2  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0AC3  DA BB 0A
+	ctx.PC = (ctx.flag_C != 0) ? 0x0ABB : 0x0AC6;
+	ctx.cycles += 10;
+}
+
+static void block_0AC6(SiRecompiled::Context& ctx)
+{
+	// 0AC6  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0AC7  DA 68 18
+	ctx.PC = (ctx.flag_C != 0) ? 0x1868 : 0x0ACA;
+	ctx.cycles += 10;
+}
+
+static void block_0ACA(SiRecompiled::Context& ctx)
+{
+	// 0ACA  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0ACB  DA AB 0A
+	ctx.PC = (ctx.flag_C != 0) ? 0x0AAB : 0x0ACE;
+	ctx.cycles += 10;
+}
+
+static void block_0ACE(SiRecompiled::Context& ctx)
+{
+	// 0ACE  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0ACF(SiRecompiled::Context& ctx)
+{
+	// 0ACF  21 14 2B
+	ctx.setHL(0x2B14);
+	ctx.cycles += 10;
+	// 0AD2  0E 0F
+	ctx.C = 0x0F;
+	ctx.cycles += 7;
+	// 0AD4  C3 93 0A
+	ctx.PC = 0x0A93;
+	ctx.cycles += 10;
+}
+
+static void block_0AD7(SiRecompiled::Context& ctx)
+{
+	// 0AD7  32 C0 20
+	ctx.write(0x20C0, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0ADA;
+}
+
+static void block_0ADA(SiRecompiled::Context& ctx)
+{
+	// 0ADA  3A C0 20
+	ctx.A = ctx.read(0x20C0);
+	ctx.cycles += 13;
+	// 0ADD  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0ADE  C2 DA 0A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0ADA : 0x0AE1;
+	ctx.cycles += 10;
+}
+
+static void block_0AE1(SiRecompiled::Context& ctx)
+{
+	// 0AE1  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_0AE2(SiRecompiled::Context& ctx)
+{
+	// 0AE2  21 C2 20
+	ctx.setHL(0x20C2);
+	ctx.cycles += 10;
+	// 0AE5  06 0C
+	ctx.B = 0x0C;
+	ctx.cycles += 7;
+	// 0AE7  C3 32 1A
+	ctx.PC = 0x1A32;
+	ctx.cycles += 10;
+}
+
+static void block_0AEA(SiRecompiled::Context& ctx)
+{
+	// 0AEA  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0AEB  D3 03
+	ctx.cycles += 10;
+	ctx.out(0x03);
+	// 0AED  D3 05
+	ctx.cycles += 10;
+	ctx.out(0x05);
+	// 0AEF  CD 82 19
+	ctx.push(0x0AF2);
+	ctx.PC = 0x1982;
+	ctx.cycles += 17;
+}
+
+static void block_0AF3(SiRecompiled::Context& ctx)
+{
+	// 0AF3  CD B1 0A
+	ctx.push(0x0AF6);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_0AF6(SiRecompiled::Context& ctx)
+{
+	// 0AF6  3A EC 20
+	ctx.A = ctx.read(0x20EC);
+	ctx.cycles += 13;
+	// 0AF9  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0AFA  21 17 30
+	ctx.setHL(0x3017);
+	ctx.cycles += 10;
+	// 0AFD  0E 04
+	ctx.C = 0x04;
+	ctx.cycles += 7;
+	// 0AFF  C2 E8 0B
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0BE8 : 0x0B02;
+	ctx.cycles += 10;
+}
+
+static void block_0B02(SiRecompiled::Context& ctx)
+{
+	// 0B02  11 FA 1C
+	ctx.setDE(0x1CFA);
+	ctx.cycles += 10;
+	// 0B05  CD 93 0A
+	ctx.push(0x0B08);
+	ctx.PC = 0x0A93;
+	ctx.cycles += 17;
+}
+
+static void block_0B08(SiRecompiled::Context& ctx)
+{
+	// 0B08  11 AF 1D
+	ctx.setDE(0x1DAF);
+	ctx.cycles += 10;
+	ctx.PC = 0x0B0B;
+}
+
+static void block_0B0B(SiRecompiled::Context& ctx)
+{
+	// 0B0B  CD CF 0A
+	ctx.push(0x0B0E);
+	ctx.PC = 0x0ACF;
+	ctx.cycles += 17;
+}
+
+static void block_0B0E(SiRecompiled::Context& ctx)
+{
+	// 0B0E  CD B1 0A
+	ctx.push(0x0B11);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_0B11(SiRecompiled::Context& ctx)
+{
+	// 0B11  CD 15 18
+	ctx.push(0x0B14);
+	ctx.PC = 0x1815;
+	ctx.cycles += 17;
+}
+
+static void block_0B14(SiRecompiled::Context& ctx)
+{
+	// 0B14  CD B6 0A
+	ctx.push(0x0B17);
+	ctx.PC = 0x0AB6;
+	ctx.cycles += 17;
+}
+
+static void block_0B17(SiRecompiled::Context& ctx)
+{
+	// 0B17  3A EC 20
+	ctx.A = ctx.read(0x20EC);
+	ctx.cycles += 13;
+	// 0B1A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0B1B  C2 4A 0B
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0B4A : 0x0B1E;
+	ctx.cycles += 10;
+}
+
+static void block_0B1E(SiRecompiled::Context& ctx)
+{
+	// 0B1E  11 95 1A
+	ctx.setDE(0x1A95);
+	ctx.cycles += 10;
+	// 0B21  CD E2 0A
+	ctx.push(0x0B24);
+	ctx.PC = 0x0AE2;
+	ctx.cycles += 17;
+}
+
+static void block_0B24(SiRecompiled::Context& ctx)
+{
+	// 0B24  CD 80 0A
+	ctx.push(0x0B27);
+	ctx.PC = 0x0A80;
+	ctx.cycles += 17;
+}
+
+static void block_0B27(SiRecompiled::Context& ctx)
+{
+	// 0B27  11 B0 1B
+	ctx.setDE(0x1BB0);
+	ctx.cycles += 10;
+	// 0B2A  CD E2 0A
+	ctx.push(0x0B2D);
+	ctx.PC = 0x0AE2;
+	ctx.cycles += 17;
+}
+
+static void block_0B2D(SiRecompiled::Context& ctx)
+{
+	// 0B2D  CD 80 0A
+	ctx.push(0x0B30);
+	ctx.PC = 0x0A80;
+	ctx.cycles += 17;
+}
+
+static void block_0B30(SiRecompiled::Context& ctx)
+{
+	// 0B30  CD B1 0A
+	ctx.push(0x0B33);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_0B33(SiRecompiled::Context& ctx)
+{
+	// 0B33  11 C9 1F
+	ctx.setDE(0x1FC9);
+	ctx.cycles += 10;
+	// 0B36  CD E2 0A
+	ctx.push(0x0B39);
+	ctx.PC = 0x0AE2;
+	ctx.cycles += 17;
+}
+
+static void block_0B39(SiRecompiled::Context& ctx)
+{
+	// 0B39  CD 80 0A
+	ctx.push(0x0B3C);
+	ctx.PC = 0x0A80;
+	ctx.cycles += 17;
+}
+
+static void block_0B3C(SiRecompiled::Context& ctx)
+{
+	// 0B3C  CD B1 0A
+	ctx.push(0x0B3F);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_0B3F(SiRecompiled::Context& ctx)
+{
+	// 0B3F  21 B7 33
+	ctx.setHL(0x33B7);
+	ctx.cycles += 10;
+	// 0B42  06 0A
+	ctx.B = 0x0A;
+	ctx.cycles += 7;
+	// 0B44  CD CB 14
+	ctx.push(0x0B47);
+	ctx.PC = 0x14CB;
+	ctx.cycles += 17;
+}
+
+static void block_0B47(SiRecompiled::Context& ctx)
+{
+	// 0B47  CD B6 0A
+	ctx.push(0x0B4A);
+	ctx.PC = 0x0AB6;
+	ctx.cycles += 17;
+}
+
+static void block_0B4A(SiRecompiled::Context& ctx)
+{
+	// 0B4A  CD D6 09
+	ctx.push(0x0B4D);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_0B4D(SiRecompiled::Context& ctx)
+{
+	// 0B4D  3A FF 21
+	ctx.A = ctx.read(0x21FF);
+	ctx.cycles += 13;
+	// 0B50  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0B51  C2 5D 0B
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0B5D : 0x0B54;
+	ctx.cycles += 10;
+}
+
+static void block_0B54(SiRecompiled::Context& ctx)
+{
+	// 0B54  CD D1 08
+	ctx.push(0x0B57);
+	ctx.PC = 0x08D1;
+	ctx.cycles += 17;
+}
+
+static void block_0B57(SiRecompiled::Context& ctx)
+{
+	// 0B57  32 FF 21
+	ctx.write(0x21FF, ctx.A);
+	ctx.cycles += 13;
+	// 0B5A  CD 7F 1A
+	ctx.push(0x0B5D);
+	ctx.PC = 0x1A7F;
+	ctx.cycles += 17;
+}
+
+static void block_0B5D(SiRecompiled::Context& ctx)
+{
+	// 0B5D  CD E4 01
+	ctx.push(0x0B60);
+	ctx.PC = 0x01E4;
+	ctx.cycles += 17;
+}
+
+static void block_0B60(SiRecompiled::Context& ctx)
+{
+	// 0B60  CD C0 01
+	ctx.push(0x0B63);
+	ctx.PC = 0x01C0;
+	ctx.cycles += 17;
+}
+
+static void block_0B63(SiRecompiled::Context& ctx)
+{
+	// 0B63  CD EF 01
+	ctx.push(0x0B66);
+	ctx.PC = 0x01EF;
+	ctx.cycles += 17;
+}
+
+static void block_0B66(SiRecompiled::Context& ctx)
+{
+	// 0B66  CD 1A 02
+	ctx.push(0x0B69);
+	ctx.PC = 0x021A;
+	ctx.cycles += 17;
+}
+
+static void block_0B69(SiRecompiled::Context& ctx)
+{
+	// 0B69  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 0B6B  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	// 0B6E  CD CF 01
+	ctx.push(0x0B71);
+	ctx.PC = 0x01CF;
+	ctx.cycles += 17;
+}
+
+static void block_0B71(SiRecompiled::Context& ctx)
+{
+	// 0B71  CD 18 16
+	ctx.push(0x0B74);
+	ctx.PC = 0x1618;
+	ctx.cycles += 17;
+}
+
+static void block_0B74(SiRecompiled::Context& ctx)
+{
+	// 0B74  CD F1 0B
+	ctx.push(0x0B77);
+	ctx.PC = 0x0BF1;
+	ctx.cycles += 17;
+}
+
+static void block_0B77(SiRecompiled::Context& ctx)
+{
+	// 0B77  D3 06
+	ctx.cycles += 10;
+	ctx.out(0x06);
+	// 0B79  CD 59 0A
+	ctx.push(0x0B7C);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_0B7C(SiRecompiled::Context& ctx)
+{
+	// 0B7C  CA 71 0B
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0B71 : 0x0B7F;
+	ctx.cycles += 10;
+}
+
+static void block_0B7F(SiRecompiled::Context& ctx)
+{
+	// 0B7F  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0B80  32 25 20
+	ctx.write(0x2025, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x0B83;
+}
+
+static void block_0B83(SiRecompiled::Context& ctx)
+{
+	// 0B83  CD 59 0A
+	ctx.push(0x0B86);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_0B86(SiRecompiled::Context& ctx)
+{
+	// 0B86  C2 83 0B
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0B83 : 0x0B89;
+	ctx.cycles += 10;
+}
+
+static void block_0B89(SiRecompiled::Context& ctx)
+{
+	// 0B89  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 0B8A  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	// 0B8D  CD B1 0A
+	ctx.push(0x0B90);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_0B90(SiRecompiled::Context& ctx)
+{
+	// 0B90  CD 88 19
+	ctx.push(0x0B93);
+	ctx.PC = 0x1988;
+	ctx.cycles += 17;
+}
+
+static void block_0B93(SiRecompiled::Context& ctx)
+{
+	// 0B93  0E 0C
+	ctx.C = 0x0C;
+	ctx.cycles += 7;
+	// 0B95  21 11 2C
+	ctx.setHL(0x2C11);
+	ctx.cycles += 10;
+	// 0B98  11 90 1F
+	ctx.setDE(0x1F90);
+	ctx.cycles += 10;
+	// 0B9B  CD F3 08
+	ctx.push(0x0B9E);
+	ctx.PC = 0x08F3;
+	ctx.cycles += 17;
+}
+
+static void block_0B9E(SiRecompiled::Context& ctx)
+{
+	// 0B9E  3A EC 20
+	ctx.A = ctx.read(0x20EC);
+	ctx.cycles += 13;
+	// 0BA1  FE 00
+	{ uint8_t val = 0x00; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0BA3  C2 AE 0B
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0BAE : 0x0BA6;
+	ctx.cycles += 10;
+}
+
+static void block_0BA6(SiRecompiled::Context& ctx)
+{
+	// 0BA6  21 11 33
+	ctx.setHL(0x3311);
+	ctx.cycles += 10;
+	// 0BA9  3E 02
+	ctx.A = 0x02;
+	ctx.cycles += 7;
+	// 0BAB  CD FF 08
+	ctx.push(0x0BAE);
+	ctx.PC = 0x08FF;
+	ctx.cycles += 17;
+}
+
+static void block_0BAE(SiRecompiled::Context& ctx)
+{
+	// 0BAE  01 9C 1F
+	ctx.setBC(0x1F9C);
+	ctx.cycles += 10;
+	// 0BB1  CD 56 18
+	ctx.push(0x0BB4);
+	ctx.PC = 0x1856;
+	ctx.cycles += 17;
+}
+
+static void block_0BB4(SiRecompiled::Context& ctx)
+{
+	// 0BB4  CD 4C 18
+	ctx.push(0x0BB7);
+	ctx.PC = 0x184C;
+	ctx.cycles += 17;
+}
+
+static void block_0BB7(SiRecompiled::Context& ctx)
+{
+	// 0BB7  DB 02
+	ctx.in(0x02);
+	ctx.cycles += 10;
+	// 0BB9  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 0BBA  DA C3 0B
+	ctx.PC = (ctx.flag_C != 0) ? 0x0BC3 : 0x0BBD;
+	ctx.cycles += 10;
+}
+
+static void block_0BBD(SiRecompiled::Context& ctx)
+{
+	// 0BBD  01 A0 1F
+	ctx.setBC(0x1FA0);
+	ctx.cycles += 10;
+	// 0BC0  CD 3A 18
+	ctx.push(0x0BC3);
+	ctx.PC = 0x183A;
+	ctx.cycles += 17;
+}
+
+static void block_0BC3(SiRecompiled::Context& ctx)
+{
+	// 0BC3  CD B6 0A
+	ctx.push(0x0BC6);
+	ctx.PC = 0x0AB6;
+	ctx.cycles += 17;
+}
+
+static void block_0BC6(SiRecompiled::Context& ctx)
+{
+	// 0BC6  3A EC 20
+	ctx.A = ctx.read(0x20EC);
+	ctx.cycles += 13;
+	// 0BC9  FE 00
+	{ uint8_t val = 0x00; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0BCB  C2 DA 0B
+	ctx.PC = (ctx.flag_Z == 0) ? 0x0BDA : 0x0BCE;
+	ctx.cycles += 10;
+}
+
+static void block_0BCE(SiRecompiled::Context& ctx)
+{
+	// 0BCE  11 D5 1F
+	ctx.setDE(0x1FD5);
+	ctx.cycles += 10;
+	// 0BD1  CD E2 0A
+	ctx.push(0x0BD4);
+	ctx.PC = 0x0AE2;
+	ctx.cycles += 17;
+}
+
+static void block_0BD4(SiRecompiled::Context& ctx)
+{
+	// 0BD4  CD 80 0A
+	ctx.push(0x0BD7);
+	ctx.PC = 0x0A80;
+	ctx.cycles += 17;
+}
+
+static void block_0BD7(SiRecompiled::Context& ctx)
+{
+	// 0BD7  CD 9E 18
+	ctx.push(0x0BDA);
+	ctx.PC = 0x189E;
+	ctx.cycles += 17;
+}
+
+static void block_0BDA(SiRecompiled::Context& ctx)
+{
+	// 0BDA  21 EC 20
+	ctx.setHL(0x20EC);
+	ctx.cycles += 10;
+	// 0BDD  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 0BDE  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 0BDF  E6 01
+	{ uint8_t res = ctx.A & 0x01; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 0BE1  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 0BE2  CD D6 09
+	ctx.push(0x0BE5);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_0BE5(SiRecompiled::Context& ctx)
+{
+	// 0BE5  C3 DF 18
+	ctx.PC = 0x18DF;
+	ctx.cycles += 10;
+}
+
+static void block_0BE8(SiRecompiled::Context& ctx)
+{
+	// 0BE8  11 AB 1D
+	ctx.setDE(0x1DAB);
+	ctx.cycles += 10;
+	// 0BEB  CD 93 0A
+	ctx.push(0x0BEE);
+	ctx.PC = 0x0A93;
+	ctx.cycles += 17;
+}
+
+static void block_0BEE(SiRecompiled::Context& ctx)
+{
+	// 0BEE  C3 0B 0B
+	ctx.PC = 0x0B0B;
+	ctx.cycles += 10;
+}
+
+static void block_0BF1(SiRecompiled::Context& ctx)
+{
+	// 0BF1  CD 0A 19
+	ctx.push(0x0BF4);
+	ctx.PC = 0x190A;
+	ctx.cycles += 17;
+}
+
+static void block_0BF4(SiRecompiled::Context& ctx)
+{
+	// 0BF4  C3 9A 19
+	ctx.PC = 0x199A;
+	ctx.cycles += 10;
+}
+
+static void block_1424(SiRecompiled::Context& ctx)
+{
+	// 1424  CD 74 14
+	ctx.push(0x1427);
+	ctx.PC = 0x1474;
+	ctx.cycles += 17;
+}
+
+static void block_1427(SiRecompiled::Context& ctx)
+{
+	// 1427  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 1428  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 1429  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 142A  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 142B  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 142C  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 142D  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 142E  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 142F  01 20 00
+	ctx.setBC(0x0020);
+	ctx.cycles += 10;
+	// 1432  09
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getBC(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 1433  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 1434  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1435  C2 27 14
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1427 : 0x1438;
+	ctx.cycles += 10;
+}
+
+static void block_1438(SiRecompiled::Context& ctx)
+{
+	// 1438  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1439(SiRecompiled::Context& ctx)
+{
+	// 1439  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 143A  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 143B  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 143C  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 143D  01 20 00
+	ctx.setBC(0x0020);
+	ctx.cycles += 10;
+	// 1440  09
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getBC(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 1441  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 1442  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1443  C2 39 14
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1439 : 0x1446;
+	ctx.cycles += 10;
+}
+
+static void block_1446(SiRecompiled::Context& ctx)
+{
+	// 1446  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1474(SiRecompiled::Context& ctx)
+{
+	// 1474  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 1475  E6 07
+	{ uint8_t res = ctx.A & 0x07; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1477  D3 02
+	ctx.cycles += 10;
+	ctx.out(0x02);
+	// 1479  C3 47 1A
+	ctx.PC = 0x1A47;
+	ctx.cycles += 10;
+}
+
+static void block_147C(SiRecompiled::Context& ctx)
+{
+	// 147C  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 147D  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	ctx.PC = 0x147E;
+}
+
+static void block_147E(SiRecompiled::Context& ctx)
+{
+	// 147E  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 147F  12
+	ctx.write(ctx.getDE(), ctx.A);
+	ctx.cycles += 7;
+	// 1480  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 1481  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1482  0D
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val - 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1483  C2 7E 14
+	ctx.PC = (ctx.flag_Z == 0) ? 0x147E : 0x1486;
+	ctx.cycles += 10;
+}
+
+static void block_1486(SiRecompiled::Context& ctx)
+{
+	// 1486  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 1487  01 20 00
+	ctx.setBC(0x0020);
+	ctx.cycles += 10;
+	// 148A  09
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getBC(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 148B  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 148C  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 148D  C2 7C 14
+	ctx.PC = (ctx.flag_Z == 0) ? 0x147C : 0x1490;
+	ctx.cycles += 10;
+}
+
+static void block_1490(SiRecompiled::Context& ctx)
+{
+	// 1490  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_14CB(SiRecompiled::Context& ctx)
+{
+	// 14CB  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	ctx.PC = 0x14CC;
+}
+
+static void block_14CC(SiRecompiled::Context& ctx)
+{
+	// 14CC  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 14CD  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 14CE  01 20 00
+	ctx.setBC(0x0020);
+	ctx.cycles += 10;
+	// 14D1  09
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getBC(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 14D2  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 14D3  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 14D4  C2 CC 14
+	ctx.PC = (ctx.flag_Z == 0) ? 0x14CC : 0x14D7;
+	ctx.cycles += 10;
+}
+
+static void block_14D7(SiRecompiled::Context& ctx)
+{
+	// 14D7  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_14D8(SiRecompiled::Context& ctx)
+{
+	// 14D8  3A 25 20
+	ctx.A = ctx.read(0x2025);
+	ctx.cycles += 13;
+	// 14DB  FE 05
+	{ uint8_t val = 0x05; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 14DD  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x14DE; ctx.cycles += 5; }
+}
+
+static void block_14DE(SiRecompiled::Context& ctx)
+{
+	// 14DE  FE 02
+	{ uint8_t val = 0x02; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 14E0  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x14E1; ctx.cycles += 5; }
+}
+
+static void block_14E1(SiRecompiled::Context& ctx)
+{
+	// 14E1  3A 29 20
+	ctx.A = ctx.read(0x2029);
+	ctx.cycles += 13;
+	// 14E4  FE D8
+	{ uint8_t val = 0xD8; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 14E6  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	// 14E7  D2 30 15
+	ctx.PC = (ctx.flag_C == 0) ? 0x1530 : 0x14EA;
+	ctx.cycles += 10;
+}
+
+static void block_14EA(SiRecompiled::Context& ctx)
+{
+	// 14EA  3A 02 20
+	ctx.A = ctx.read(0x2002);
+	ctx.cycles += 13;
+	// 14ED  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 14EE  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x14EF; ctx.cycles += 5; }
+}
+
+static void block_14EF(SiRecompiled::Context& ctx)
+{
+	// 14EF  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 14F0  FE CE
+	{ uint8_t val = 0xCE; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 14F2  D2 79 15
+	ctx.PC = (ctx.flag_C == 0) ? 0x1579 : 0x14F5;
+	ctx.cycles += 10;
+}
+
+static void block_14F5(SiRecompiled::Context& ctx)
+{
+	// 14F5  C6 06
+	{ uint8_t val = 0x06; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 14F7  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	// 14F8  3A 09 20
+	ctx.A = ctx.read(0x2009);
+	ctx.cycles += 13;
+	// 14FB  FE 90
+	{ uint8_t val = 0x90; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 14FD  D2 04 15
+	ctx.PC = (ctx.flag_C == 0) ? 0x1504 : 0x1500;
+	ctx.cycles += 10;
+}
+
+static void block_1500(SiRecompiled::Context& ctx)
+{
+	// 1500  B8
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1501  D2 30 15
+	ctx.PC = (ctx.flag_C == 0) ? 0x1530 : 0x1504;
+	ctx.cycles += 10;
+}
+
+static void block_1504(SiRecompiled::Context& ctx)
+{
+	// 1504  68
+	ctx.L = ctx.B;
+	ctx.cycles += 5;
+	// 1505  CD 62 15
+	ctx.push(0x1508);
+	ctx.PC = 0x1562;
+	ctx.cycles += 17;
+}
+
+static void block_1508(SiRecompiled::Context& ctx)
+{
+	// 1508  3A 2A 20
+	ctx.A = ctx.read(0x202A);
+	ctx.cycles += 13;
+	// 150B  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 150C  CD 6F 15
+	ctx.push(0x150F);
+	ctx.PC = 0x156F;
+	ctx.cycles += 17;
+}
+
+static void block_150F(SiRecompiled::Context& ctx)
+{
+	// 150F  22 64 20
+	ctx.write(0x2064, ctx.L);
+	ctx.write(0x2065, ctx.H);
+	ctx.cycles += 16;
+	// 1512  3E 05
+	ctx.A = 0x05;
+	ctx.cycles += 7;
+	// 1514  32 25 20
+	ctx.write(0x2025, ctx.A);
+	ctx.cycles += 13;
+	// 1517  CD 81 15
+	ctx.push(0x151A);
+	ctx.PC = 0x1581;
+	ctx.cycles += 17;
+}
+
+static void block_151A(SiRecompiled::Context& ctx)
+{
+	// 151A  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 151B  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 151C  CA 30 15
+	ctx.PC = (ctx.flag_Z != 0) ? 0x1530 : 0x151F;
+	ctx.cycles += 10;
+}
+
+static void block_151F(SiRecompiled::Context& ctx)
+{
+	// 151F  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 1521  CD 5F 0A
+	ctx.push(0x1524);
+	ctx.PC = 0x0A5F;
+	ctx.cycles += 17;
+}
+
+static void block_1524(SiRecompiled::Context& ctx)
+{
+	// 1524  CD 3B 1A
+	ctx.push(0x1527);
+	ctx.PC = 0x1A3B;
+	ctx.cycles += 17;
+}
+
+static void block_1527(SiRecompiled::Context& ctx)
+{
+	// 1527  CD D3 15
+	ctx.push(0x152A);
+	ctx.PC = 0x15D3;
+	ctx.cycles += 17;
+}
+
+static void block_152A(SiRecompiled::Context& ctx)
+{
+	// 152A  3E 10
+	ctx.A = 0x10;
+	ctx.cycles += 7;
+	// 152C  32 03 20
+	ctx.write(0x2003, ctx.A);
+	ctx.cycles += 13;
+	// 152F  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1530(SiRecompiled::Context& ctx)
+{
+	// 1530  3E 03
+	ctx.A = 0x03;
+	ctx.cycles += 7;
+	// 1532  32 25 20
+	ctx.write(0x2025, ctx.A);
+	ctx.cycles += 13;
+	// 1535  C3 4A 15
+	ctx.PC = 0x154A;
+	ctx.cycles += 10;
+}
+
+static void block_1538(SiRecompiled::Context& ctx)
+{
+	// 1538  21 03 20
+	ctx.setHL(0x2003);
+	ctx.cycles += 10;
+	// 153B  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 153C  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x153D; ctx.cycles += 5; }
+}
+
+static void block_153D(SiRecompiled::Context& ctx)
+{
+	// 153D  2A 64 20
+	ctx.L = ctx.read(0x2064);
+	ctx.H = ctx.read(0x2065);
+	ctx.cycles += 16;
+	// 1540  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 1542  CD 24 14
+	ctx.push(0x1545);
+	ctx.PC = 0x1424;
+	ctx.cycles += 17;
+}
+
+static void block_1545(SiRecompiled::Context& ctx)
+{
+	// 1545  3E 04
+	ctx.A = 0x04;
+	ctx.cycles += 7;
+	// 1547  32 25 20
+	ctx.write(0x2025, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x154A;
+}
+
+static void block_154A(SiRecompiled::Context& ctx)
+{
+	// 154A  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 154B  32 02 20
+	ctx.write(0x2002, ctx.A);
+	ctx.cycles += 13;
+	// 154E  06 F7
+	ctx.B = 0xF7;
+	ctx.cycles += 7;
+	// 1550  C3 DC 19
+	ctx.PC = 0x19DC;
+	ctx.cycles += 10;
+}
+
+static void block_1554(SiRecompiled::Context& ctx)
+{
+	// 1554  0E 00
+	ctx.C = 0x00;
+	ctx.cycles += 7;
+	// 1556  BC
+	{ uint8_t val = ctx.H; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1557  D4 90 15
+	if (ctx.flag_C == 0) { ctx.push(0x155A); ctx.PC = 0x1590; ctx.cycles += 17; }
+	else { ctx.PC = 0x155A; ctx.cycles += 11; }
+}
+
+static void block_155A(SiRecompiled::Context& ctx)
+{
+	// 155A  BC
+	{ uint8_t val = ctx.H; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 155B  D0
+	if (ctx.flag_C == 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x155C; ctx.cycles += 5; }
+}
+
+static void block_155C(SiRecompiled::Context& ctx)
+{
+	// 155C  C6 10
+	{ uint8_t val = 0x10; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 155E  0C
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val + 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 155F  C3 5A 15
+	ctx.PC = 0x155A;
+	ctx.cycles += 10;
+}
+
+static void block_1562(SiRecompiled::Context& ctx)
+{
+	// 1562  3A 09 20
+	ctx.A = ctx.read(0x2009);
+	ctx.cycles += 13;
+	// 1565  65
+	ctx.H = ctx.L;
+	ctx.cycles += 5;
+	// 1566  CD 54 15
+	ctx.push(0x1569);
+	ctx.PC = 0x1554;
+	ctx.cycles += 17;
+}
+
+static void block_1569(SiRecompiled::Context& ctx)
+{
+	// 1569  41
+	ctx.B = ctx.C;
+	ctx.cycles += 5;
+	// 156A  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	ctx.PC = 0x156B;
+}
+
+static void block_156D(SiRecompiled::Context& ctx)
+{
+	// 156D  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 156E  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_156F(SiRecompiled::Context& ctx)
+{
+	// 156F  3A 0A 20
+	ctx.A = ctx.read(0x200A);
+	ctx.cycles += 13;
+	// 1572  CD 54 15
+	ctx.push(0x1575);
+	ctx.PC = 0x1554;
+	ctx.cycles += 17;
+}
+
+static void block_1577(SiRecompiled::Context& ctx)
+{
+	// 1577  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 1578  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1579(SiRecompiled::Context& ctx)
+{
+	// 1579  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 157B  32 85 20
+	ctx.write(0x2085, ctx.A);
+	ctx.cycles += 13;
+	// 157E  C3 45 15
+	ctx.PC = 0x1545;
+	ctx.cycles += 10;
+}
+
+static void block_1581(SiRecompiled::Context& ctx)
+{
+	// 1581  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 1582  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 1583  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 1584  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 1585  80
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1586  80
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1587  80
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1588  81
+	{ uint8_t val = ctx.C; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1589  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 158A  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 158B  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 158E  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 158F  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1590(SiRecompiled::Context& ctx)
+{
+	// 1590  0C
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val + 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1591  C6 10
+	{ uint8_t val = 0x10; uint8_t a = ctx.A; uint8_t res = (uint8_t)(a + val);
+	  ctx.flag_AC = ((a & 0x0F) + (val & 0x0F)) > 0x0F; ctx.flag_C = (a + val) > 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1593  FA 90 15
+	ctx.PC = (ctx.flag_S != 0) ? 0x1590 : 0x1596;
+	ctx.cycles += 10;
+}
+
+static void block_1596(SiRecompiled::Context& ctx)
+{
+	// 1596  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1597(SiRecompiled::Context& ctx)
+{
+	// 1597  3A 0D 20
+	ctx.A = ctx.read(0x200D);
+	ctx.cycles += 13;
+	// 159A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 159B  C2 B7 15
+	ctx.PC = (ctx.flag_Z == 0) ? 0x15B7 : 0x159E;
+	ctx.cycles += 10;
+}
+
+static void block_159E(SiRecompiled::Context& ctx)
+{
+	// 159E  21 A4 3E
+	ctx.setHL(0x3EA4);
+	ctx.cycles += 10;
+	// 15A1  CD C5 15
+	ctx.push(0x15A4);
+	ctx.PC = 0x15C5;
+	ctx.cycles += 17;
+}
+
+static void block_15A4(SiRecompiled::Context& ctx)
+{
+	// 15A4  D0
+	if (ctx.flag_C == 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x15A5; ctx.cycles += 5; }
+}
+
+static void block_15A5(SiRecompiled::Context& ctx)
+{
+	// 15A5  06 FE
+	ctx.B = 0xFE;
+	ctx.cycles += 7;
+	// 15A7  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	ctx.PC = 0x15A9;
+}
+
+static void block_15A9(SiRecompiled::Context& ctx)
+{
+	// 15A9  32 0D 20
+	ctx.write(0x200D, ctx.A);
+	ctx.cycles += 13;
+	// 15AC  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 15AD  32 08 20
+	ctx.write(0x2008, ctx.A);
+	ctx.cycles += 13;
+	// 15B0  3A 0E 20
+	ctx.A = ctx.read(0x200E);
+	ctx.cycles += 13;
+	// 15B3  32 07 20
+	ctx.write(0x2007, ctx.A);
+	ctx.cycles += 13;
+	// 15B6  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_15B7(SiRecompiled::Context& ctx)
+{
+	// 15B7  21 24 25
+	ctx.setHL(0x2524);
+	ctx.cycles += 10;
+	// 15BA  CD C5 15
+	ctx.push(0x15BD);
+	ctx.PC = 0x15C5;
+	ctx.cycles += 17;
+}
+
+static void block_15BD(SiRecompiled::Context& ctx)
+{
+	// 15BD  D0
+	if (ctx.flag_C == 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x15BE; ctx.cycles += 5; }
+}
+
+static void block_15BE(SiRecompiled::Context& ctx)
+{
+	// 15BE  CD F1 18
+	ctx.push(0x15C1);
+	ctx.PC = 0x18F1;
+	ctx.cycles += 17;
+}
+
+static void block_15C1(SiRecompiled::Context& ctx)
+{
+	// 15C1  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 15C2  C3 A9 15
+	ctx.PC = 0x15A9;
+	ctx.cycles += 10;
+}
+
+static void block_15C5(SiRecompiled::Context& ctx)
+{
+	// 15C5  06 17
+	ctx.B = 0x17;
+	ctx.cycles += 7;
+	ctx.PC = 0x15C7;
+}
+
+static void block_15C7(SiRecompiled::Context& ctx)
+{
+	// 15C7  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 15C8  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 15C9  C2 6B 16
+	ctx.PC = (ctx.flag_Z == 0) ? 0x166B : 0x15CC;
+	ctx.cycles += 10;
+}
+
+static void block_15CC(SiRecompiled::Context& ctx)
+{
+	// 15CC  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 15CD  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 15CE  C2 C7 15
+	ctx.PC = (ctx.flag_Z == 0) ? 0x15C7 : 0x15D1;
+	ctx.cycles += 10;
+}
+
+static void block_15D1(SiRecompiled::Context& ctx)
+{
+	// 15D1  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_15D3(SiRecompiled::Context& ctx)
+{
+	// 15D3  CD 74 14
+	ctx.push(0x15D6);
+	ctx.PC = 0x1474;
+	ctx.cycles += 17;
+}
+
+static void block_15D6(SiRecompiled::Context& ctx)
+{
+	// 15D6  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	ctx.PC = 0x15D7;
+}
+
+static void block_15D7(SiRecompiled::Context& ctx)
+{
+	// 15D7  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 15D8  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	// 15D9  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 15DA  D3 04
+	ctx.cycles += 10;
+	ctx.out(0x04);
+	// 15DC  DB 03
+	ctx.in(0x03);
+	ctx.cycles += 10;
+	// 15DE  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 15DF  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 15E0  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 15E1  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 15E2  D3 04
+	ctx.cycles += 10;
+	ctx.out(0x04);
+	// 15E4  DB 03
+	ctx.in(0x03);
+	ctx.cycles += 10;
+	// 15E6  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 15E7  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 15E8  01 20 00
+	ctx.setBC(0x0020);
+	ctx.cycles += 10;
+	// 15EB  09
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getBC(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 15EC  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 15ED  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 15EE  C2 D7 15
+	ctx.PC = (ctx.flag_Z == 0) ? 0x15D7 : 0x15F1;
+	ctx.cycles += 10;
+}
+
+static void block_15F1(SiRecompiled::Context& ctx)
+{
+	// 15F1  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 15F2  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_15F3(SiRecompiled::Context& ctx)
+{
+	// 15F3  CD 11 16
+	ctx.push(0x15F6);
+	ctx.PC = 0x1611;
+	ctx.cycles += 17;
+}
+
+static void block_15F6(SiRecompiled::Context& ctx)
+{
+	// 15F6  01 00 37
+	ctx.setBC(0x3700);
+	ctx.cycles += 10;
+	ctx.PC = 0x15F9;
+}
+
+static void block_15F9(SiRecompiled::Context& ctx)
+{
+	// 15F9  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 15FA  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 15FB  CA FF 15
+	ctx.PC = (ctx.flag_Z != 0) ? 0x15FF : 0x15FE;
+	ctx.cycles += 10;
+}
+
+static void block_15FE(SiRecompiled::Context& ctx)
+{
+	// 15FE  0C
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val + 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	ctx.PC = 0x15FF;
+}
+
+static void block_15FF(SiRecompiled::Context& ctx)
+{
+	// 15FF  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1600  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1601  C2 F9 15
+	ctx.PC = (ctx.flag_Z == 0) ? 0x15F9 : 0x1604;
+	ctx.cycles += 10;
+}
+
+static void block_1604(SiRecompiled::Context& ctx)
+{
+	// 1604  79
+	ctx.A = ctx.C;
+	ctx.cycles += 5;
+	// 1605  32 82 20
+	ctx.write(0x2082, ctx.A);
+	ctx.cycles += 13;
+	// 1608  FE 01
+	{ uint8_t val = 0x01; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 160A  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x160B; ctx.cycles += 5; }
+}
+
+static void block_160B(SiRecompiled::Context& ctx)
+{
+	// 160B  21 6B 20
+	ctx.setHL(0x206B);
+	ctx.cycles += 10;
+	// 160E  36 01
+	ctx.write(ctx.getHL(), 0x01);
+	ctx.cycles += 10;
+	// 1610  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1611(SiRecompiled::Context& ctx)
+{
+	// 1611  2E 00
+	ctx.L = 0x00;
+	ctx.cycles += 7;
+	// 1613  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 1616  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 1617  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1618(SiRecompiled::Context& ctx)
+{
+	// 1618  3A 15 20
+	ctx.A = ctx.read(0x2015);
+	ctx.cycles += 13;
+	// 161B  FE FF
+	{ uint8_t val = 0xFF; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 161D  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x161E; ctx.cycles += 5; }
+}
+
+static void block_161E(SiRecompiled::Context& ctx)
+{
+	// 161E  21 10 20
+	ctx.setHL(0x2010);
+	ctx.cycles += 10;
+	// 1621  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1622  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1623  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1624  B0
+	{ uint8_t res = ctx.A | ctx.B; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1625  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x1626; ctx.cycles += 5; }
+}
+
+static void block_1626(SiRecompiled::Context& ctx)
+{
+	// 1626  3A 25 20
+	ctx.A = ctx.read(0x2025);
+	ctx.cycles += 13;
+	// 1629  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 162A  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x162B; ctx.cycles += 5; }
+}
+
+static void block_162B(SiRecompiled::Context& ctx)
+{
+	// 162B  3A EF 20
+	ctx.A = ctx.read(0x20EF);
+	ctx.cycles += 13;
+	// 162E  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 162F  CA 52 16
+	ctx.PC = (ctx.flag_Z != 0) ? 0x1652 : 0x1632;
+	ctx.cycles += 10;
+}
+
+static void block_1632(SiRecompiled::Context& ctx)
+{
+	// 1632  3A 2D 20
+	ctx.A = ctx.read(0x202D);
+	ctx.cycles += 13;
+	// 1635  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1636  C2 48 16
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1648 : 0x1639;
+	ctx.cycles += 10;
+}
+
+static void block_1639(SiRecompiled::Context& ctx)
+{
+	// 1639  CD C0 17
+	ctx.push(0x163C);
+	ctx.PC = 0x17C0;
+	ctx.cycles += 17;
+}
+
+static void block_163C(SiRecompiled::Context& ctx)
+{
+	// 163C  E6 10
+	{ uint8_t res = ctx.A & 0x10; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 163E  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x163F; ctx.cycles += 5; }
+}
+
+static void block_163F(SiRecompiled::Context& ctx)
+{
+	// 163F  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 1641  32 25 20
+	ctx.write(0x2025, ctx.A);
+	ctx.cycles += 13;
+	// 1644  32 2D 20
+	ctx.write(0x202D, ctx.A);
+	ctx.cycles += 13;
+	// 1647  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1648(SiRecompiled::Context& ctx)
+{
+	// 1648  CD C0 17
+	ctx.push(0x164B);
+	ctx.PC = 0x17C0;
+	ctx.cycles += 17;
+}
+
+static void block_164B(SiRecompiled::Context& ctx)
+{
+	// 164B  E6 10
+	{ uint8_t res = ctx.A & 0x10; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 164D  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x164E; ctx.cycles += 5; }
+}
+
+static void block_164E(SiRecompiled::Context& ctx)
+{
+	// 164E  32 2D 20
+	ctx.write(0x202D, ctx.A);
+	ctx.cycles += 13;
+	// 1651  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1652(SiRecompiled::Context& ctx)
+{
+	// 1652  21 25 20
+	ctx.setHL(0x2025);
+	ctx.cycles += 10;
+	// 1655  36 01
+	ctx.write(ctx.getHL(), 0x01);
+	ctx.cycles += 10;
+	// 1657  2A ED 20
+	ctx.L = ctx.read(0x20ED);
+	ctx.H = ctx.read(0x20EE);
+	ctx.cycles += 16;
+	// 165A  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 165B  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 165C  FE 7E
+	{ uint8_t val = 0x7E; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 165E  DA 63 16
+	ctx.PC = (ctx.flag_C != 0) ? 0x1663 : 0x1661;
+	ctx.cycles += 10;
+}
+
+static void block_1661(SiRecompiled::Context& ctx)
+{
+	// 1661  2E 74
+	ctx.L = 0x74;
+	ctx.cycles += 7;
+	ctx.PC = 0x1663;
+}
+
+static void block_1663(SiRecompiled::Context& ctx)
+{
+	// 1663  22 ED 20
+	ctx.write(0x20ED, ctx.L);
+	ctx.write(0x20EE, ctx.H);
+	ctx.cycles += 16;
+	// 1666  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1667  32 1D 20
+	ctx.write(0x201D, ctx.A);
+	ctx.cycles += 13;
+	// 166A  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_166B(SiRecompiled::Context& ctx)
+{
+	// 166B  37
+	ctx.flag_C = 1;
+	ctx.cycles += 4;
+	// 166C  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1671(SiRecompiled::Context& ctx)
+{
+	// 1671  CD 10 19
+	ctx.push(0x1674);
+	ctx.PC = 0x1910;
+	ctx.cycles += 17;
+}
+
+static void block_1674(SiRecompiled::Context& ctx)
+{
+	// 1674  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 1676  CD CA 09
+	ctx.push(0x1679);
+	ctx.PC = 0x09CA;
+	ctx.cycles += 17;
+}
+
+static void block_1679(SiRecompiled::Context& ctx)
+{
+	// 1679  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 167A  11 F5 20
+	ctx.setDE(0x20F5);
+	ctx.cycles += 10;
+	// 167D  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 167E  BE
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 167F  1B
+	ctx.setDE((uint16_t)(ctx.getDE() - 1));
+	ctx.cycles += 5;
+	// 1680  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 1681  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 1682  CA 8B 16
+	ctx.PC = (ctx.flag_Z != 0) ? 0x168B : 0x1685;
+	ctx.cycles += 10;
+}
+
+static void block_1685(SiRecompiled::Context& ctx)
+{
+	// 1685  D2 98 16
+	ctx.PC = (ctx.flag_C == 0) ? 0x1698 : 0x1688;
+	ctx.cycles += 10;
+}
+
+static void block_1688(SiRecompiled::Context& ctx)
+{
+	// 1688  C3 8F 16
+	ctx.PC = 0x168F;
+	ctx.cycles += 10;
+}
+
+static void block_168B(SiRecompiled::Context& ctx)
+{
+	// 168B  BE
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 168C  D2 98 16
+	ctx.PC = (ctx.flag_C == 0) ? 0x1698 : 0x168F;
+	ctx.cycles += 10;
+}
+
+static void block_168F(SiRecompiled::Context& ctx)
+{
+	// 168F  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1690  12
+	ctx.write(ctx.getDE(), ctx.A);
+	ctx.cycles += 7;
+	// 1691  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 1692  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1693  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1694  12
+	ctx.write(ctx.getDE(), ctx.A);
+	ctx.cycles += 7;
+	// 1695  CD 50 19
+	ctx.push(0x1698);
+	ctx.PC = 0x1950;
+	ctx.cycles += 17;
+}
+
+static void block_1698(SiRecompiled::Context& ctx)
+{
+	// 1698  3A CE 20
+	ctx.A = ctx.read(0x20CE);
+	ctx.cycles += 13;
+	// 169B  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 169C  CA C9 16
+	ctx.PC = (ctx.flag_Z != 0) ? 0x16C9 : 0x169F;
+	ctx.cycles += 10;
+}
+
+static void block_169F(SiRecompiled::Context& ctx)
+{
+	// 169F  21 03 28
+	ctx.setHL(0x2803);
+	ctx.cycles += 10;
+	// 16A2  11 A6 1A
+	ctx.setDE(0x1AA6);
+	ctx.cycles += 10;
+	// 16A5  0E 14
+	ctx.C = 0x14;
+	ctx.cycles += 7;
+	// 16A7  CD 93 0A
+	ctx.push(0x16AA);
+	ctx.PC = 0x0A93;
+	ctx.cycles += 17;
+}
+
+static void block_16AA(SiRecompiled::Context& ctx)
+{
+	// 16AA  25
+	{ uint8_t val = ctx.H; uint8_t res = (uint8_t)(val - 1);
+	  ctx.H = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 16AB  25
+	{ uint8_t val = ctx.H; uint8_t res = (uint8_t)(val - 1);
+	  ctx.H = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 16AC  06 1B
+	ctx.B = 0x1B;
+	ctx.cycles += 7;
+	// 16AE  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 16B1  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 16B2  DA B7 16
+	ctx.PC = (ctx.flag_C != 0) ? 0x16B7 : 0x16B5;
+	ctx.cycles += 10;
+}
+
+static void block_16B5(SiRecompiled::Context& ctx)
+{
+	// 16B5  06 1C
+	ctx.B = 0x1C;
+	ctx.cycles += 7;
+	ctx.PC = 0x16B7;
+}
+
+static void block_16B7(SiRecompiled::Context& ctx)
+{
+	// 16B7  78
+	ctx.A = ctx.B;
+	ctx.cycles += 5;
+	// 16B8  CD FF 08
+	ctx.push(0x16BB);
+	ctx.PC = 0x08FF;
+	ctx.cycles += 17;
+}
+
+static void block_16BB(SiRecompiled::Context& ctx)
+{
+	// 16BB  CD B1 0A
+	ctx.push(0x16BE);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_16BE(SiRecompiled::Context& ctx)
+{
+	// 16BE  CD E7 18
+	ctx.push(0x16C1);
+	ctx.PC = 0x18E7;
+	ctx.cycles += 17;
+}
+
+static void block_16C1(SiRecompiled::Context& ctx)
+{
+	// 16C1  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 16C2  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 16C3  CA C9 16
+	ctx.PC = (ctx.flag_Z != 0) ? 0x16C9 : 0x16C6;
+	ctx.cycles += 10;
+}
+
+static void block_16C6(SiRecompiled::Context& ctx)
+{
+	// 16C6  C3 ED 02
+	ctx.PC = 0x02ED;
+	ctx.cycles += 10;
+}
+
+static void block_16C9(SiRecompiled::Context& ctx)
+{
+	// 16C9  21 18 2D
+	ctx.setHL(0x2D18);
+	ctx.cycles += 10;
+	// 16CC  11 A6 1A
+	ctx.setDE(0x1AA6);
+	ctx.cycles += 10;
+	// 16CF  0E 0A
+	ctx.C = 0x0A;
+	ctx.cycles += 7;
+	// 16D1  CD 93 0A
+	ctx.push(0x16D4);
+	ctx.PC = 0x0A93;
+	ctx.cycles += 17;
+}
+
+static void block_16D4(SiRecompiled::Context& ctx)
+{
+	// 16D4  CD B6 0A
+	ctx.push(0x16D7);
+	ctx.PC = 0x0AB6;
+	ctx.cycles += 17;
+}
+
+static void block_16D7(SiRecompiled::Context& ctx)
+{
+	// 16D7  CD D6 09
+	ctx.push(0x16DA);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_16DA(SiRecompiled::Context& ctx)
+{
+	// 16DA  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 16DB  32 EF 20
+	ctx.write(0x20EF, ctx.A);
+	ctx.cycles += 13;
+	// 16DE  D3 05
+	ctx.cycles += 10;
+	ctx.out(0x05);
+	// 16E0  CD D1 19
+	ctx.push(0x16E3);
+	ctx.PC = 0x19D1;
+	ctx.cycles += 17;
+}
+
+static void block_16E3(SiRecompiled::Context& ctx)
+{
+	// 16E3  C3 89 0B
+	ctx.PC = 0x0B89;
+	ctx.cycles += 10;
+}
+
+static void block_16E6(SiRecompiled::Context& ctx)
+{
+	// 16E6  31 00 24
+	ctx.SP = 0x2400;
+	ctx.cycles += 10;
+	ctx.PC = 0x16E9;
+}
+
+static void block_16EA(SiRecompiled::Context& ctx)
+{
+	// 16EA  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 16EB  32 15 20
+	ctx.write(0x2015, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x16EE;
+}
+
+static void block_16EE(SiRecompiled::Context& ctx)
+{
+	// 16EE  CD D8 14
+	ctx.push(0x16F1);
+	ctx.PC = 0x14D8;
+	ctx.cycles += 17;
+}
+
+static void block_16F1(SiRecompiled::Context& ctx)
+{
+	// 16F1  06 04
+	ctx.B = 0x04;
+	ctx.cycles += 7;
+	// 16F3  CD FA 18
+	ctx.push(0x16F6);
+	ctx.PC = 0x18FA;
+	ctx.cycles += 17;
+}
+
+static void block_16F6(SiRecompiled::Context& ctx)
+{
+	// 16F6  CD 59 0A
+	ctx.push(0x16F9);
+	ctx.PC = 0x0A59;
+	ctx.cycles += 17;
+}
+
+static void block_16F9(SiRecompiled::Context& ctx)
+{
+	// 16F9  C2 EE 16
+	ctx.PC = (ctx.flag_Z == 0) ? 0x16EE : 0x16FC;
+	ctx.cycles += 10;
+}
+
+static void block_16FC(SiRecompiled::Context& ctx)
+{
+	// 16FC  CD D7 19
+	ctx.push(0x16FF);
+	ctx.PC = 0x19D7;
+	ctx.cycles += 17;
+}
+
+static void block_16FF(SiRecompiled::Context& ctx)
+{
+	// 16FF  21 01 27
+	ctx.setHL(0x2701);
+	ctx.cycles += 10;
+	// 1702  CD FA 19
+	ctx.push(0x1705);
+	ctx.PC = 0x19FA;
+	ctx.cycles += 17;
+}
+
+static void block_1705(SiRecompiled::Context& ctx)
+{
+	// 1705  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1706  CD 8B 1A
+	ctx.push(0x1709);
+	ctx.PC = 0x1A8B;
+	ctx.cycles += 17;
+}
+
+static void block_1709(SiRecompiled::Context& ctx)
+{
+	// 1709  06 FB
+	ctx.B = 0xFB;
+	ctx.cycles += 7;
+	// 170B  C3 6B 19
+	ctx.PC = 0x196B;
+	ctx.cycles += 10;
+}
+
+static void block_170E(SiRecompiled::Context& ctx)
+{
+	// 170E  CD CA 09
+	ctx.push(0x1711);
+	ctx.PC = 0x09CA;
+	ctx.cycles += 17;
+}
+
+static void block_1711(SiRecompiled::Context& ctx)
+{
+	// 1711  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1712  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1713  11 B8 1C
+	ctx.setDE(0x1CB8);
+	ctx.cycles += 10;
+	// 1716  21 A1 1A
+	ctx.setHL(0x1AA1);
+	ctx.cycles += 10;
+	// 1719  0E 04
+	ctx.C = 0x04;
+	ctx.cycles += 7;
+	// 171B  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	ctx.PC = 0x171C;
+}
+
+static void block_171C(SiRecompiled::Context& ctx)
+{
+	// 171C  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 171D  B8
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 171E  D2 27 17
+	ctx.PC = (ctx.flag_C == 0) ? 0x1727 : 0x1721;
+	ctx.cycles += 10;
+}
+
+static void block_1721(SiRecompiled::Context& ctx)
+{
+	// 1721  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1722  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 1723  0D
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val - 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1724  C2 1C 17
+	ctx.PC = (ctx.flag_Z == 0) ? 0x171C : 0x1727;
+	ctx.cycles += 10;
+}
+
+static void block_1727(SiRecompiled::Context& ctx)
+{
+	// 1727  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1728  32 CF 20
+	ctx.write(0x20CF, ctx.A);
+	ctx.cycles += 13;
+	// 172B  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_172C(SiRecompiled::Context& ctx)
+{
+	// 172C  3A 25 20
+	ctx.A = ctx.read(0x2025);
+	ctx.cycles += 13;
+	// 172F  FE 00
+	{ uint8_t val = 0x00; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1731  C2 39 17
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1739 : 0x1734;
+	ctx.cycles += 10;
+}
+
+static void block_1734(SiRecompiled::Context& ctx)
+{
+	// 1734  06 FD
+	ctx.B = 0xFD;
+	ctx.cycles += 7;
+	// 1736  C3 DC 19
+	ctx.PC = 0x19DC;
+	ctx.cycles += 10;
+}
+
+static void block_1739(SiRecompiled::Context& ctx)
+{
+	// 1739  06 02
+	ctx.B = 0x02;
+	ctx.cycles += 7;
+	// 173B  C3 FA 18
+	ctx.PC = 0x18FA;
+	ctx.cycles += 10;
+}
+
+static void block_1740(SiRecompiled::Context& ctx)
+{
+	// 1740  21 9B 20
+	ctx.setHL(0x209B);
+	ctx.cycles += 10;
+	// 1743  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 1744  CC 6D 17
+	if (ctx.flag_Z != 0) { ctx.push(0x1747); ctx.PC = 0x176D; ctx.cycles += 17; }
+	else { ctx.PC = 0x1747; ctx.cycles += 11; }
+}
+
+static void block_1747(SiRecompiled::Context& ctx)
+{
+	// 1747  3A 68 20
+	ctx.A = ctx.read(0x2068);
+	ctx.cycles += 13;
+	// 174A  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 174B  CA 6D 17
+	ctx.PC = (ctx.flag_Z != 0) ? 0x176D : 0x174E;
+	ctx.cycles += 10;
+}
+
+static void block_174E(SiRecompiled::Context& ctx)
+{
+	// 174E  21 96 20
+	ctx.setHL(0x2096);
+	ctx.cycles += 10;
+	// 1751  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 1752  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x1753; ctx.cycles += 5; }
+}
+
+static void block_1753(SiRecompiled::Context& ctx)
+{
+	// 1753  21 98 20
+	ctx.setHL(0x2098);
+	ctx.cycles += 10;
+	// 1756  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1757  D3 05
+	ctx.cycles += 10;
+	ctx.out(0x05);
+	// 1759  3A 82 20
+	ctx.A = ctx.read(0x2082);
+	ctx.cycles += 13;
+	// 175C  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 175D  CA 6D 17
+	ctx.PC = (ctx.flag_Z != 0) ? 0x176D : 0x1760;
+	ctx.cycles += 10;
+}
+
+static void block_1760(SiRecompiled::Context& ctx)
+{
+	// 1760  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 1761  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1762  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 1763  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 1764  2B
+	ctx.setHL((uint16_t)(ctx.getHL() - 1));
+	ctx.cycles += 5;
+	// 1765  36 01
+	ctx.write(ctx.getHL(), 0x01);
+	ctx.cycles += 10;
+	// 1767  3E 04
+	ctx.A = 0x04;
+	ctx.cycles += 7;
+	// 1769  32 9B 20
+	ctx.write(0x209B, ctx.A);
+	ctx.cycles += 13;
+	// 176C  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_176D(SiRecompiled::Context& ctx)
+{
+	// 176D  3A 98 20
+	ctx.A = ctx.read(0x2098);
+	ctx.cycles += 13;
+	// 1770  E6 30
+	{ uint8_t res = ctx.A & 0x30; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1772  D3 05
+	ctx.cycles += 10;
+	ctx.out(0x05);
+	// 1774  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1775(SiRecompiled::Context& ctx)
+{
+	// 1775  3A 95 20
+	ctx.A = ctx.read(0x2095);
+	ctx.cycles += 13;
+	// 1778  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1779  CA AA 17
+	ctx.PC = (ctx.flag_Z != 0) ? 0x17AA : 0x177C;
+	ctx.cycles += 10;
+}
+
+static void block_177C(SiRecompiled::Context& ctx)
+{
+	// 177C  21 11 1A
+	ctx.setHL(0x1A11);
+	ctx.cycles += 10;
+	// 177F  11 21 1A
+	ctx.setDE(0x1A21);
+	ctx.cycles += 10;
+	// 1782  3A 82 20
+	ctx.A = ctx.read(0x2082);
+	ctx.cycles += 13;
+	ctx.PC = 0x1785;
+}
+
+static void block_1785(SiRecompiled::Context& ctx)
+{
+	// 1785  BE
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1786  D2 8E 17
+	ctx.PC = (ctx.flag_C == 0) ? 0x178E : 0x1789;
+	ctx.cycles += 10;
+}
+
+static void block_1789(SiRecompiled::Context& ctx)
+{
+	// 1789  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 178A  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 178B  C3 85 17
+	ctx.PC = 0x1785;
+	ctx.cycles += 10;
+}
+
+static void block_178E(SiRecompiled::Context& ctx)
+{
+	// 178E  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 178F  32 97 20
+	ctx.write(0x2097, ctx.A);
+	ctx.cycles += 13;
+	// 1792  21 98 20
+	ctx.setHL(0x2098);
+	ctx.cycles += 10;
+	// 1795  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1796  E6 30
+	{ uint8_t res = ctx.A & 0x30; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1798  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	// 1799  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 179A  E6 0F
+	{ uint8_t res = ctx.A & 0x0F; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 179C  07
+	{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 179D  FE 10
+	{ uint8_t val = 0x10; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 179F  C2 A4 17
+	ctx.PC = (ctx.flag_Z == 0) ? 0x17A4 : 0x17A2;
+	ctx.cycles += 10;
+}
+
+static void block_17A2(SiRecompiled::Context& ctx)
+{
+	// 17A2  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	ctx.PC = 0x17A4;
+}
+
+static void block_17A4(SiRecompiled::Context& ctx)
+{
+	// 17A4  B0
+	{ uint8_t res = ctx.A | ctx.B; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 17A5  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 17A6  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 17A7  32 95 20
+	ctx.write(0x2095, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x17AA;
+}
+
+static void block_17AA(SiRecompiled::Context& ctx)
+{
+	// 17AA  21 99 20
+	ctx.setHL(0x2099);
+	ctx.cycles += 10;
+	// 17AD  35
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val - 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 17AE  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x17AF; ctx.cycles += 5; }
+}
+
+static void block_17AF(SiRecompiled::Context& ctx)
+{
+	// 17AF  06 EF
+	ctx.B = 0xEF;
+	ctx.cycles += 7;
+	// 17B1  C3 DC 19
+	ctx.PC = 0x19DC;
+	ctx.cycles += 10;
+}
+
+static void block_17C0(SiRecompiled::Context& ctx)
+{
+	// 17C0  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 17C3  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 17C4  D2 CA 17
+	ctx.PC = (ctx.flag_C == 0) ? 0x17CA : 0x17C7;
+	ctx.cycles += 10;
+}
+
+static void block_17C7(SiRecompiled::Context& ctx)
+{
+	// 17C7  DB 01
+	ctx.in(0x01);
+	ctx.cycles += 10;
+	// 17C9  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_17CA(SiRecompiled::Context& ctx)
+{
+	// 17CA  DB 02
+	ctx.in(0x02);
+	ctx.cycles += 10;
+	// 17CC  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_17CD(SiRecompiled::Context& ctx)
+{
+	// 17CD  DB 02
+	ctx.in(0x02);
+	ctx.cycles += 10;
+	// 17CF  E6 04
+	{ uint8_t res = ctx.A & 0x04; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 17D1  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x17D2; ctx.cycles += 5; }
+}
+
+static void block_17D2(SiRecompiled::Context& ctx)
+{
+	// 17D2  3A 9A 20
+	ctx.A = ctx.read(0x209A);
+	ctx.cycles += 13;
+	// 17D5  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 17D6  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x17D7; ctx.cycles += 5; }
+}
+
+static void block_17D7(SiRecompiled::Context& ctx)
+{
+	// 17D7  31 00 24
+	ctx.SP = 0x2400;
+	ctx.cycles += 10;
+	// 17DA  06 04
+	ctx.B = 0x04;
+	ctx.cycles += 7;
+	ctx.PC = 0x17DC;
+}
+
+static void block_17DC(SiRecompiled::Context& ctx)
+{
+	// 17DC  CD D6 09
+	ctx.push(0x17DF);
+	ctx.PC = 0x09D6;
+	ctx.cycles += 17;
+}
+
+static void block_17DF(SiRecompiled::Context& ctx)
+{
+	// 17DF  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 17E0  C2 DC 17
+	ctx.PC = (ctx.flag_Z == 0) ? 0x17DC : 0x17E3;
+	ctx.cycles += 10;
+}
+
+static void block_17E3(SiRecompiled::Context& ctx)
+{
+	// 17E3  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 17E5  32 9A 20
+	ctx.write(0x209A, ctx.A);
+	ctx.cycles += 13;
+	// 17E8  CD D7 19
+	ctx.push(0x17EB);
+	ctx.PC = 0x19D7;
+	ctx.cycles += 17;
+}
+
+static void block_17EC(SiRecompiled::Context& ctx)
+{
+	// 17EC  11 BC 1C
+	ctx.setDE(0x1CBC);
+	ctx.cycles += 10;
+	// 17EF  21 16 30
+	ctx.setHL(0x3016);
+	ctx.cycles += 10;
+	// 17F2  0E 04
+	ctx.C = 0x04;
+	ctx.cycles += 7;
+	// 17F4  CD 93 0A
+	ctx.push(0x17F7);
+	ctx.PC = 0x0A93;
+	ctx.cycles += 17;
+}
+
+static void block_17F7(SiRecompiled::Context& ctx)
+{
+	// 17F7  CD B1 0A
+	ctx.push(0x17FA);
+	ctx.PC = 0x0AB1;
+	ctx.cycles += 17;
+}
+
+static void block_17FA(SiRecompiled::Context& ctx)
+{
+	// 17FA  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 17FB  32 9A 20
+	ctx.write(0x209A, ctx.A);
+	ctx.cycles += 13;
+	// 17FE  32 93 20
+	ctx.write(0x2093, ctx.A);
+	ctx.cycles += 13;
+	// 1801  C3 C9 16
+	ctx.PC = 0x16C9;
+	ctx.cycles += 10;
+}
+
+static void block_1804(SiRecompiled::Context& ctx)
+{
+	// 1804  21 84 20
+	ctx.setHL(0x2084);
+	ctx.cycles += 10;
+	// 1807  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1808  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1809  CA 07 07
+	ctx.PC = (ctx.flag_Z != 0) ? 0x0707 : 0x180C;
+	ctx.cycles += 10;
+}
+
+static void block_180C(SiRecompiled::Context& ctx)
+{
+	// 180C  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 180D  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 180E  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 180F  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x1810; ctx.cycles += 5; }
+}
+
+static void block_1810(SiRecompiled::Context& ctx)
+{
+	// 1810  06 01
+	ctx.B = 0x01;
+	ctx.cycles += 7;
+	// 1812  C3 FA 18
+	ctx.PC = 0x18FA;
+	ctx.cycles += 10;
+}
+
+static void block_1815(SiRecompiled::Context& ctx)
+{
+	// 1815  21 10 28
+	ctx.setHL(0x2810);
+	ctx.cycles += 10;
+	// 1818  11 A3 1C
+	ctx.setDE(0x1CA3);
+	ctx.cycles += 10;
+	// 181B  0E 15
+	ctx.C = 0x15;
+	ctx.cycles += 7;
+	// 181D  CD F3 08
+	ctx.push(0x1820);
+	ctx.PC = 0x08F3;
+	ctx.cycles += 17;
+}
+
+static void block_1820(SiRecompiled::Context& ctx)
+{
+	// 1820  3E 0A
+	ctx.A = 0x0A;
+	ctx.cycles += 7;
+	// 1822  32 6C 20
+	ctx.write(0x206C, ctx.A);
+	ctx.cycles += 13;
+	// 1825  01 BE 1D
+	ctx.setBC(0x1DBE);
+	ctx.cycles += 10;
+	ctx.PC = 0x1828;
+}
+
+static void block_1828(SiRecompiled::Context& ctx)
+{
+	// 1828  CD 56 18
+	ctx.push(0x182B);
+	ctx.PC = 0x1856;
+	ctx.cycles += 17;
+}
+
+static void block_182B(SiRecompiled::Context& ctx)
+{
+	// 182B  DA 37 18
+	ctx.PC = (ctx.flag_C != 0) ? 0x1837 : 0x182E;
+	ctx.cycles += 10;
+}
+
+static void block_182E(SiRecompiled::Context& ctx)
+{
+	// 182E  CD 44 18
+	ctx.push(0x1831);
+	ctx.PC = 0x1844;
+	ctx.cycles += 17;
+}
+
+static void block_1831(SiRecompiled::Context& ctx)
+{
+	// 1831  C3 28 18
+	ctx.PC = 0x1828;
+	ctx.cycles += 10;
+}
+
+static void block_1837(SiRecompiled::Context& ctx)
+{
+	// 1837  01 CF 1D
+	ctx.setBC(0x1DCF);
+	ctx.cycles += 10;
+	ctx.PC = 0x183A;
+}
+
+static void block_183A(SiRecompiled::Context& ctx)
+{
+	// 183A  CD 56 18
+	ctx.push(0x183D);
+	ctx.PC = 0x1856;
+	ctx.cycles += 17;
+}
+
+static void block_183D(SiRecompiled::Context& ctx)
+{
+	// 183D  D8
+	if (ctx.flag_C != 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x183E; ctx.cycles += 5; }
+}
+
+static void block_183E(SiRecompiled::Context& ctx)
+{
+	// 183E  CD 4C 18
+	ctx.push(0x1841);
+	ctx.PC = 0x184C;
+	ctx.cycles += 17;
+}
+
+static void block_1841(SiRecompiled::Context& ctx)
+{
+	// 1841  C3 3A 18
+	ctx.PC = 0x183A;
+	ctx.cycles += 10;
+}
+
+static void block_1844(SiRecompiled::Context& ctx)
+{
+	// 1844  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 1845  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 1847  CD 39 14
+	ctx.push(0x184A);
+	ctx.PC = 0x1439;
+	ctx.cycles += 17;
+}
+
+static void block_184A(SiRecompiled::Context& ctx)
+{
+	// 184A  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 184B  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_184C(SiRecompiled::Context& ctx)
+{
+	// 184C  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 184D  3A 6C 20
+	ctx.A = ctx.read(0x206C);
+	ctx.cycles += 13;
+	// 1850  4F
+	ctx.C = ctx.A;
+	ctx.cycles += 5;
+	// 1851  CD 93 0A
+	ctx.push(0x1854);
+	ctx.PC = 0x0A93;
+	ctx.cycles += 17;
+}
+
+static void block_1854(SiRecompiled::Context& ctx)
+{
+	// 1854  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 1855  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1856(SiRecompiled::Context& ctx)
+{
+	// 1856  0A
+	ctx.A = ctx.read(ctx.getBC());
+	ctx.cycles += 7;
+	// 1857  FE FF
+	{ uint8_t val = 0xFF; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1859  37
+	ctx.flag_C = 1;
+	ctx.cycles += 4;
+	// 185A  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x185B; ctx.cycles += 5; }
+}
+
+static void block_185B(SiRecompiled::Context& ctx)
+{
+	// 185B  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 185C  03
+	ctx.setBC((uint16_t)(ctx.getBC() + 1));
+	ctx.cycles += 5;
+	// 185D  0A
+	ctx.A = ctx.read(ctx.getBC());
+	ctx.cycles += 7;
+	// 185E  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 185F  03
+	ctx.setBC((uint16_t)(ctx.getBC() + 1));
+	ctx.cycles += 5;
+	// 1860  0A
+	ctx.A = ctx.read(ctx.getBC());
+	ctx.cycles += 7;
+	// 1861  5F
+	ctx.E = ctx.A;
+	ctx.cycles += 5;
+	// 1862  03
+	ctx.setBC((uint16_t)(ctx.getBC() + 1));
+	ctx.cycles += 5;
+	// 1863  0A
+	ctx.A = ctx.read(ctx.getBC());
+	ctx.cycles += 7;
+	// 1864  57
+	ctx.D = ctx.A;
+	ctx.cycles += 5;
+	// 1865  03
+	ctx.setBC((uint16_t)(ctx.getBC() + 1));
+	ctx.cycles += 5;
+	// 1866  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1867  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1868(SiRecompiled::Context& ctx)
+{
+	// 1868  21 C2 20
+	ctx.setHL(0x20C2);
+	ctx.cycles += 10;
+	// 186B  34
+	{ uint8_t val = ctx.read(ctx.getHL()); uint8_t res = (uint8_t)(val + 1);
+	  ctx.write(ctx.getHL(), res); ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 10;
+	// 186C  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 186D  4E
+	ctx.C = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 186E  CD D9 01
+	ctx.push(0x1871);
+	ctx.PC = 0x01D9;
+	ctx.cycles += 17;
+}
+
+static void block_1871(SiRecompiled::Context& ctx)
+{
+	// 1871  47
+	ctx.B = ctx.A;
+	ctx.cycles += 5;
+	// 1872  3A CA 20
+	ctx.A = ctx.read(0x20CA);
+	ctx.cycles += 13;
+	// 1875  B8
+	{ uint8_t val = ctx.B; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1876  CA 98 18
+	ctx.PC = (ctx.flag_Z != 0) ? 0x1898 : 0x1879;
+	ctx.cycles += 10;
+}
+
+static void block_1879(SiRecompiled::Context& ctx)
+{
+	// 1879  3A C2 20
+	ctx.A = ctx.read(0x20C2);
+	ctx.cycles += 13;
+	// 187C  E6 04
+	{ uint8_t res = ctx.A & 0x04; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 187E  2A CC 20
+	ctx.L = ctx.read(0x20CC);
+	ctx.H = ctx.read(0x20CD);
+	ctx.cycles += 16;
+	// 1881  C2 88 18
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1888 : 0x1884;
+	ctx.cycles += 10;
+}
+
+static void block_1884(SiRecompiled::Context& ctx)
+{
+	// 1884  11 30 00
+	ctx.setDE(0x0030);
+	ctx.cycles += 10;
+	// 1887  19
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getDE(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	ctx.PC = 0x1888;
+}
+
+static void block_1888(SiRecompiled::Context& ctx)
+{
+	// 1888  22 C7 20
+	ctx.write(0x20C7, ctx.L);
+	ctx.write(0x20C8, ctx.H);
+	ctx.cycles += 16;
+	// 188B  21 C5 20
+	ctx.setHL(0x20C5);
+	ctx.cycles += 10;
+	// 188E  CD 3B 1A
+	ctx.push(0x1891);
+	ctx.PC = 0x1A3B;
+	ctx.cycles += 17;
+}
+
+static void block_1891(SiRecompiled::Context& ctx)
+{
+	// 1891  EB
+	{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }
+	ctx.cycles += 5;
+	// 1892  C3 D3 15
+	ctx.PC = 0x15D3;
+	ctx.cycles += 10;
+}
+
+static void block_1898(SiRecompiled::Context& ctx)
+{
+	// 1898  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 189A  32 CB 20
+	ctx.write(0x20CB, ctx.A);
+	ctx.cycles += 13;
+	// 189D  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_189E(SiRecompiled::Context& ctx)
+{
+	// 189E  21 50 20
+	ctx.setHL(0x2050);
+	ctx.cycles += 10;
+	// 18A1  11 C0 1B
+	ctx.setDE(0x1BC0);
+	ctx.cycles += 10;
+	// 18A4  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 18A6  CD 32 1A
+	ctx.push(0x18A9);
+	ctx.PC = 0x1A32;
+	ctx.cycles += 17;
+}
+
+static void block_18A9(SiRecompiled::Context& ctx)
+{
+	// 18A9  3E 02
+	ctx.A = 0x02;
+	ctx.cycles += 7;
+	// 18AB  32 80 20
+	ctx.write(0x2080, ctx.A);
+	ctx.cycles += 13;
+	// 18AE  3E FF
+	ctx.A = 0xFF;
+	ctx.cycles += 7;
+	// 18B0  32 7E 20
+	ctx.write(0x207E, ctx.A);
+	ctx.cycles += 13;
+	// 18B3  3E 04
+	ctx.A = 0x04;
+	ctx.cycles += 7;
+	// 18B5  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x18B8;
+}
+
+static void block_18B8(SiRecompiled::Context& ctx)
+{
+	// 18B8  3A 55 20
+	ctx.A = ctx.read(0x2055);
+	ctx.cycles += 13;
+	// 18BB  E6 01
+	{ uint8_t res = ctx.A & 0x01; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 18BD  CA B8 18
+	ctx.PC = (ctx.flag_Z != 0) ? 0x18B8 : 0x18C0;
+	ctx.cycles += 10;
+}
+
+static void block_18C0(SiRecompiled::Context& ctx)
+{
+	// 18C0  3A 55 20
+	ctx.A = ctx.read(0x2055);
+	ctx.cycles += 13;
+	// 18C3  E6 01
+	{ uint8_t res = ctx.A & 0x01; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 18C5  C2 C0 18
+	ctx.PC = (ctx.flag_Z == 0) ? 0x18C0 : 0x18C8;
+	ctx.cycles += 10;
+}
+
+static void block_18C8(SiRecompiled::Context& ctx)
+{
+	// 18C8  21 11 33
+	ctx.setHL(0x3311);
+	ctx.cycles += 10;
+	// 18CB  3E 26
+	ctx.A = 0x26;
+	ctx.cycles += 7;
+	// 18CD  00
+	ctx.cycles += 4;
+	// 18CE  CD FF 08
+	ctx.push(0x18D1);
+	ctx.PC = 0x08FF;
+	ctx.cycles += 17;
+}
+
+static void block_18D1(SiRecompiled::Context& ctx)
+{
+	// 18D1  C3 B6 0A
+	ctx.PC = 0x0AB6;
+	ctx.cycles += 10;
+}
+
+static void block_18D4(SiRecompiled::Context& ctx)
+{
+	// 18D4  31 00 24
+	ctx.SP = 0x2400;
+	ctx.cycles += 10;
+	// 18D7  06 00
+	ctx.B = 0x00;
+	ctx.cycles += 7;
+	// 18D9  CD E6 01
+	ctx.push(0x18DC);
+	ctx.PC = 0x01E6;
+	ctx.cycles += 17;
+}
+
+static void block_18DC(SiRecompiled::Context& ctx)
+{
+	// 18DC  CD 56 19
+	ctx.push(0x18DF);
+	ctx.PC = 0x1956;
+	ctx.cycles += 17;
+}
+
+static void block_18DF(SiRecompiled::Context& ctx)
+{
+	// 18DF  3E 08
+	ctx.A = 0x08;
+	ctx.cycles += 7;
+	// 18E1  32 CF 20
+	ctx.write(0x20CF, ctx.A);
+	ctx.cycles += 13;
+	// 18E4  C3 EA 0A
+	ctx.PC = 0x0AEA;
+	ctx.cycles += 10;
+}
+
+static void block_18E7(SiRecompiled::Context& ctx)
+{
+	// 18E7  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 18EA  21 E7 20
+	ctx.setHL(0x20E7);
+	ctx.cycles += 10;
+	// 18ED  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 18EE  D0
+	if (ctx.flag_C == 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x18EF; ctx.cycles += 5; }
+}
+
+static void block_18EF(SiRecompiled::Context& ctx)
+{
+	// 18EF  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 18F0  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_18F1(SiRecompiled::Context& ctx)
+{
+	// 18F1  06 02
+	ctx.B = 0x02;
+	ctx.cycles += 7;
+	// 18F3  3A 82 20
+	ctx.A = ctx.read(0x2082);
+	ctx.cycles += 13;
+	// 18F6  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 18F7  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x18F8; ctx.cycles += 5; }
+}
+
+static void block_18F8(SiRecompiled::Context& ctx)
+{
+	// 18F8  04
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val + 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 18F9  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_18FA(SiRecompiled::Context& ctx)
+{
+	// 18FA  3A 94 20
+	ctx.A = ctx.read(0x2094);
+	ctx.cycles += 13;
+	// 18FD  B0
+	{ uint8_t res = ctx.A | ctx.B; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 18FE  32 94 20
+	ctx.write(0x2094, ctx.A);
+	ctx.cycles += 13;
+	// 1901  D3 03
+	ctx.cycles += 10;
+	ctx.out(0x03);
+	// 1903  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1904(SiRecompiled::Context& ctx)
+{
+	// 1904  21 00 22
+	ctx.setHL(0x2200);
+	ctx.cycles += 10;
+	// 1907  C3 C3 01
+	ctx.PC = 0x01C3;
+	ctx.cycles += 10;
+}
+
+static void block_190A(SiRecompiled::Context& ctx)
+{
+	// 190A  CD D8 14
+	ctx.push(0x190D);
+	ctx.PC = 0x14D8;
+	ctx.cycles += 17;
+}
+
+static void block_190D(SiRecompiled::Context& ctx)
+{
+	// 190D  C3 97 15
+	ctx.PC = 0x1597;
+	ctx.cycles += 10;
+}
+
+static void block_1910(SiRecompiled::Context& ctx)
+{
+	// 1910  21 E7 20
+	ctx.setHL(0x20E7);
+	ctx.cycles += 10;
+	// 1913  3A 67 20
+	ctx.A = ctx.read(0x2067);
+	ctx.cycles += 13;
+	// 1916  0F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 1917  D8
+	if (ctx.flag_C != 0) { ctx.PC = ctx.pop(); ctx.cycles += 11; }
+	else { ctx.PC = 0x1918; ctx.cycles += 5; }
+}
+
+static void block_1918(SiRecompiled::Context& ctx)
+{
+	// 1918  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1919  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_191A(SiRecompiled::Context& ctx)
+{
+	// 191A  0E 1C
+	ctx.C = 0x1C;
+	ctx.cycles += 7;
+	// 191C  21 1E 24
+	ctx.setHL(0x241E);
+	ctx.cycles += 10;
+	// 191F  11 E4 1A
+	ctx.setDE(0x1AE4);
+	ctx.cycles += 10;
+	// 1922  C3 F3 08
+	ctx.PC = 0x08F3;
+	ctx.cycles += 10;
+}
+
+static void block_1925(SiRecompiled::Context& ctx)
+{
+	// 1925  21 F8 20
+	ctx.setHL(0x20F8);
+	ctx.cycles += 10;
+	// 1928  C3 31 19
+	ctx.PC = 0x1931;
+	ctx.cycles += 10;
+}
+
+static void block_192B(SiRecompiled::Context& ctx)
+{
+	// 192B  21 FC 20
+	ctx.setHL(0x20FC);
+	ctx.cycles += 10;
+	// 192E  C3 31 19
+	ctx.PC = 0x1931;
+	ctx.cycles += 10;
+}
+
+static void block_1931(SiRecompiled::Context& ctx)
+{
+	// 1931  5E
+	ctx.E = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1932  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1933  56
+	ctx.D = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1934  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1935  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1936  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1937  66
+	ctx.H = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1938  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 1939  C3 AD 09
+	ctx.PC = 0x09AD;
+	ctx.cycles += 10;
+}
+
+static void block_193C(SiRecompiled::Context& ctx)
+{
+	// 193C  0E 07
+	ctx.C = 0x07;
+	ctx.cycles += 7;
+	// 193E  21 01 35
+	ctx.setHL(0x3501);
+	ctx.cycles += 10;
+	// 1941  11 A9 1F
+	ctx.setDE(0x1FA9);
+	ctx.cycles += 10;
+	// 1944  C3 F3 08
+	ctx.PC = 0x08F3;
+	ctx.cycles += 10;
+}
+
+static void block_1947(SiRecompiled::Context& ctx)
+{
+	// 1947  3A EB 20
+	ctx.A = ctx.read(0x20EB);
+	ctx.cycles += 13;
+	// 194A  21 01 3C
+	ctx.setHL(0x3C01);
+	ctx.cycles += 10;
+	// 194D  C3 B2 09
+	ctx.PC = 0x09B2;
+	ctx.cycles += 10;
+}
+
+static void block_1950(SiRecompiled::Context& ctx)
+{
+	// 1950  21 F4 20
+	ctx.setHL(0x20F4);
+	ctx.cycles += 10;
+	// 1953  C3 31 19
+	ctx.PC = 0x1931;
+	ctx.cycles += 10;
+}
+
+static void block_1956(SiRecompiled::Context& ctx)
+{
+	// 1956  CD 5C 1A
+	ctx.push(0x1959);
+	ctx.PC = 0x1A5C;
+	ctx.cycles += 17;
+}
+
+static void block_1959(SiRecompiled::Context& ctx)
+{
+	// 1959  CD 1A 19
+	ctx.push(0x195C);
+	ctx.PC = 0x191A;
+	ctx.cycles += 17;
+}
+
+static void block_195C(SiRecompiled::Context& ctx)
+{
+	// 195C  CD 25 19
+	ctx.push(0x195F);
+	ctx.PC = 0x1925;
+	ctx.cycles += 17;
+}
+
+static void block_195F(SiRecompiled::Context& ctx)
+{
+	// 195F  CD 2B 19
+	ctx.push(0x1962);
+	ctx.PC = 0x192B;
+	ctx.cycles += 17;
+}
+
+static void block_1962(SiRecompiled::Context& ctx)
+{
+	// 1962  CD 50 19
+	ctx.push(0x1965);
+	ctx.PC = 0x1950;
+	ctx.cycles += 17;
+}
+
+static void block_1965(SiRecompiled::Context& ctx)
+{
+	// 1965  CD 3C 19
+	ctx.push(0x1968);
+	ctx.PC = 0x193C;
+	ctx.cycles += 17;
+}
+
+static void block_1968(SiRecompiled::Context& ctx)
+{
+	// 1968  C3 47 19
+	ctx.PC = 0x1947;
+	ctx.cycles += 10;
+}
+
+static void block_196B(SiRecompiled::Context& ctx)
+{
+	// 196B  CD DC 19
+	ctx.push(0x196E);
+	ctx.PC = 0x19DC;
+	ctx.cycles += 17;
+}
+
+static void block_196E(SiRecompiled::Context& ctx)
+{
+	// 196E  C3 71 16
+	ctx.PC = 0x1671;
+	ctx.cycles += 10;
+}
+
+static void block_1971(SiRecompiled::Context& ctx)
+{
+	// 1971  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	// 1973  32 6D 20
+	ctx.write(0x206D, ctx.A);
+	ctx.cycles += 13;
+	// 1976  C3 E6 16
+	ctx.PC = 0x16E6;
+	ctx.cycles += 10;
+}
+
+static void block_1979(SiRecompiled::Context& ctx)
+{
+	// 1979  CD D7 19
+	ctx.push(0x197C);
+	ctx.PC = 0x19D7;
+	ctx.cycles += 17;
+}
+
+static void block_197C(SiRecompiled::Context& ctx)
+{
+	// 197C  CD 47 19
+	ctx.push(0x197F);
+	ctx.PC = 0x1947;
+	ctx.cycles += 17;
+}
+
+static void block_197F(SiRecompiled::Context& ctx)
+{
+	// 197F  C3 3C 19
+	ctx.PC = 0x193C;
+	ctx.cycles += 10;
+}
+
+static void block_1982(SiRecompiled::Context& ctx)
+{
+	// 1982  32 C1 20
+	ctx.write(0x20C1, ctx.A);
+	ctx.cycles += 13;
+	// 1985  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1988(SiRecompiled::Context& ctx)
+{
+	// 1988  C3 D6 09
+	ctx.PC = 0x09D6;
+	ctx.cycles += 10;
+}
+
+static void block_199A(SiRecompiled::Context& ctx)
+{
+	// 199A  3A 1E 20
+	ctx.A = ctx.read(0x201E);
+	ctx.cycles += 13;
+	// 199D  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 199E  C2 AC 19
+	ctx.PC = (ctx.flag_Z == 0) ? 0x19AC : 0x19A1;
+	ctx.cycles += 10;
+}
+
+static void block_19A1(SiRecompiled::Context& ctx)
+{
+	// 19A1  DB 01
+	ctx.in(0x01);
+	ctx.cycles += 10;
+	// 19A3  E6 76
+	{ uint8_t res = ctx.A & 0x76; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 19A5  D6 72
+	{ uint8_t val = 0x72; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 19A7  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x19A8; ctx.cycles += 5; }
+}
+
+static void block_19A8(SiRecompiled::Context& ctx)
+{
+	// 19A8  3C
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val + 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 1) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 19A9  32 1E 20
+	ctx.write(0x201E, ctx.A);
+	ctx.cycles += 13;
+	ctx.PC = 0x19AC;
+}
+
+static void block_19AC(SiRecompiled::Context& ctx)
+{
+	// 19AC  DB 01
+	ctx.in(0x01);
+	ctx.cycles += 10;
+	// 19AE  E6 76
+	{ uint8_t res = ctx.A & 0x76; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 19B0  FE 34
+	{ uint8_t val = 0x34; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 19B2  C0
+	if (ctx.flag_Z == 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x19B3; ctx.cycles += 5; }
+}
+
+static void block_19B3(SiRecompiled::Context& ctx)
+{
+	// 19B3  21 1B 2E
+	ctx.setHL(0x2E1B);
+	ctx.cycles += 10;
+	// 19B6  11 F7 0B
+	ctx.setDE(0x0BF7);
+	ctx.cycles += 10;
+	// 19B9  0E 09
+	ctx.C = 0x09;
+	ctx.cycles += 7;
+	// 19BB  C3 F3 08
+	ctx.PC = 0x08F3;
+	ctx.cycles += 10;
+}
+
+static void block_19D1(SiRecompiled::Context& ctx)
+{
+	// 19D1  3E 01
+	ctx.A = 0x01;
+	ctx.cycles += 7;
+	ctx.PC = 0x19D3;
+}
+
+static void block_19D3(SiRecompiled::Context& ctx)
+{
+	// 19D3  32 E9 20
+	ctx.write(0x20E9, ctx.A);
+	ctx.cycles += 13;
+	// 19D6  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_19D7(SiRecompiled::Context& ctx)
+{
+	// 19D7  AF
+	{ uint8_t res = ctx.A ^ ctx.A; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 19D8  C3 D3 19
+	ctx.PC = 0x19D3;
+	ctx.cycles += 10;
+}
+
+static void block_19DC(SiRecompiled::Context& ctx)
+{
+	// 19DC  3A 94 20
+	ctx.A = ctx.read(0x2094);
+	ctx.cycles += 13;
+	// 19DF  A0
+	{ uint8_t res = ctx.A & ctx.B; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 19E0  32 94 20
+	ctx.write(0x2094, ctx.A);
+	ctx.cycles += 13;
+	// 19E3  D3 03
+	ctx.cycles += 10;
+	ctx.out(0x03);
+	// 19E5  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_19E6(SiRecompiled::Context& ctx)
+{
+	// 19E6  21 01 27
+	ctx.setHL(0x2701);
+	ctx.cycles += 10;
+	// 19E9  CA FA 19
+	ctx.PC = (ctx.flag_Z != 0) ? 0x19FA : 0x19EC;
+	ctx.cycles += 10;
+}
+
+static void block_19EC(SiRecompiled::Context& ctx)
+{
+	// 19EC  11 60 1C
+	ctx.setDE(0x1C60);
+	ctx.cycles += 10;
+	// 19EF  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 19F1  4F
+	ctx.C = ctx.A;
+	ctx.cycles += 5;
+	// 19F2  CD 39 14
+	ctx.push(0x19F5);
+	ctx.PC = 0x1439;
+	ctx.cycles += 17;
+}
+
+static void block_19F5(SiRecompiled::Context& ctx)
+{
+	// 19F5  79
+	ctx.A = ctx.C;
+	ctx.cycles += 5;
+	// 19F6  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 19F7  C2 EC 19
+	ctx.PC = (ctx.flag_Z == 0) ? 0x19EC : 0x19FA;
+	ctx.cycles += 10;
+}
+
+static void block_19FA(SiRecompiled::Context& ctx)
+{
+	// 19FA  06 10
+	ctx.B = 0x10;
+	ctx.cycles += 7;
+	// 19FC  CD CB 14
+	ctx.push(0x19FF);
+	ctx.PC = 0x14CB;
+	ctx.cycles += 17;
+}
+
+static void block_19FF(SiRecompiled::Context& ctx)
+{
+	// 19FF  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 1A00  FE 35
+	{ uint8_t val = 0x35; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1A02  C2 FA 19
+	ctx.PC = (ctx.flag_Z == 0) ? 0x19FA : 0x1A05;
+	ctx.cycles += 10;
+}
+
+static void block_1A05(SiRecompiled::Context& ctx)
+{
+	// 1A05  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1A32(SiRecompiled::Context& ctx)
+{
+	// 1A32  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 1A33  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 1A34  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A35  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 1A36  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1A37  C2 32 1A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1A32 : 0x1A3A;
+	ctx.cycles += 10;
+}
+
+static void block_1A3A(SiRecompiled::Context& ctx)
+{
+	// 1A3A  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1A3B(SiRecompiled::Context& ctx)
+{
+	// 1A3B  5E
+	ctx.E = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1A3C  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A3D  56
+	ctx.D = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1A3E  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A3F  7E
+	ctx.A = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1A40  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A41  4E
+	ctx.C = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1A42  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A43  46
+	ctx.B = ctx.read(ctx.getHL());
+	ctx.cycles += 7;
+	// 1A44  61
+	ctx.H = ctx.C;
+	ctx.cycles += 5;
+	// 1A45  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 1A46  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1A47(SiRecompiled::Context& ctx)
+{
+	// 1A47  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 1A48  06 03
+	ctx.B = 0x03;
+	ctx.cycles += 7;
+	ctx.PC = 0x1A4A;
+}
+
+static void block_1A4A(SiRecompiled::Context& ctx)
+{
+	// 1A4A  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 1A4B  1F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (ctx.flag_C << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 1A4C  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 1A4D  7D
+	ctx.A = ctx.L;
+	ctx.cycles += 5;
+	// 1A4E  1F
+	{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (ctx.flag_C << 7)); ctx.flag_C = carry; }
+	ctx.cycles += 4;
+	// 1A4F  6F
+	ctx.L = ctx.A;
+	ctx.cycles += 5;
+	// 1A50  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1A51  C2 4A 1A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1A4A : 0x1A54;
+	ctx.cycles += 10;
+}
+
+static void block_1A54(SiRecompiled::Context& ctx)
+{
+	// 1A54  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 1A55  E6 3F
+	{ uint8_t res = ctx.A & 0x3F; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1A57  F6 20
+	{ uint8_t res = ctx.A | 0x20; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1A59  67
+	ctx.H = ctx.A;
+	ctx.cycles += 5;
+	// 1A5A  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 1A5B  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1A5C(SiRecompiled::Context& ctx)
+{
+	// 1A5C  21 00 24
+	ctx.setHL(0x2400);
+	ctx.cycles += 10;
+	ctx.PC = 0x1A5F;
+}
+
+static void block_1A5F(SiRecompiled::Context& ctx)
+{
+	// 1A5F  36 00
+	ctx.write(ctx.getHL(), 0x00);
+	ctx.cycles += 10;
+	// 1A61  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A62  7C
+	ctx.A = ctx.H;
+	ctx.cycles += 5;
+	// 1A63  FE 40
+	{ uint8_t val = 0x40; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);
+	  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;
+	  ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1A65  C2 5F 1A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1A5F : 0x1A68;
+	ctx.cycles += 10;
+}
+
+static void block_1A68(SiRecompiled::Context& ctx)
+{
+	// 1A68  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1A69(SiRecompiled::Context& ctx)
+{
+	// 1A69  C5
+	ctx.push(ctx.getBC());
+	ctx.cycles += 11;
+	// 1A6A  E5
+	ctx.push(ctx.getHL());
+	ctx.cycles += 11;
+	ctx.PC = 0x1A6B;
+}
+
+static void block_1A6B(SiRecompiled::Context& ctx)
+{
+	// 1A6B  1A
+	ctx.A = ctx.read(ctx.getDE());
+	ctx.cycles += 7;
+	// 1A6C  B6
+	{ uint8_t res = ctx.A | ctx.read(ctx.getHL()); ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1A6D  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 1A6E  13
+	ctx.setDE((uint16_t)(ctx.getDE() + 1));
+	ctx.cycles += 5;
+	// 1A6F  23
+	ctx.setHL((uint16_t)(ctx.getHL() + 1));
+	ctx.cycles += 5;
+	// 1A70  0D
+	{ uint8_t val = ctx.C; uint8_t res = (uint8_t)(val - 1);
+	  ctx.C = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1A71  C2 6B 1A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1A6B : 0x1A74;
+	ctx.cycles += 10;
+}
+
+static void block_1A74(SiRecompiled::Context& ctx)
+{
+	// 1A74  E1
+	ctx.setHL(ctx.pop());
+	ctx.cycles += 10;
+	// 1A75  01 20 00
+	ctx.setBC(0x0020);
+	ctx.cycles += 10;
+	// 1A78  09
+	{ uint32_t sum = (uint32_t)ctx.getHL() + ctx.getBC(); ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }
+	ctx.cycles += 10;
+	// 1A79  C1
+	ctx.setBC(ctx.pop());
+	ctx.cycles += 10;
+	// 1A7A  05
+	{ uint8_t val = ctx.B; uint8_t res = (uint8_t)(val - 1);
+	  ctx.B = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1A7B  C2 69 1A
+	ctx.PC = (ctx.flag_Z == 0) ? 0x1A69 : 0x1A7E;
+	ctx.cycles += 10;
+}
+
+static void block_1A7E(SiRecompiled::Context& ctx)
+{
+	// 1A7E  C9
+	ctx.PC = ctx.pop();
+	ctx.cycles += 10;
+}
+
+static void block_1A7F(SiRecompiled::Context& ctx)
+{
+	// 1A7F  CD 2E 09
+	ctx.push(0x1A82);
+	ctx.PC = 0x092E;
+	ctx.cycles += 17;
+}
+
+static void block_1A82(SiRecompiled::Context& ctx)
+{
+	// 1A82  A7
+	{ uint8_t res = ctx.A & ctx.A; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 4;
+	// 1A83  C8
+	if (ctx.flag_Z != 0) { ctx.PC = ctx.pop(); ctx.cycles += 16; }
+	else { ctx.PC = 0x1A84; ctx.cycles += 5; }
+}
+
+static void block_1A85(SiRecompiled::Context& ctx)
+{
+	// 1A85  3D
+	{ uint8_t val = ctx.A; uint8_t res = (uint8_t)(val - 1);
+	  ctx.A = res; ctx.flag_AC = ((val & 0x0F) + 0x0F) > 0x0F; ctx.setSZP(res); }
+	ctx.cycles += 5;
+	// 1A86  77
+	ctx.write(ctx.getHL(), ctx.A);
+	ctx.cycles += 7;
+	// 1A87  CD E6 19
+	ctx.push(0x1A8A);
+	ctx.PC = 0x19E6;
+	ctx.cycles += 17;
+}
+
+static void block_1A8B(SiRecompiled::Context& ctx)
+{
+	// 1A8B  21 01 25
+	ctx.setHL(0x2501);
+	ctx.cycles += 10;
+	// 1A8E  E6 0F
+	{ uint8_t res = ctx.A & 0x0F; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }
+	ctx.cycles += 7;
+	// 1A90  C3 C5 09
+	ctx.PC = 0x09C5;
+	ctx.cycles += 10;
+}
+
+const SiRecompiled::Block SiRecompiled::blocks[] = {
+	{ 0x0000,  22,  4, block_0000 },
+	{ 0x0009,  43,  4, block_0009 },
+	{ 0x0011,  90,  8, block_0011 },
+	{ 0x0018,  41,  4, block_0018 },
+	{ 0x0020,  24,  3, block_0020 },
+	{ 0x0026,  27,  3, block_0026 },
+	{ 0x0028,  18,  3, block_0028 },
+	{ 0x002D,  13,  1, block_002D },
+	{ 0x0030,  17,  2, block_0030 },
+	{ 0x0035,   7,  1, block_0035 },
+	{ 0x0038,  30,  2, block_0038 },
+	{ 0x003E,   4,  1, block_003E },
+	{ 0x003F,  13,  1, block_003F },
+	{ 0x0042,  27,  3, block_0042 },
+	{ 0x0049,  27,  3, block_0049 },
+	{ 0x0050,  27,  3, block_0050 },
+	{ 0x0057,  17,  1, block_0057 },
+	{ 0x005A,  10,  1, block_005A },
+	{ 0x005D,  27,  3, block_005D },
+	{ 0x0064,  10,  1, block_0064 },
+	{ 0x0067,  30,  3, block_0067 },
+	{ 0x006F,  17,  1, block_006F },
+	{ 0x0072,  43,  3, block_0072 },
+	{ 0x007B,  17,  1, block_007B },
+	{ 0x007E,  17,  1, block_007E },
+	{ 0x0081,   4,  1, block_0081 },
+	{ 0x0082,  30,  3, block_0082 },
+	{ 0x0087,  10,  1, block_0087 },
+	{ 0x008C,  44,  5, block_008C },
+	{ 0x0097,  27,  3, block_0097 },
+	{ 0x009E,  27,  3, block_009E },
+	{ 0x00A5,  27,  2, block_00A5 },
+	{ 0x00AB,  17,  1, block_00AB },
+	{ 0x00AE,  10,  1, block_00AE },
+	{ 0x00B1,  17,  1, block_00B1 },
+	{ 0x00B4, 106, 12, block_00B4 },
+	{ 0x00C7,   5,  1, block_00C7 },
+	{ 0x00C8,  37,  4, block_00C8 },
+	{ 0x00D2,   5,  1, block_00D2 },
+	{ 0x00D3,  23,  2, block_00D3 },
+	{ 0x00D7,  43,  4, block_00D7 },
+	{ 0x0100,  31,  4, block_0100 },
+	{ 0x0108,  78,  9, block_0108 },
+	{ 0x0117, 111, 17, block_0117 },
+	{ 0x012E,  40,  3, block_012E },
+	{ 0x0136,  27,  3, block_0136 },
+	{ 0x013B,  35,  4, block_013B },
+	{ 0x0141,  33,  3, block_0141 },
+	{ 0x0146,  33,  3, block_0146 },
+	{ 0x014B,  38,  4, block_014B },
+	{ 0x0154,  29,  3, block_0154 },
+	{ 0x015A,  27,  4, block_015A },
+	{ 0x0160,  30,  2, block_0160 },
+	{ 0x0166,  43,  5, block_0166 },
+	{ 0x0170,  48,  5, block_0170 },
+	{ 0x017A,  41,  6, block_017A },
+	{ 0x0183,  17,  2, block_0183 },
+	{ 0x018A,  42,  7, block_018A },
+	{ 0x0194,   5,  1, block_0194 },
+	{ 0x0195,  20,  2, block_0195 },
+	{ 0x0197,  42,  7, block_0197 },
+	{ 0x01A1,  15,  2, block_01A1 },
+	{ 0x01A5,  59,  6, block_01A5 },
+	{ 0x01B1,  67,  9, block_01B1 },
+	{ 0x01C0,  10,  1, block_01C0 },
+	{ 0x01C3,   7,  1, block_01C3 },
+	{ 0x01C5,  30,  4, block_01C5 },
+	{ 0x01CC,  10,  1, block_01CC },
+	{ 0x01CD,  20,  2, block_01CD },
+	{ 0x01CF,  34,  4, block_01CF },
+	{ 0x01D9,  70, 11, block_01D9 },
+	{ 0x01E4,   7,  1, block_01E4 },
+	{ 0x01E6,  30,  3, block_01E6 },
+	{ 0x01EF,  20,  2, block_01EF },
+	{ 0x01F5,  10,  1, block_01F5 },
+	{ 0x01F8,  17,  2, block_01F8 },
+	{ 0x01FD,  35,  3, block_01FD },
+	{ 0x0203,  25,  3, block_0203 },
+	{ 0x0208,  10,  1, block_0208 },
+	{ 0x0209,  17,  2, block_0209 },
+	{ 0x020E,  17,  2, block_020E },
+	{ 0x0213,   4,  1, block_0213 },
+	{ 0x0214,  20,  2, block_0214 },
+	{ 0x021A,   4,  1, block_021A },
+	{ 0x021B,  10,  1, block_021B },
+	{ 0x021E,  40,  4, block_021E },
+	{ 0x022A,  38,  4, block_022A },
+	{ 0x0232,  17,  1, block_0232 },
+	{ 0x0235,  10,  1, block_0235 },
+	{ 0x0237,  21,  2, block_0237 },
+	{ 0x0239,  51,  5, block_0239 },
+	{ 0x0242,  17,  1, block_0242 },
+	{ 0x0245,  10,  1, block_0245 },
+	{ 0x0248,  10,  1, block_0248 },
+	{ 0x024B,  30,  3, block_024B },
+	{ 0x024F,  17,  2, block_024F },
+	{ 0x0254,  36,  6, block_0254 },
+	{ 0x025C,  26,  4, block_025C },
+	{ 0x0262,  95, 11, block_0262 },
+	{ 0x0277,  20,  3, block_0277 },
+	{ 0x027C,   5,  1, block_027C },
+	{ 0x027D,  24,  4, block_027D },
+	{ 0x0281,  30,  3, block_0281 },
+	{ 0x0288,  30,  4, block_0288 },
+	{ 0x02ED,  13,  1, block_02ED },
+	{ 0x02F1,  14,  2, block_02F1 },
+	{ 0x02F5,  17,  1, block_02F5 },
+	{ 0x02F8,  17,  1, block_02F8 },
+	{ 0x02FB,  57,  8, block_02FB },
+	{ 0x0306,  28,  4, block_0306 },
+	{ 0x030E,  14,  2, block_030E },
+	{ 0x0312,  30,  2, block_0312 },
+	{ 0x0318,  67,  7, block_0318 },
+	{ 0x0326,  17,  1, block_0326 },
+	{ 0x0329,  10,  1, block_0329 },
+	{ 0x0332,  17,  1, block_0332 },
+	{ 0x0335,  10,  1, block_0335 },
+	{ 0x0707,  17,  2, block_0707 },
+	{ 0x0765,  30,  3, block_0765 },
+	{ 0x076E,  17,  1, block_076E },
+	{ 0x0771,  17,  1, block_0771 },
+	{ 0x0774,  44,  4, block_0774 },
+	{ 0x077F,  45,  5, block_077F },
+	{ 0x078B,  27,  2, block_078B },
+	{ 0x0791,  27,  3, block_0791 },
+	{ 0x0798,  11,  2, block_0798 },
+	{ 0x079B,  30,  3, block_079B },
+	{ 0x07A3,  30,  2, block_07A3 },
+	{ 0x07A9,  59,  4, block_07A9 },
+	{ 0x07B5,  17,  1, block_07B5 },
+	{ 0x07B8,  17,  1, block_07B8 },
+	{ 0x07BB,  77,  6, block_07BB },
+	{ 0x07CB,  17,  1, block_07CB },
+	{ 0x07CE,  17,  1, block_07CE },
+	{ 0x07D1,  17,  1, block_07D1 },
+	{ 0x07D4,  43,  3, block_07D4 },
+	{ 0x07DD,  47,  4, block_07DD },
+	{ 0x07E7,  17,  1, block_07E7 },
+	{ 0x07EA,  59,  4, block_07EA },
+	{ 0x07F6,  17,  1, block_07F6 },
+	{ 0x07F9,  17,  1, block_07F9 },
+	{ 0x07FC,  17,  1, block_07FC },
+	{ 0x07FF,  21,  3, block_07FF },
+	{ 0x0804,  17,  1, block_0804 },
+	{ 0x0807,  27,  3, block_0807 },
+	{ 0x080E,  17,  1, block_080E },
+	{ 0x0811,  17,  1, block_0811 },
+	{ 0x0814,  17,  1, block_0814 },
+	{ 0x0817,  17,  1, block_0817 },
+	{ 0x081A,  24,  2, block_081A },
+	{ 0x081F,  17,  1, block_081F },
+	{ 0x0822,  17,  1, block_0822 },
+	{ 0x0825,  17,  1, block_0825 },
+	{ 0x0828,  17,  1, block_0828 },
+	{ 0x082B,  27,  3, block_082B },
+	{ 0x0832,  17,  1, block_0832 },
+	{ 0x0835,  17,  1, block_0835 },
+	{ 0x0838,  17,  1, block_0838 },
+	{ 0x083B,  17,  1, block_083B },
+	{ 0x083E,  17,  1, block_083E },
+	{ 0x0841,  10,  1, block_0841 },
+	{ 0x0844,  24,  2, block_0844 },
+	{ 0x0849,  17,  1, block_0849 },
+	{ 0x084C,  27,  2, block_084C },
+	{ 0x0851,  10,  1, block_0851 },
+	{ 0x0857,  27,  2, block_0857 },
+	{ 0x085D,  35,  5, block_085D },
+	{ 0x0866,  14,  2, block_0866 },
+	{ 0x086A,  10,  1, block_086A },
+	{ 0x086D,  17,  2, block_086D },
+	{ 0x0872,  17,  1, block_0872 },
+	{ 0x0875,  10,  1, block_0875 },
+	{ 0x0878,  49,  5, block_0878 },
+	{ 0x0886,  35,  4, block_0886 },
+	{ 0x088D,  44,  4, block_088D },
+	{ 0x0898,  51,  5, block_0898 },
+	{ 0x08A4,  20,  2, block_08A4 },
+	{ 0x08A9,  33,  3, block_08A9 },
+	{ 0x08AE,  17,  2, block_08AE },
+	{ 0x08B3,  17,  1, block_08B3 },
+	{ 0x08B6,  17,  1, block_08B6 },
+	{ 0x08B9,  10,  1, block_08B9 },
+	{ 0x08BC,  44,  5, block_08BC },
+	{ 0x08C8,  10,  1, block_08C8 },
+	{ 0x08CB,  17,  1, block_08CB },
+	{ 0x08CE,  10,  1, block_08CE },
+	{ 0x08D1,  34,  4, block_08D1 },
+	{ 0x08D8,  31,  3, block_08D8 },
+	{ 0x08DE,  30,  3, block_08DE },
+	{ 0x08E4,  33,  3, block_08E4 },
+	{ 0x08E9,  27,  3, block_08E9 },
+	{ 0x08F3,  35,  3, block_08F3 },
+	{ 0x08F8,  30,  4, block_08F8 },
+	{ 0x08FE,  10,  1, block_08FE },
+	{ 0x08FF, 115, 13, block_08FF },
+	{ 0x0913,  31,  3, block_0913 },
+	{ 0x0919,  35,  4, block_0919 },
+	{ 0x0921,  30,  3, block_0921 },
+	{ 0x0929,  31,  3, block_0929 },
+	{ 0x092E,  17,  1, block_092E },
+	{ 0x0931,  24,  3, block_0931 },
+	{ 0x0935,  17,  1, block_0935 },
+	{ 0x0938,  37,  5, block_0938 },
+	{ 0x093D,  34,  4, block_093D },
+	{ 0x0946,   7,  1, block_0946 },
+	{ 0x0948,  17,  1, block_0948 },
+	{ 0x094B,  27,  4, block_094B },
+	{ 0x094F,  17,  1, block_094F },
+	{ 0x0952,  17,  2, block_0952 },
+	{ 0x0955,  10,  1, block_0955 },
+	{ 0x0958,  25,  4, block_0958 },
+	{ 0x095E,  34,  3, block_095E },
+	{ 0x0967,  22,  2, block_0967 },
+	{ 0x096B,  17,  1, block_096B },
+	{ 0x096E,  57,  7, block_096E },
+	{ 0x097C,  28,  3, block_097C },
+	{ 0x0982,  23,  3, block_0982 },
+	{ 0x0986,  15,  2, block_0986 },
+	{ 0x0988,  17,  1, block_0988 },
+	{ 0x098B,  33,  3, block_098B },
+	{ 0x0990,  70,  8, block_0990 },
+	{ 0x099D,  28,  5, block_099D },
+	{ 0x09A3,  51,  8, block_09A3 },
+	{ 0x09AD,  22,  2, block_09AD },
+	{ 0x09B1,   5,  1, block_09B1 },
+	{ 0x09B2,  11,  1, block_09B2 },
+	{ 0x09B4,  40,  6, block_09B4 },
+	{ 0x09BE,  24,  2, block_09BE },
+	{ 0x09C3,  20,  2, block_09C3 },
+	{ 0x09C5,  17,  2, block_09C5 },
+	{ 0x09CA,  38,  4, block_09CA },
+	{ 0x09D2,  20,  2, block_09D2 },
+	{ 0x09D6,  10,  1, block_09D6 },
+	{ 0x09D9,  44,  6, block_09D9 },
+	{ 0x09E4,  20,  2, block_09E4 },
+	{ 0x09E8,  22,  3, block_09E8 },
+	{ 0x09EE,  10,  1, block_09EE },
+	{ 0x09EF,  17,  1, block_09EF },
+	{ 0x09F2,  34,  3, block_09F2 },
+	{ 0x09F9,  13,  1, block_09F9 },
+	{ 0x09FD,  17,  1, block_09FD },
+	{ 0x0A01,  85, 10, block_0A01 },
+	{ 0x0A13,  20,  3, block_0A13 },
+	{ 0x0A18,  65,  9, block_0A18 },
+	{ 0x0A25,  37,  3, block_0A25 },
+	{ 0x0A2D,  17,  1, block_0A2D },
+	{ 0x0A30,  10,  1, block_0A30 },
+	{ 0x0A33,  17,  1, block_0A33 },
+	{ 0x0A36,  17,  1, block_0A36 },
+	{ 0x0A39,  10,  1, block_0A39 },
+	{ 0x0A3C,  17,  1, block_0A3C },
+	{ 0x0A3F,  10,  1, block_0A3F },
+	{ 0x0A42,  20,  2, block_0A42 },
+	{ 0x0A47,  33,  3, block_0A47 },
+	{ 0x0A4C,  17,  1, block_0A4C },
+	{ 0x0A4F,  10,  1, block_0A4F },
+	{ 0x0A52,  17,  1, block_0A52 },
+	{ 0x0A55,  10,  1, block_0A55 },
+	{ 0x0A58,  10,  1, block_0A58 },
+	{ 0x0A59,  30,  3, block_0A59 },
+	{ 0x0A5F,  27,  3, block_0A5F },
+	{ 0x0A66,  29,  3, block_0A66 },
+	{ 0x0A6C,  27,  3, block_0A6C },
+	{ 0x0A71,  54,  7, block_0A71 },
+	{ 0x0A7C,  20,  2, block_0A7C },
+	{ 0x0A80,  20,  2, block_0A80 },
+	{ 0x0A85,  37,  4, block_0A85 },
+	{ 0x0A8E,  27,  3, block_0A8E },
+	{ 0x0A93,  35,  3, block_0A93 },
+	{ 0x0A98,  30,  3, block_0A98 },
+	{ 0x0A9E,  28,  3, block_0A9E },
+	{ 0x0AA5,  20,  3, block_0AA5 },
+	{ 0x0AAA,  10,  1, block_0AAA },
+	{ 0x0AAB,  20,  2, block_0AAB },
+	{ 0x0AB1,  17,  2, block_0AB1 },
+	{ 0x0AB6,  17,  2, block_0AB6 },
+	{ 0x0ABB,  20,  2, block_0ABB },
+	{ 0x0ABF,  27,  3, block_0ABF },
+	{ 0x0AC6,  14,  2, block_0AC6 },
+	{ 0x0ACA,  14,  2, block_0ACA },
+	{ 0x0ACE,  10,  1, block_0ACE },
+	{ 0x0ACF,  27,  3, block_0ACF },
+	{ 0x0AD7,  13,  1, block_0AD7 },
+	{ 0x0ADA,  27,  3, block_0ADA },
+	{ 0x0AE1,  10,  1, block_0AE1 },
+	{ 0x0AE2,  27,  3, block_0AE2 },
+	{ 0x0AEA,  41,  4, block_0AEA },
+	{ 0x0AF3,  17,  1, block_0AF3 },
+	{ 0x0AF6,  44,  5, block_0AF6 },
+	{ 0x0B02,  27,  2, block_0B02 },
+	{ 0x0B08,  10,  1, block_0B08 },
+	{ 0x0B0B,  17,  1, block_0B0B },
+	{ 0x0B0E,  17,  1, block_0B0E },
+	{ 0x0B11,  17,  1, block_0B11 },
+	{ 0x0B14,  17,  1, block_0B14 },
+	{ 0x0B17,  27,  3, block_0B17 },
+	{ 0x0B1E,  27,  2, block_0B1E },
+	{ 0x0B24,  17,  1, block_0B24 },
+	{ 0x0B27,  27,  2, block_0B27 },
+	{ 0x0B2D,  17,  1, block_0B2D },
+	{ 0x0B30,  17,  1, block_0B30 },
+	{ 0x0B33,  27,  2, block_0B33 },
+	{ 0x0B39,  17,  1, block_0B39 },
+	{ 0x0B3C,  17,  1, block_0B3C },
+	{ 0x0B3F,  34,  3, block_0B3F },
+	{ 0x0B47,  17,  1, block_0B47 },
+	{ 0x0B4A,  17,  1, block_0B4A },
+	{ 0x0B4D,  27,  3, block_0B4D },
+	{ 0x0B54,  17,  1, block_0B54 },
+	{ 0x0B57,  30,  2, block_0B57 },
+	{ 0x0B5D,  17,  1, block_0B5D },
+	{ 0x0B60,  17,  1, block_0B60 },
+	{ 0x0B63,  17,  1, block_0B63 },
+	{ 0x0B66,  17,  1, block_0B66 },
+	{ 0x0B69,  37,  3, block_0B69 },
+	{ 0x0B71,  17,  1, block_0B71 },
+	{ 0x0B74,  17,  1, block_0B74 },
+	{ 0x0B77,  27,  2, block_0B77 },
+	{ 0x0B7C,  10,  1, block_0B7C },
+	{ 0x0B7F,  17,  2, block_0B7F },
+	{ 0x0B83,  17,  1, block_0B83 },
+	{ 0x0B86,  10,  1, block_0B86 },
+	{ 0x0B89,  34,  3, block_0B89 },
+	{ 0x0B90,  17,  1, block_0B90 },
+	{ 0x0B93,  44,  4, block_0B93 },
+	{ 0x0B9E,  30,  3, block_0B9E },
+	{ 0x0BA6,  34,  3, block_0BA6 },
+	{ 0x0BAE,  27,  2, block_0BAE },
+	{ 0x0BB4,  17,  1, block_0BB4 },
+	{ 0x0BB7,  24,  3, block_0BB7 },
+	{ 0x0BBD,  27,  2, block_0BBD },
+	{ 0x0BC3,  17,  1, block_0BC3 },
+	{ 0x0BC6,  30,  3, block_0BC6 },
+	{ 0x0BCE,  27,  2, block_0BCE },
+	{ 0x0BD4,  17,  1, block_0BD4 },
+	{ 0x0BD7,  17,  1, block_0BD7 },
+	{ 0x0BDA,  53,  6, block_0BDA },
+	{ 0x0BE5,  10,  1, block_0BE5 },
+	{ 0x0BE8,  27,  2, block_0BE8 },
+	{ 0x0BEE,  10,  1, block_0BEE },
+	{ 0x0BF1,  17,  1, block_0BF1 },
+	{ 0x0BF4,  10,  1, block_0BF4 },
+	{ 0x1424,  17,  1, block_1424 },
+	{ 0x1427, 105, 13, block_1427 },
+	{ 0x1438,  10,  1, block_1438 },
+	{ 0x1439,  75,  9, block_1439 },
+	{ 0x1446,  10,  1, block_1446 },
+	{ 0x1474,  32,  4, block_1474 },
+	{ 0x147C,  22,  2, block_147C },
+	{ 0x147E,  39,  6, block_147E },
+	{ 0x1486,  55,  6, block_1486 },
+	{ 0x1490,  10,  1, block_1490 },
+	{ 0x14CB,   4,  1, block_14CB },
+	{ 0x14CC,  63,  7, block_14CC },
+	{ 0x14D7,  10,  1, block_14D7 },
+	{ 0x14D8,  36,  3, block_14D8 },
+	{ 0x14DE,  23,  2, block_14DE },
+	{ 0x14E1,  35,  4, block_14E1 },
+	{ 0x14EA,  33,  3, block_14EA },
+	{ 0x14EF,  22,  3, block_14EF },
+	{ 0x14F5,  42,  5, block_14F5 },
+	{ 0x1500,  14,  2, block_1500 },
+	{ 0x1504,  22,  2, block_1504 },
+	{ 0x1508,  35,  3, block_1508 },
+	{ 0x150F,  53,  4, block_150F },
+	{ 0x151A,  21,  3, block_151A },
+	{ 0x151F,  27,  2, block_151F },
+	{ 0x1524,  17,  1, block_1524 },
+	{ 0x1527,  17,  1, block_1527 },
+	{ 0x152A,  30,  3, block_152A },
+	{ 0x1530,  30,  3, block_1530 },
+	{ 0x1538,  36,  3, block_1538 },
+	{ 0x153D,  40,  3, block_153D },
+	{ 0x1545,  20,  2, block_1545 },
+	{ 0x154A,  34,  4, block_154A },
+	{ 0x1554,  28,  3, block_1554 },
+	{ 0x155A,  15,  2, block_155A },
+	{ 0x155C,  22,  3, block_155C },
+	{ 0x1562,  35,  3, block_1562 },
+	{ 0x1569,  10,  2, block_1569 },
+	{ 0x156D,  15,  2, block_156D },
+	{ 0x156F,  30,  2, block_156F },
+	{ 0x1577,  15,  2, block_1577 },
+	{ 0x1579,  30,  3, block_1579 },
+	{ 0x1581,  71, 13, block_1581 },
+	{ 0x1590,  22,  3, block_1590 },
+	{ 0x1596,  10,  1, block_1596 },
+	{ 0x1597,  27,  3, block_1597 },
+	{ 0x159E,  27,  2, block_159E },
+	{ 0x15A4,  11,  1, block_15A4 },
+	{ 0x15A5,  14,  2, block_15A5 },
+	{ 0x15A9,  67,  6, block_15A9 },
+	{ 0x15B7,  27,  2, block_15B7 },
+	{ 0x15BD,  11,  1, block_15BD },
+	{ 0x15BE,  17,  1, block_15BE },
+	{ 0x15C1,  14,  2, block_15C1 },
+	{ 0x15C5,   7,  1, block_15C5 },
+	{ 0x15C7,  21,  3, block_15C7 },
+	{ 0x15CC,  20,  3, block_15CC },
+	{ 0x15D1,  10,  1, block_15D1 },
+	{ 0x15D3,  17,  1, block_15D3 },
+	{ 0x15D6,  11,  1, block_15D6 },
+	{ 0x15D7, 152, 18, block_15D7 },
+	{ 0x15F1,  20,  2, block_15F1 },
+	{ 0x15F3,  17,  1, block_15F3 },
+	{ 0x15F6,  10,  1, block_15F6 },
+	{ 0x15F9,  21,  3, block_15F9 },
+	{ 0x15FE,   5,  1, block_15FE },
+	{ 0x15FF,  20,  3, block_15FF },
+	{ 0x1604,  41,  4, block_1604 },
+	{ 0x160B,  30,  3, block_160B },
+	{ 0x1611,  35,  4, block_1611 },
+	{ 0x1618,  36,  3, block_1618 },
+	{ 0x161E,  49,  6, block_161E },
+	{ 0x1626,  33,  3, block_1626 },
+	{ 0x162B,  27,  3, block_162B },
+	{ 0x1632,  27,  3, block_1632 },
+	{ 0x1639,  17,  1, block_1639 },
+	{ 0x163C,  23,  2, block_163C },
+	{ 0x163F,  43,  4, block_163F },
+	{ 0x1648,  17,  1, block_1648 },
+	{ 0x164B,  23,  2, block_164B },
+	{ 0x164E,  23,  2, block_164E },
+	{ 0x1652,  63,  7, block_1652 },
+	{ 0x1661,   7,  1, block_1661 },
+	{ 0x1663,  46,  4, block_1663 },
+	{ 0x166B,  14,  2, block_166B },
+	{ 0x1671,  17,  1, block_1671 },
+	{ 0x1674,  27,  2, block_1674 },
+	{ 0x1679,  56,  8, block_1679 },
+	{ 0x1685,  10,  1, block_1685 },
+	{ 0x1688,  10,  1, block_1688 },
+	{ 0x168B,  17,  2, block_168B },
+	{ 0x168F,  55,  7, block_168F },
+	{ 0x1698,  27,  3, block_1698 },
+	{ 0x169F,  44,  4, block_169F },
+	{ 0x16AA,  44,  6, block_16AA },
+	{ 0x16B5,   7,  1, block_16B5 },
+	{ 0x16B7,  22,  2, block_16B7 },
+	{ 0x16BB,  17,  1, block_16BB },
+	{ 0x16BE,  17,  1, block_16BE },
+	{ 0x16C1,  21,  3, block_16C1 },
+	{ 0x16C6,  10,  1, block_16C6 },
+	{ 0x16C9,  44,  4, block_16C9 },
+	{ 0x16D4,  17,  1, block_16D4 },
+	{ 0x16D7,  17,  1, block_16D7 },
+	{ 0x16DA,  44,  4, block_16DA },
+	{ 0x16E3,  10,  1, block_16E3 },
+	{ 0x16E6,  10,  1, block_16E6 },
+	{ 0x16EA,  17,  2, block_16EA },
+	{ 0x16EE,  17,  1, block_16EE },
+	{ 0x16F1,  24,  2, block_16F1 },
+	{ 0x16F6,  17,  1, block_16F6 },
+	{ 0x16F9,  10,  1, block_16F9 },
+	{ 0x16FC,  17,  1, block_16FC },
+	{ 0x16FF,  27,  2, block_16FF },
+	{ 0x1705,  21,  2, block_1705 },
+	{ 0x1709,  17,  2, block_1709 },
+	{ 0x170E,  17,  1, block_170E },
+	{ 0x1711,  44,  6, block_1711 },
+	{ 0x171C,  21,  3, block_171C },
+	{ 0x1721,  25,  4, block_1721 },
+	{ 0x1727,  30,  3, block_1727 },
+	{ 0x172C,  30,  3, block_172C },
+	{ 0x1734,  17,  2, block_1734 },
+	{ 0x1739,  17,  2, block_1739 },
+	{ 0x1740,  37,  3, block_1740 },
+	{ 0x1747,  27,  3, block_1747 },
+	{ 0x174E,  36,  3, block_174E },
+	{ 0x1753,  54,  6, block_1753 },
+	{ 0x1760,  69,  9, block_1760 },
+	{ 0x176D,  40,  4, block_176D },
+	{ 0x1775,  27,  3, block_1775 },
+	{ 0x177C,  33,  3, block_177C },
+	{ 0x1785,  17,  2, block_1785 },
+	{ 0x1789,  20,  3, block_1789 },
+	{ 0x178E,  84, 11, block_178E },
+	{ 0x17A2,   7,  1, block_17A2 },
+	{ 0x17A4,  28,  4, block_17A4 },
+	{ 0x17AA,  36,  3, block_17AA },
+	{ 0x17AF,  17,  2, block_17AF },
+	{ 0x17C0,  27,  3, block_17C0 },
+	{ 0x17C7,  20,  2, block_17C7 },
+	{ 0x17CA,  20,  2, block_17CA },
+	{ 0x17CD,  33,  3, block_17CD },
+	{ 0x17D2,  33,  3, block_17D2 },
+	{ 0x17D7,  17,  2, block_17D7 },
+	{ 0x17DC,  17,  1, block_17DC },
+	{ 0x17DF,  15,  2, block_17DF },
+	{ 0x17E3,  37,  3, block_17E3 },
+	{ 0x17EC,  44,  4, block_17EC },
+	{ 0x17F7,  17,  1, block_17F7 },
+	{ 0x17FA,  40,  4, block_17FA },
+	{ 0x1804,  31,  4, block_1804 },
+	{ 0x180C,  32,  4, block_180C },
+	{ 0x1810,  17,  2, block_1810 },
+	{ 0x1815,  44,  4, block_1815 },
+	{ 0x1820,  30,  3, block_1820 },
+	{ 0x1828,  17,  1, block_1828 },
+	{ 0x182B,  10,  1, block_182B },
+	{ 0x182E,  17,  1, block_182E },
+	{ 0x1831,  10,  1, block_1831 },
+	{ 0x1837,  10,  1, block_1837 },
+	{ 0x183A,  17,  1, block_183A },
+	{ 0x183D,  11,  1, block_183D },
+	{ 0x183E,  17,  1, block_183E },
+	{ 0x1841,  10,  1, block_1841 },
+	{ 0x1844,  35,  3, block_1844 },
+	{ 0x184A,  20,  2, block_184A },
+	{ 0x184C,  46,  4, block_184C },
+	{ 0x1854,  20,  2, block_1854 },
+	{ 0x1856,  34,  4, block_1856 },
+	{ 0x185B,  75, 13, block_185B },
+	{ 0x1868,  49,  5, block_1868 },
+	{ 0x1871,  32,  4, block_1871 },
+	{ 0x1879,  46,  4, block_1879 },
+	{ 0x1884,  20,  2, block_1884 },
+	{ 0x1888,  43,  3, block_1888 },
+	{ 0x1891,  15,  2, block_1891 },
+	{ 0x1898,  30,  3, block_1898 },
+	{ 0x189E,  44,  4, block_189E },
+	{ 0x18A9,  60,  6, block_18A9 },
+	{ 0x18B8,  30,  3, block_18B8 },
+	{ 0x18C0,  30,  3, block_18C0 },
+	{ 0x18C8,  38,  4, block_18C8 },
+	{ 0x18D1,  10,  1, block_18D1 },
+	{ 0x18D4,  34,  3, block_18D4 },
+	{ 0x18DC,  17,  1, block_18DC },
+	{ 0x18DF,  30,  3, block_18DF },
+	{ 0x18E7,  38,  4, block_18E7 },
+	{ 0x18EF,  15,  2, block_18EF },
+	{ 0x18F1,  41,  4, block_18F1 },
+	{ 0x18F8,  15,  2, block_18F8 },
+	{ 0x18FA,  50,  5, block_18FA },
+	{ 0x1904,  20,  2, block_1904 },
+	{ 0x190A,  17,  1, block_190A },
+	{ 0x190D,  10,  1, block_190D },
+	{ 0x1910,  38,  4, block_1910 },
+	{ 0x1918,  15,  2, block_1918 },
+	{ 0x191A,  37,  4, block_191A },
+	{ 0x1925,  20,  2, block_1925 },
+	{ 0x192B,  20,  2, block_192B },
+	{ 0x1931,  58,  9, block_1931 },
+	{ 0x193C,  37,  4, block_193C },
+	{ 0x1947,  33,  3, block_1947 },
+	{ 0x1950,  20,  2, block_1950 },
+	{ 0x1956,  17,  1, block_1956 },
+	{ 0x1959,  17,  1, block_1959 },
+	{ 0x195C,  17,  1, block_195C },
+	{ 0x195F,  17,  1, block_195F },
+	{ 0x1962,  17,  1, block_1962 },
+	{ 0x1965,  17,  1, block_1965 },
+	{ 0x1968,  10,  1, block_1968 },
+	{ 0x196B,  17,  1, block_196B },
+	{ 0x196E,  10,  1, block_196E },
+	{ 0x1971,  30,  3, block_1971 },
+	{ 0x1979,  17,  1, block_1979 },
+	{ 0x197C,  17,  1, block_197C },
+	{ 0x197F,  10,  1, block_197F },
+	{ 0x1982,  23,  2, block_1982 },
+	{ 0x1988,  10,  1, block_1988 },
+	{ 0x199A,  27,  3, block_199A },
+	{ 0x19A1,  40,  4, block_19A1 },
+	{ 0x19A8,  18,  2, block_19A8 },
+	{ 0x19AC,  40,  4, block_19AC },
+	{ 0x19B3,  37,  4, block_19B3 },
+	{ 0x19D1,   7,  1, block_19D1 },
+	{ 0x19D3,  23,  2, block_19D3 },
+	{ 0x19D7,  14,  2, block_19D7 },
+	{ 0x19DC,  50,  5, block_19DC },
+	{ 0x19E6,  20,  2, block_19E6 },
+	{ 0x19EC,  39,  4, block_19EC },
+	{ 0x19F5,  20,  3, block_19F5 },
+	{ 0x19FA,  24,  2, block_19FA },
+	{ 0x19FF,  22,  3, block_19FF },
+	{ 0x1A05,  10,  1, block_1A05 },
+	{ 0x1A32,  39,  6, block_1A32 },
+	{ 0x1A3A,  10,  1, block_1A3A },
+	{ 0x1A3B,  75, 12, block_1A3B },
+	{ 0x1A47,  18,  2, block_1A47 },
+	{ 0x1A4A,  43,  8, block_1A4A },
+	{ 0x1A54,  44,  6, block_1A54 },
+	{ 0x1A5C,  10,  1, block_1A5C },
+	{ 0x1A5F,  37,  5, block_1A5F },
+	{ 0x1A68,  10,  1, block_1A68 },
+	{ 0x1A69,  22,  2, block_1A69 },
+	{ 0x1A6B,  46,  7, block_1A6B },
+	{ 0x1A74,  55,  6, block_1A74 },
+	{ 0x1A7E,  10,  1, block_1A7E },
+	{ 0x1A7F,  17,  1, block_1A7F },
+	{ 0x1A82,  20,  2, block_1A82 },
+	{ 0x1A85,  29,  3, block_1A85 },
+	{ 0x1A8B,  27,  3, block_1A8B },
+};
+
+const size_t SiRecompiled::num_blocks = 593;
+const uint64_t SiRecompiled::rom_hash = 0xA02B653391170906ull;
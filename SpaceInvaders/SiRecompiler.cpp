@@ -0,0 +1,575 @@
+/**
+ * [FILE] SiRecompiler.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the ahead of time recompiler
+ * [DATE] 2021-06-13
+*/
+
+#include "SiRecompiler.h"
+#include "SiMachine.h"
+#include "SiRecompiled.h"
+#include "../i8080/i8080_OpSpec.h"
+#include <cstdio>
+
+const char* const SiRecompiler::REG_NAMES[8] = { "B", "C", "D", "E", "H", "L", "M", "A" };
+
+/**
+ * [DESCRIPTION] Load the ROM set, recompile it and write the blocks to the
+ *               path passed with --recompile
+ *
+ * [PARAM] options
+ * [RETURN] int (0 on success)
+*/
+int SiRecompiler::run(const EmulatorOptions& options)
+{
+	SiMachine machine;
+	if (!machine.loadRomFiles()) {
+		return 1;
+	}
+	std::vector<uint8_t> image(SiRecompiled::ROM_SIZE);
+	for (uint32_t address = 0; address < SiRecompiled::ROM_SIZE; address++) {
+		image[address] = machine.cpu->memory->get((uint16_t)address);
+	}
+
+	SiRecompiler recompiler(image);
+	if (!recompiler.write(options.recompile_path, SiRecompiled::romHash(machine.cpu->memory))) {
+		return 1;
+	}
+	printf("%d blocks, %d opcodes recompiled, %d left to the interpreter -> %s\n",
+		recompiler.num_blocks, recompiler.num_native, recompiler.num_interpreted, options.recompile_path);
+	return 0;
+}
+
+/**
+ * [DESCRIPTION] Return a byte of the ROM
+ *
+ * [PARAM] address
+ * [RETURN] uint8_t (0 past the end of the ROM)
+*/
+uint8_t SiRecompiler::getByte(uint32_t address)
+{
+	return address < rom.size() ? rom[address] : 0;
+}
+
+/**
+ * [DESCRIPTION] Check if an opcode is generated as C++, the rest end the block
+ *               and run on the interpreter
+ *
+ * [PARAM] op
+ * [RETURN] bool
+*/
+bool SiRecompiler::isNative(uint8_t op)
+{
+	switch (op) {
+	case 0x27:                                  // DAA
+	case 0x76:                                  // HLT
+	case 0xF1: case 0xF5:                       // POP/PUSH PSW
+	case 0xDE:                                  // SBI
+	case 0xFB:                                  // EI (the board schedules the latched interrupt)
+		return false;
+	default:
+		break;
+	}
+	if ((op & 0xF8) == 0x98 || (op & 0xC7) == 0xC7) {
+		return false;                           // SBB, RST
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Find the code by following every path from the reset and RST
+ *               vectors and mark where the blocks have to start
+ *
+*/
+void SiRecompiler::analyze()
+{
+	uint32_t size = (uint32_t)rom.size();
+	std::vector<uint32_t> work;
+	for (uint32_t vector = 0x00; vector <= 0x38; vector += 0x08) {
+		work.push_back(vector);
+		is_leader[vector] = 1;
+	}
+
+	// every target found is walked until the path ends or joins known code
+	while (!work.empty()) {
+		uint32_t address = work.back();
+		work.pop_back();
+		while (address < size && !is_code[address]) {
+			uint8_t op = rom[address];
+			uint32_t next = address + i8080_OpSpec::getLength(op);
+			uint16_t target = (uint16_t)((getByte(address + 2) << 8) | getByte(address + 1));
+			is_code[address] = 1;
+
+			bool jumps = op == 0xC3 || op == 0xCB || (op & 0xC7) == 0xC2 ||
+				(op & 0xCF) == 0xCD || (op & 0xC7) == 0xC4;
+			if (jumps && target < size) {
+				is_leader[target] = 1;
+				work.push_back(target);
+			}
+			if (op == 0xC3 || op == 0xCB || op == 0xC9 || op == 0xD9 || op == 0xE9) {
+				break;                          // JMP RET PCHL, no way to fall through
+			}
+
+			// the interpreter (or a return) comes back to the next opcode
+			bool returns_here = (op & 0xC7) == 0xC2 || (op & 0xCF) == 0xCD || (op & 0xC7) == 0xC4 ||
+				(op & 0xC7) == 0xC0 || !isNative(op);
+			if (returns_here && next < size) {
+				is_leader[next] = 1;
+			}
+			if (op == 0x76) {
+				break;
+			}
+			address = next;
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Append the C++ of one opcode to a block, the statements follow
+ *               the interpreter flag for flag
+ *
+ * [PARAM] code
+ * [PARAM] pc
+ * [PARAM] cycles - set to the most cycles the opcode can take
+ * [RETURN] true if the opcode sets PC (the block ends after it)
+*/
+bool SiRecompiler::emitOpcode(std::string& code, uint16_t pc, int& cycles)
+{
+	uint8_t op = rom[pc];
+	uint8_t lo = getByte(pc + 1);
+	uint8_t hi = getByte(pc + 2);
+	uint16_t adr = (uint16_t)((hi << 8) | lo);
+	int dst = (op >> 3) & 0x07;
+	int src = op & 0x07;
+	int pair = (op >> 4) & 0x03;
+	static const char* const PAIR_NAMES[3] = { "BC", "DE", "HL" };
+	static const char* const CONDITIONS[8] = {
+		"ctx.flag_Z == 0", "ctx.flag_Z != 0", "ctx.flag_C == 0", "ctx.flag_C != 0",
+		"ctx.flag_P == 0", "ctx.flag_P != 0", "ctx.flag_S == 0", "ctx.flag_S != 0"
+	};
+
+	char line[512];
+	int length = i8080_OpSpec::getLength(op);
+	if (length == 1) {
+		snprintf(line, sizeof(line), "\t// %04X  %02X\n", pc, op);
+	}
+	else if (length == 2) {
+		snprintf(line, sizeof(line), "\t// %04X  %02X %02X\n", pc, op, lo);
+	}
+	else {
+		snprintf(line, sizeof(line), "\t// %04X  %02X %02X %02X\n", pc, op, lo, hi);
+	}
+	code += line;
+
+	// operand of an accumulator operation or MOV source
+	std::string operand;
+	if ((op & 0xC7) == 0xC6 || (op & 0xC7) == 0x06) {
+		snprintf(line, sizeof(line), "0x%02X", lo);
+		operand = line;
+	}
+	else if (src == 6) {
+		operand = "ctx.read(ctx.getHL())";
+	}
+	else {
+		operand = std::string("ctx.") + REG_NAMES[src];
+	}
+
+	// MOV =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	if (op >= 0x40 && op < 0x80) {
+		if (dst == 6) {
+			snprintf(line, sizeof(line), "\tctx.write(ctx.getHL(), ctx.%s);\n", REG_NAMES[src]);
+		}
+		else {
+			snprintf(line, sizeof(line), "\tctx.%s = %s;\n", REG_NAMES[dst], operand.c_str());
+		}
+		code += line;
+		cycles = (src == 6 || dst == 6) ? 7 : 5;
+		code += cycles == 7 ? "\tctx.cycles += 7;\n" : "\tctx.cycles += 5;\n";
+		return false;
+	}
+
+	// ACCUMULATOR OPERATIONS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	if ((op >= 0x80 && op < 0xC0) || (op & 0xC7) == 0xC6) {
+		// ADD A/ADC A take AC/CY from the result, the same as the interpreter
+		const char* carry_src = (op < 0xC0 && src == 7) ? "res" : "val";
+		switch (dst) {
+		case 0:
+		case 1:
+			snprintf(line, sizeof(line),
+				"\t{ uint8_t val = %s; uint8_t a = %s; uint8_t res = (uint8_t)(a + val);\n"
+				"\t  ctx.flag_AC = ((a & 0x0F) + (%s & 0x0F)) > 0x0F; ctx.flag_C = (a + %s) > 0xFF;\n"
+				"\t  ctx.A = res; ctx.setSZP(res); }\n",
+				operand.c_str(), dst == 1 ? "(uint8_t)(ctx.A + ctx.flag_C)" : "ctx.A", carry_src, carry_src);
+			break;
+		case 2:
+		case 7:
+			// flags are taken from adding the two's complement, CY is negated
+			snprintf(line, sizeof(line),
+				"\t{ uint8_t val = %s; uint8_t a = ctx.A; uint8_t twos = (uint8_t)(0 - val); uint8_t res = (uint8_t)(a - val);\n"
+				"\t  ctx.flag_AC = ((a & 0x0F) + (twos & 0x0F)) > 0x0F; ctx.flag_C = (a + twos) <= 0xFF;\n"
+				"\t  %sctx.setSZP(res); }\n",
+				operand.c_str(), dst == 2 ? "ctx.A = res; " : "");
+			break;
+		case 4:
+			snprintf(line, sizeof(line), "\t{ uint8_t res = ctx.A & %s; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }\n",
+				operand.c_str());
+			break;
+		case 5:
+			snprintf(line, sizeof(line), "\t{ uint8_t res = ctx.A ^ %s; ctx.flag_AC = 0; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }\n",
+				operand.c_str());
+			break;
+		default:
+			snprintf(line, sizeof(line), "\t{ uint8_t res = ctx.A | %s; ctx.flag_C = 0; ctx.A = res; ctx.setSZP(res); }\n",
+				operand.c_str());
+			break;
+		}
+		code += line;
+		cycles = (op >= 0xC0 || src == 6) ? 7 : 4;
+		code += cycles == 7 ? "\tctx.cycles += 7;\n" : "\tctx.cycles += 4;\n";
+		return false;
+	}
+
+	// INR/DCR/MVI =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	if ((op & 0xC6) == 0x04) {
+		// DCR checks AC by adding 0xFF
+		bool decrement = (op & 0x01) != 0;
+		std::string target = dst == 6 ? "ctx.read(ctx.getHL())" : std::string("ctx.") + REG_NAMES[dst];
+		snprintf(line, sizeof(line),
+			"\t{ uint8_t val = %s; uint8_t res = (uint8_t)(val %s 1);\n"
+			"\t  %s ctx.flag_AC = ((val & 0x0F) + %s) > 0x0F; ctx.setSZP(res); }\n",
+			target.c_str(), decrement ? "-" : "+",
+			dst == 6 ? "ctx.write(ctx.getHL(), res);" : (std::string("ctx.") + REG_NAMES[dst] + " = res;").c_str(),
+			decrement ? "0x0F" : "1");
+		code += line;
+		cycles = dst == 6 ? 10 : 5;
+		code += cycles == 10 ? "\tctx.cycles += 10;\n" : "\tctx.cycles += 5;\n";
+		return false;
+	}
+	if ((op & 0xC7) == 0x06) {
+		if (dst == 6) {
+			snprintf(line, sizeof(line), "\tctx.write(ctx.getHL(), 0x%02X);\n\tctx.cycles += 10;\n", lo);
+			cycles = 10;
+		}
+		else {
+			snprintf(line, sizeof(line), "\tctx.%s = 0x%02X;\n\tctx.cycles += 7;\n", REG_NAMES[dst], lo);
+			cycles = 7;
+		}
+		code += line;
+		return false;
+	}
+
+	// REGISTER PAIRS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	if ((op & 0xCF) == 0x01) {                  // LXI
+		if (pair == 3) {
+			snprintf(line, sizeof(line), "\tctx.SP = 0x%04X;\n\tctx.cycles += 10;\n", adr);
+		}
+		else {
+			snprintf(line, sizeof(line), "\tctx.set%s(0x%04X);\n\tctx.cycles += 10;\n", PAIR_NAMES[pair], adr);
+		}
+		code += line;
+		cycles = 10;
+		return false;
+	}
+	if ((op & 0xC7) == 0x03) {                  // INX/DCX
+		const char* sign = (op & 0x08) ? "-" : "+";
+		if (pair == 3) {
+			snprintf(line, sizeof(line), "\tctx.SP = (uint16_t)(ctx.SP %s 1);\n\tctx.cycles += 5;\n", sign);
+		}
+		else {
+			snprintf(line, sizeof(line), "\tctx.set%s((uint16_t)(ctx.get%s() %s 1));\n\tctx.cycles += 5;\n",
+				PAIR_NAMES[pair], PAIR_NAMES[pair], sign);
+		}
+		code += line;
+		cycles = 5;
+		return false;
+	}
+	if ((op & 0xCF) == 0x09) {                  // DAD
+		snprintf(line, sizeof(line),
+			"\t{ uint32_t sum = (uint32_t)ctx.getHL() + %s; ctx.setHL((uint16_t)sum); ctx.flag_C = sum > 0xFFFF; }\n"
+			"\tctx.cycles += 10;\n",
+			pair == 3 ? "ctx.SP" : (std::string("ctx.get") + PAIR_NAMES[pair] + "()").c_str());
+		code += line;
+		cycles = 10;
+		return false;
+	}
+	if ((op & 0xCB) == 0xC1) {                  // POP/PUSH (PSW is never native)
+		if (op & 0x04) {
+			snprintf(line, sizeof(line), "\tctx.push(ctx.get%s());\n\tctx.cycles += 11;\n", PAIR_NAMES[pair]);
+			cycles = 11;
+		}
+		else {
+			snprintf(line, sizeof(line), "\tctx.set%s(ctx.pop());\n\tctx.cycles += 10;\n", PAIR_NAMES[pair]);
+			cycles = 10;
+		}
+		code += line;
+		return false;
+	}
+
+	// JUMP/CALL/RETURN =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	if (op == 0xC3 || op == 0xCB) {             // JMP
+		snprintf(line, sizeof(line), "\tctx.PC = 0x%04X;\n\tctx.cycles += 10;\n", adr);
+		code += line;
+		cycles = 10;
+		return true;
+	}
+	if ((op & 0xC7) == 0xC2) {                  // Jcc
+		snprintf(line, sizeof(line), "\tctx.PC = (%s) ? 0x%04X : 0x%04X;\n\tctx.cycles += 10;\n",
+			CONDITIONS[dst], adr, (uint16_t)(pc + 3));
+		code += line;
+		cycles = 10;
+		return true;
+	}
+	if ((op & 0xCF) == 0xCD) {                  // CALL
+		snprintf(line, sizeof(line), "\tctx.push(0x%04X);\n\tctx.PC = 0x%04X;\n\tctx.cycles += 17;\n",
+			(uint16_t)(pc + 3), adr);
+		code += line;
+		cycles = 17;
+		return true;
+	}
+	if ((op & 0xC7) == 0xC4) {                  // Ccc
+		snprintf(line, sizeof(line),
+			"\tif (%s) { ctx.push(0x%04X); ctx.PC = 0x%04X; ctx.cycles += 17; }\n"
+			"\telse { ctx.PC = 0x%04X; ctx.cycles += 11; }\n",
+			CONDITIONS[dst], (uint16_t)(pc + 3), adr, (uint16_t)(pc + 3));
+		code += line;
+		cycles = 17;
+		return true;
+	}
+	if (op == 0xC9 || op == 0xD9) {             // RET
+		code += "\tctx.PC = ctx.pop();\n\tctx.cycles += 10;\n";
+		cycles = 10;
+		return true;
+	}
+	if ((op & 0xC7) == 0xC0) {                  // Rcc
+		// RC/RNC/RM take 11 cycles when taken, the others add the 5 on top
+		static const int TAKEN_CYCLES[8] = { 16, 16, 11, 11, 16, 16, 16, 11 };
+		snprintf(line, sizeof(line),
+			"\tif (%s) { ctx.PC = ctx.pop(); ctx.cycles += %d; }\n"
+			"\telse { ctx.PC = 0x%04X; ctx.cycles += 5; }\n",
+			CONDITIONS[dst], TAKEN_CYCLES[dst], (uint16_t)(pc + 1));
+		code += line;
+		cycles = TAKEN_CYCLES[dst];
+		return true;
+	}
+
+	// EVERYTHING ELSE =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+	cycles = 4;
+	switch (op) {
+	case 0x00: case 0x08: case 0x10: case 0x18:     // NOP
+	case 0x20: case 0x28: case 0x30: case 0x38:
+		code += "\tctx.cycles += 4;\n";
+		return false;
+	case 0x07:                                      // RLC
+		code += "\t{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | carry); ctx.flag_C = carry; }\n"
+			"\tctx.cycles += 4;\n";
+		return false;
+	case 0x0F:                                      // RRC
+		code += "\t{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (carry << 7)); ctx.flag_C = carry; }\n"
+			"\tctx.cycles += 4;\n";
+		return false;
+	case 0x17:                                      // RAL
+		code += "\t{ uint8_t carry = ctx.A >> 7; ctx.A = (uint8_t)((ctx.A << 1) | ctx.flag_C); ctx.flag_C = carry; }\n"
+			"\tctx.cycles += 4;\n";
+		return false;
+	case 0x1F:                                      // RAR
+		code += "\t{ uint8_t carry = ctx.A & 0x01; ctx.A = (uint8_t)((ctx.A >> 1) | (ctx.flag_C << 7)); ctx.flag_C = carry; }\n"
+			"\tctx.cycles += 4;\n";
+		return false;
+	case 0x2F:                                      // CMA
+		code += "\tctx.A = (uint8_t)~ctx.A;\n\tctx.cycles += 4;\n";
+		return false;
+	case 0x37:                                      // STC
+		code += "\tctx.flag_C = 1;\n\tctx.cycles += 4;\n";
+		return false;
+	case 0x3F:                                      // CMC
+		code += "\tctx.flag_C ^= 1;\n\tctx.cycles += 4;\n";
+		return false;
+	case 0x02: case 0x12:                           // STAX
+		snprintf(line, sizeof(line), "\tctx.write(ctx.get%s(), ctx.A);\n\tctx.cycles += 7;\n", PAIR_NAMES[pair]);
+		code += line;
+		cycles = 7;
+		return false;
+	case 0x0A: case 0x1A:                           // LDAX
+		snprintf(line, sizeof(line), "\tctx.A = ctx.read(ctx.get%s());\n\tctx.cycles += 7;\n", PAIR_NAMES[pair]);
+		code += line;
+		cycles = 7;
+		return false;
+	case 0x22:                                      // SHLD
+		snprintf(line, sizeof(line), "\tctx.write(0x%04X, ctx.L);\n\tctx.write(0x%04X, ctx.H);\n\tctx.cycles += 16;\n",
+			adr, (uint16_t)(adr + 1));
+		code += line;
+		cycles = 16;
+		return false;
+	case 0x2A:                                      // LHLD
+		snprintf(line, sizeof(line), "\tctx.L = ctx.read(0x%04X);\n\tctx.H = ctx.read(0x%04X);\n\tctx.cycles += 16;\n",
+			adr, (uint16_t)(adr + 1));
+		code += line;
+		cycles = 16;
+		return false;
+	case 0x32:                                      // STA
+		snprintf(line, sizeof(line), "\tctx.write(0x%04X, ctx.A);\n\tctx.cycles += 13;\n", adr);
+		code += line;
+		cycles = 13;
+		return false;
+	case 0x3A:                                      // LDA
+		snprintf(line, sizeof(line), "\tctx.A = ctx.read(0x%04X);\n\tctx.cycles += 13;\n", adr);
+		code += line;
+		cycles = 13;
+		return false;
+	case 0xEB:                                      // XCHG
+		code += "\t{ uint16_t hl = ctx.getHL(); ctx.setHL(ctx.getDE()); ctx.setDE(hl); }\n\tctx.cycles += 5;\n";
+		cycles = 5;
+		return false;
+	case 0xE3:                                      // XTHL
+		code += "\t{ uint8_t l = ctx.read(ctx.SP); uint8_t h = ctx.read((uint16_t)(ctx.SP + 1));\n"
+			"\t  ctx.write(ctx.SP, ctx.L); ctx.write((uint16_t)(ctx.SP + 1), ctx.H); ctx.H = h; ctx.L = l; }\n"
+			"\tctx.cycles += 18;\n";
+		cycles = 18;
+		return false;
+	case 0xF9:                                      // SPHL
+		code += "\tctx.SP = ctx.getHL();\n\tctx.cycles += 5;\n";
+		cycles = 5;
+		return false;
+	case 0xE9:                                      // PCHL
+		code += "\tctx.PC = ctx.getHL();\n\tctx.cycles += 5;\n";
+		cycles = 5;
+		return true;
+	case 0xD3:                                      // OUT
+		snprintf(line, sizeof(line), "\tctx.cycles += 10;\n\tctx.out(0x%02X);\n", lo);
+		code += line;
+		cycles = 10;
+		return false;
+	case 0xDB:                                      // IN
+		snprintf(line, sizeof(line), "\tctx.in(0x%02X);\n\tctx.cycles += 10;\n", lo);
+		code += line;
+		cycles = 10;
+		return false;
+	case 0xF3:                                      // DI
+		code += "\tctx.disableInterrupts();\n\tctx.cycles += 4;\n";
+		return false;
+	default:
+		return false;
+	}
+}
+
+/**
+ * [DESCRIPTION] Generate the function body of the block starting at a leader
+ *
+ * [PARAM] leader
+ * [PARAM] max_cycles - set to the most cycles the block can take
+ * [PARAM] num_opcodes - set to the opcodes in the block (every run runs them all)
+ * [RETURN] std::string (empty if the first opcode is left to the interpreter)
+*/
+std::string SiRecompiler::emitBlock(uint16_t leader, int& max_cycles, int& num_opcodes)
+{
+	std::string code;
+	uint32_t pc = leader;
+	int count = 0;
+	max_cycles = 0;
+	while (true) {
+		uint8_t op = rom[pc];
+		if (!isNative(op) || pc + i8080_OpSpec::getLength(op) > rom.size()) {
+			if (count == 0) {
+				return "";
+			}
+			break;
+		}
+		int cycles = 0;
+		bool ends = emitOpcode(code, (uint16_t)pc, cycles);
+		max_cycles += cycles;
+		count++;
+		pc += i8080_OpSpec::getLength(op);
+		if (ends) {
+			num_native += count;
+			num_opcodes = count;
+			return code;
+		}
+		if (pc >= rom.size() || is_leader[pc]) {
+			break;
+		}
+	}
+
+	char line[64];
+	snprintf(line, sizeof(line), "\tctx.PC = 0x%04X;\n", pc);
+	code += line;
+	num_native += count;
+	num_opcodes = count;
+	return code;
+}
+
+/**
+ * [DESCRIPTION] Run the analysis and write the generated blocks to a file
+ *
+ * [PARAM] path
+ * [PARAM] rom_hash - SiRecompiled::romHash of the ROM
+ * [RETURN] false if the file could not be written
+*/
+bool SiRecompiler::write(const char* path, uint64_t rom_hash)
+{
+	analyze();
+
+	#pragma warning(disable:4996)
+	FILE* file = fopen(path, "w");
+	if (file == NULL) {
+		printf("Error writing %s\n", path);
+		return false;
+	}
+
+	fprintf(file, "/**\n");
+	fprintf(file, " * [FILE] SiRecompiledBlocks.cpp\n");
+	fprintf(file, " * [AUTHOR] Madison Woy\n");
+	fprintf(file, " * [DESCRIPTION] GENERATED by SiRecompiler from the Space Invaders ROM, do not edit,\n");
+	fprintf(file, " *               rebuild it with: Emulator_8080 --recompile SpaceInvaders/SiRecompiledBlocks.cpp\n");
+	fprintf(file, " * [DATE] 2021-06-13\n");
+	fprintf(file, "*/\n\n");
+	fprintf(file, "#include \"SiRecompiled.h\"\n\n");
+
+	std::vector<uint16_t> addresses;
+	std::vector<int> block_cycles;
+	std::vector<int> block_opcodes;
+	for (uint32_t address = 0; address < rom.size(); address++) {
+		if (!is_code[address]) {
+			continue;
+		}
+		int max_cycles = 0;
+		int num_opcodes = 0;
+		std::string body = is_leader[address] ? emitBlock((uint16_t)address, max_cycles, num_opcodes) : "";
+		if (body.empty()) {
+			// found by the analysis but never the start of a block
+			if (!isNative(rom[address])) {
+				num_interpreted++;
+			}
+			continue;
+		}
+		fprintf(file, "static void block_%04X(SiRecompiled::Context& ctx)\n{\n%s}\n\n", address, body.c_str());
+		addresses.push_back((uint16_t)address);
+		block_cycles.push_back(max_cycles);
+		block_opcodes.push_back(num_opcodes);
+	}
+
+	fprintf(file, "const SiRecompiled::Block SiRecompiled::blocks[] = {\n");
+	for (size_t i = 0; i < addresses.size(); i++) {
+		fprintf(file, "\t{ 0x%04X, %3d, %2d, block_%04X },\n", addresses[i], block_cycles[i], block_opcodes[i], addresses[i]);
+	}
+	fprintf(file, "};\n\n");
+	fprintf(file, "const size_t SiRecompiled::num_blocks = %zu;\n", addresses.size());
+	fprintf(file, "const uint64_t SiRecompiled::rom_hash = 0x%016llXull;\n", (unsigned long long)rom_hash);
+	fclose(file);
+
+	num_blocks = (int)addresses.size();
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Construct a new SiRecompiler object
+ *
+ * [PARAM] p_rom - the ROM image starting at address 0
+*/
+SiRecompiler::SiRecompiler(const std::vector<uint8_t>& p_rom) : rom(p_rom)
+{
+	is_code.assign(rom.size(), 0);
+	is_leader.assign(rom.size(), 0);
+	num_blocks = 0;
+	num_native = 0;
+	num_interpreted = 0;
+}
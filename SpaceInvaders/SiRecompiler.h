@@ -0,0 +1,47 @@
+/**
+ * [FILE] SiRecompiler.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the ahead of time recompiler that turns the Space Invaders
+ *               ROM into the C++ blocks of SiRecompiledBlocks.cpp
+ * [DATE] 2021-06-13
+*/
+
+#pragma once
+#include "../Emulator/EmulatorOptions.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class which recompiles a ROM image into C++ in three stages
+ *      - Analysis: the code is followed from the reset and RST vectors through
+ *        every jump/call/return path (recursive descent), PCHL targets and data
+ *        are never reached
+ *      - Leaders: every entry, branch target, return address and opcode after
+ *        one the interpreter has to run starts a basic block
+ *      - Generation: one function per block, the opcodes become straight C++
+ *        on a SiRecompiled::Context and the block ends by setting PC
+ *      - Opcodes whose flag behavior is not worth copying (SBB/SBI/DAA/PSW),
+ *        RST and HLT end the block before them and are left to the interpreter
+*/
+class SiRecompiler {
+private:
+    static const char* const REG_NAMES[8];      // B C D E H L M A
+
+    std::vector<uint8_t>    rom;
+    std::vector<uint8_t>    is_code;            // 1 where an opcode found by the analysis starts
+    std::vector<uint8_t>    is_leader;          // 1 where a block has to start
+    int                     num_blocks;
+    int                     num_native;         // opcodes inside blocks
+    int                     num_interpreted;    // opcodes found but left to the interpreter
+
+    uint8_t     getByte(uint32_t address);      // 0 past the end of the ROM
+    static bool isNative(uint8_t op);
+    void        analyze();
+    bool        emitOpcode(std::string& code, uint16_t pc, int& cycles);
+    std::string emitBlock(uint16_t leader, int& max_cycles, int& num_opcodes);
+public:
+    static int  run(const EmulatorOptions& options);    // --recompile, returns the exit code
+    bool        write(const char* path, uint64_t rom_hash);  // generate the C++ file
+    SiRecompiler(const std::vector<uint8_t>& p_rom);
+};
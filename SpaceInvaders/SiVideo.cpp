@@ -0,0 +1,635 @@
+/**
+ * [FILE] SiVideo.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the implementation of the gameplay recorder and reader
+ * [DATE] 2021-06-19
+*/
+
+#include "SiVideo.h"
+#include <chrono>
+#include <cstring>
+
+static const int HEADER_BYTES = 40;     // up to the first record
+static const int RECORD_BYTES = 8 + 8 + 1 + 1 + SiVideo::MAX_SOUNDS * 10 + 2 + SiVideo::MAX_PAYLOAD;  // largest record
+
+/**
+ * [DESCRIPTION] Store a value as little endian bytes and move past it
+ *
+ * [PARAM] out
+ * [PARAM] val
+ * [PARAM] num_bytes
+*/
+static void putLE(uint8_t*& out, uint64_t val, int num_bytes)
+{
+	for (int i = 0; i < num_bytes; i++) {
+		*out++ = (uint8_t)(val >> (8 * i));
+	}
+}
+
+/**
+ * [DESCRIPTION] Read a little endian value from the file
+ *
+ * [PARAM] f
+ * [PARAM] val - set to the value read
+ * [PARAM] num_bytes
+ * [RETURN] false if the file ended early
+*/
+static bool readLE(FILE* f, uint64_t& val, int num_bytes)
+{
+	uint8_t bytes[8];
+	if (fread(bytes, 1, num_bytes, f) != (size_t)num_bytes) {
+		return false;
+	}
+	val = 0;
+	for (int i = 0; i < num_bytes; i++) {
+		val |= (uint64_t)bytes[i] << (8 * i);
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Move to a byte offset of the file (recordings may pass 2 GB)
+ *
+ * [PARAM] f
+ * [PARAM] offset
+ * [RETURN] false if the seek failed
+*/
+static bool seekFile(FILE* f, uint64_t offset)
+{
+#ifdef _WIN32
+	return _fseeki64(f, (long long)offset, SEEK_SET) == 0;
+#else
+	return fseeko(f, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+/**
+ * [DESCRIPTION] Return the byte offset the file is at
+ *
+ * [PARAM] f
+ * [RETURN] uint64_t
+*/
+static uint64_t tellFile(FILE* f)
+{
+#ifdef _WIN32
+	return (uint64_t)_ftelli64(f);
+#else
+	return (uint64_t)ftello(f);
+#endif
+}
+
+// FORMAT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Pack the bytes that changed since the previous frame, unchanged
+ *               bytes at the end are left out
+ *
+ * [PARAM] frame
+ * [PARAM] previous - NULL for a keyframe
+ * [PARAM] payload - MAX_PAYLOAD bytes
+ * [RETURN] size_t (payload bytes used)
+*/
+size_t SiVideo::encode(const uint8_t* frame, const uint8_t* previous, uint8_t* payload)
+{
+	uint8_t delta[FRAME_BYTES];
+	for (int i = 0; i < FRAME_BYTES; i++) {
+		delta[i] = previous != NULL ? frame[i] ^ previous[i] : frame[i];
+	}
+
+	size_t size = 0;
+	int i = 0;
+	while (i < FRAME_BYTES) {
+		int run = 0;
+		while (i + run < FRAME_BYTES && run < 128 && delta[i + run] == 0) {
+			run++;
+		}
+		if (i + run == FRAME_BYTES) {
+			break;
+		}
+		if (run > 0) {
+			payload[size++] = (uint8_t)(run - 1);
+			i += run;
+			continue;
+		}
+
+		// changed bytes up to the next two unchanged ones (a single unchanged
+		// byte costs as much copied as skipped)
+		int count = 0;
+		while (i + count < FRAME_BYTES && count < 128 &&
+			(delta[i + count] != 0 || (i + count + 1 < FRAME_BYTES && delta[i + count + 1] != 0))) {
+			count++;
+		}
+		payload[size++] = (uint8_t)(0x80 | (count - 1));
+		memcpy(&payload[size], &delta[i], count);
+		size += count;
+		i += count;
+	}
+	return size;
+}
+
+/**
+ * [DESCRIPTION] Apply a payload to the frame before it (a blank frame for a
+ *               keyframe)
+ *
+ * [PARAM] payload
+ * [PARAM] size
+ * [PARAM] frame - FRAME_BYTES, updated in place
+ * [RETURN] false if the payload runs past the frame
+*/
+bool SiVideo::decode(const uint8_t* payload, size_t size, uint8_t* frame)
+{
+	size_t pos = 0;
+	int out = 0;
+	while (pos < size) {
+		uint8_t code = payload[pos++];
+		int count = (code & 0x7F) + 1;
+		if (out + count > FRAME_BYTES || ((code & 0x80) && pos + count > size)) {
+			return false;
+		}
+		if (code & 0x80) {
+			for (int i = 0; i < count; i++) {
+				frame[out + i] ^= payload[pos + i];
+			}
+			pos += count;
+		}
+		out += count;
+	}
+	return true;
+}
+
+// RECORDER =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Create the recording and start the encoder thread
+ *
+ * [PARAM] p_path
+ * [RETURN] false if the file could not be created
+*/
+bool SiVideo::Recorder::open(const char* p_path)
+{
+#pragma warning(disable:4996)
+	file = fopen(p_path, "wb");
+	if (file == NULL) {
+		printf("ERROR OPENING %s\n", p_path);
+		return false;
+	}
+	setvbuf(file, NULL, _IOFBF, 1 << 16);
+	path = p_path;
+	writeHeader(0);
+	offset = HEADER_BYTES;
+	ring.reset(new SpscRing<Frame, RING_FRAMES>());
+	closing = false;
+	encoder = std::thread(&Recorder::encodeLoop, this);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Hand the frame just run to the encoder: its VRAM and the sound
+ *               port writes the board captured during it
+ *
+ * [PARAM] machine
+ * [PARAM] wait - wait for room instead of dropping the frame (runs that are
+ *                not in real time)
+ * [RETURN] false if the frame was dropped
+*/
+bool SiVideo::Recorder::addFrame(SiMachine& machine, bool wait)
+{
+	if (file == NULL) {
+		return false;
+	}
+	Frame frame;
+	frame.number = next_number++;
+	frame.cycle = machine.cpu->clock->getCurrentCCs();
+	memcpy(frame.vram, machine.getVRAM(), FRAME_BYTES);
+	// a frame never writes the sound ports anywhere near MAX_SOUNDS times
+	frame.num_sounds = machine.sound_writes.size() < MAX_SOUNDS ? (int)machine.sound_writes.size() : MAX_SOUNDS;
+	for (int i = 0; i < frame.num_sounds; i++) {
+		frame.sounds[i] = machine.sound_writes[i];
+	}
+
+	while (!ring->push(frame)) {
+		if (!wait) {
+			dropped++;
+			return false;
+		}
+		std::this_thread::yield();
+	}
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Let the encoder write what is queued, then write the index and
+ *               the final header
+ *
+*/
+void SiVideo::Recorder::close()
+{
+	if (file == NULL) {
+		return;
+	}
+	closing.store(true, std::memory_order_release);
+	encoder.join();
+
+	uint8_t bytes[8];
+	uint8_t* out = bytes;
+	putLE(out, index.size(), 8);
+	fwrite(bytes, 1, 8, file);
+	for (uint64_t record : index) {
+		out = bytes;
+		putLE(out, record, 8);
+		fwrite(bytes, 1, 8, file);
+	}
+	writeHeader(offset);
+	fclose(file);
+	file = NULL;
+
+	printf("video: %llu frames in %.1f KB (%.1f bytes per frame), %llu dropped, written to %s\n",
+		(unsigned long long)frames_written, offset / 1024.0,
+		frames_written > 0 ? (double)offset / frames_written : 0.0, (unsigned long long)dropped, path);
+}
+
+/**
+ * [DESCRIPTION] Encoder thread, writes frames as they come in until the
+ *               recording is closed and the ring is empty
+ *
+*/
+void SiVideo::Recorder::encodeLoop()
+{
+	std::unique_ptr<Frame> frame(new Frame);
+	while (true) {
+		if (ring->pop(*frame)) {
+			writeFrame(*frame);
+			continue;
+		}
+		// every frame pushed before closing was set is in the ring by now
+		if (closing.load(std::memory_order_acquire)) {
+			while (ring->pop(*frame)) {
+				writeFrame(*frame);
+			}
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+}
+
+/**
+ * [DESCRIPTION] Compress a frame and append its record, the first frame at or
+ *               after each KEYFRAME_INTERVAL boundary is a keyframe
+ *
+ * [PARAM] frame
+*/
+void SiVideo::Recorder::writeFrame(const Frame& frame)
+{
+	bool key = frame.number >= index.size() * KEYFRAME_INTERVAL;
+	while (frame.number >= index.size() * KEYFRAME_INTERVAL) {
+		index.push_back(offset);
+	}
+
+	uint8_t record[RECORD_BYTES];
+	uint8_t* out = record;
+	putLE(out, frame.number, 8);
+	putLE(out, frame.cycle, 8);
+	putLE(out, key ? FLAG_KEYFRAME : 0, 1);
+	putLE(out, frame.num_sounds, 1);
+	for (int i = 0; i < frame.num_sounds; i++) {
+		putLE(out, frame.sounds[i].cycle, 8);
+		putLE(out, frame.sounds[i].port, 1);
+		putLE(out, frame.sounds[i].value, 1);
+	}
+	size_t payload_size = encode(frame.vram, key ? NULL : previous, out + 2);
+	putLE(out, payload_size, 2);
+	out += payload_size;
+	memcpy(previous, frame.vram, FRAME_BYTES);
+
+	size_t size = out - record;
+	fwrite(record, 1, size, file);
+	offset += size;
+	frames_written++;
+}
+
+/**
+ * [DESCRIPTION] Write the header at the start of the file, the file position is
+ *               put back afterwards
+ *
+ * [PARAM] index_offset - 0 until the recording is closed
+*/
+void SiVideo::Recorder::writeHeader(uint64_t index_offset)
+{
+	uint8_t header[HEADER_BYTES];
+	uint8_t* out = header;
+	memcpy(out, "SIVD", 4);
+	out += 4;
+	putLE(out, VERSION, 4);
+	putLE(out, SiBoards::INVADERS.screen_width, 2);
+	putLE(out, SiBoards::INVADERS.screen_height, 2);
+	putLE(out, KEYFRAME_INTERVAL, 4);
+	putLE(out, frames_written, 8);
+	putLE(out, dropped, 8);
+	putLE(out, index_offset, 8);
+
+	uint64_t position = tellFile(file);
+	seekFile(file, 0);
+	fwrite(header, 1, HEADER_BYTES, file);
+	seekFile(file, position > HEADER_BYTES ? position : HEADER_BYTES);
+}
+
+/**
+ * [DESCRIPTION] Construct a new Recorder object (not recording until opened)
+ *
+*/
+SiVideo::Recorder::Recorder()
+{
+	closing = false;
+	file = NULL;
+	path = NULL;
+	next_number = 0;
+	dropped = 0;
+	memset(previous, 0, sizeof(previous));
+	offset = 0;
+	frames_written = 0;
+}
+
+/**
+ * [DESCRIPTION] Destroy the Recorder object, finishing the file
+ *
+*/
+SiVideo::Recorder::~Recorder()
+{
+	close();
+}
+
+// READER =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Open a recording and load its keyframe index, the index of a
+ *               recording that was never closed is rebuilt from its records
+ *
+ * [PARAM] path
+ * [RETURN] false if the file is not a recording this build can read
+*/
+bool SiVideo::Reader::open(const char* path)
+{
+#pragma warning(disable:4996)
+	file = fopen(path, "rb");
+	if (file == NULL) {
+		printf("ERROR OPENING %s\n", path);
+		return false;
+	}
+
+	char magic[4];
+	uint64_t version = 0, width = 0, height = 0, interval = 0, index_offset = 0, count = 0;
+	bool read_ok = fread(magic, 1, 4, file) == 4 && memcmp(magic, "SIVD", 4) == 0;
+	read_ok = read_ok && readLE(file, version, 4) && version == VERSION;
+	read_ok = read_ok && readLE(file, width, 2) && readLE(file, height, 2) &&
+		width * height / 8 == (uint64_t)FRAME_BYTES;
+	read_ok = read_ok && readLE(file, interval, 4) && interval > 0;
+	read_ok = read_ok && readLE(file, frame_count, 8) && readLE(file, dropped, 8) && readLE(file, index_offset, 8);
+	keyframe_interval = interval > 0 ? (uint32_t)interval : (uint32_t)KEYFRAME_INTERVAL;
+
+	if (read_ok && index_offset == 0) {
+		read_ok = rebuildIndex(HEADER_BYTES);
+	}
+	else if (read_ok) {
+		read_ok = seekFile(file, index_offset) && readLE(file, count, 8);
+		for (uint64_t i = 0; read_ok && i < count; i++) {
+			uint64_t record;
+			read_ok = readLE(file, record, 8);
+			index.push_back(record);
+		}
+	}
+	if (!read_ok) {
+		printf("ERROR READING VIDEO %s\n", path);
+		index.clear();
+	}
+	// next() starts at the first frame
+	return read_ok && seekFile(file, HEADER_BYTES);
+}
+
+/**
+ * [DESCRIPTION] Go to the keyframe at or before the passed frame number and
+ *               decode up to it
+ *
+ * [PARAM] number
+ * [RETURN] false if the recording ends before it
+*/
+bool SiVideo::Reader::seek(uint64_t number)
+{
+	if (index.empty()) {
+		return false;
+	}
+	uint64_t entry = number / keyframe_interval;
+	if (entry >= index.size()) {
+		entry = index.size() - 1;
+	}
+	has_pending = false;
+	if (!seekFile(file, index[entry])) {
+		return false;
+	}
+	while (next(pending)) {
+		if (pending.number >= number) {
+			has_pending = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * [DESCRIPTION] Read and decode the next frame
+ *
+ * [PARAM] frame - vram holds the whole picture
+ * [RETURN] false at the end of the file (or a record cut short)
+*/
+bool SiVideo::Reader::next(Frame& frame)
+{
+	if (has_pending) {
+		frame = pending;
+		has_pending = false;
+		return true;
+	}
+	uint8_t flags;
+	uint8_t payload[MAX_PAYLOAD];
+	size_t payload_size;
+	if (!readRecord(frame, flags, payload, payload_size)) {
+		return false;
+	}
+	if (flags & FLAG_KEYFRAME) {
+		memset(picture, 0, sizeof(picture));
+	}
+	if (!decode(payload, payload_size, picture)) {
+		return false;
+	}
+	memcpy(frame.vram, picture, FRAME_BYTES);
+	return true;
+}
+
+/**
+ * [DESCRIPTION] Return the number of frames in the recording
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiVideo::Reader::getFrameCount()
+{
+	return frame_count;
+}
+
+/**
+ * [DESCRIPTION] Return the number of frames the recorder had to drop
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t SiVideo::Reader::getDropped()
+{
+	return dropped;
+}
+
+/**
+ * [DESCRIPTION] Read the record at the file position without decoding it
+ *
+ * [PARAM] frame - number, cycle and sounds are filled in
+ * [PARAM] flags
+ * [PARAM] payload - MAX_PAYLOAD bytes
+ * [PARAM] payload_size
+ * [RETURN] false if the file ended
+*/
+bool SiVideo::Reader::readRecord(Frame& frame, uint8_t& flags, uint8_t* payload, size_t& payload_size)
+{
+	uint64_t val = 0, num_sounds = 0, size = 0;
+	bool read_ok = readLE(file, frame.number, 8) && readLE(file, frame.cycle, 8);
+	read_ok = read_ok && readLE(file, val, 1) && readLE(file, num_sounds, 1) && num_sounds <= MAX_SOUNDS;
+	flags = (uint8_t)val;
+	frame.num_sounds = (int)num_sounds;
+	for (int i = 0; read_ok && i < frame.num_sounds; i++) {
+		uint64_t cycle = 0, port = 0, value = 0;
+		read_ok = readLE(file, cycle, 8) && readLE(file, port, 1) && readLE(file, value, 1);
+		frame.sounds[i] = { cycle, (uint8_t)port, (uint8_t)value };
+	}
+	read_ok = read_ok && readLE(file, size, 2) && size <= MAX_PAYLOAD;
+	read_ok = read_ok && fread(payload, 1, (size_t)size, file) == size;
+	payload_size = (size_t)size;
+	return read_ok;
+}
+
+/**
+ * [DESCRIPTION] Walk every record of a recording that was cut off (the
+ *               emulator was killed) to find its keyframes
+ *
+ * [PARAM] data_offset - first record
+ * [RETURN] false if it holds no keyframe
+*/
+bool SiVideo::Reader::rebuildIndex(uint64_t data_offset)
+{
+	std::unique_ptr<Frame> frame(new Frame);
+	uint8_t payload[MAX_PAYLOAD];
+	uint8_t flags;
+	size_t payload_size;
+
+	frame_count = 0;
+	seekFile(file, data_offset);
+	uint64_t record = data_offset;
+	while (readRecord(*frame, flags, payload, payload_size)) {
+		if (flags & FLAG_KEYFRAME) {
+			while (frame->number >= index.size() * keyframe_interval) {
+				index.push_back(record);
+			}
+		}
+		frame_count++;
+		record = tellFile(file);
+	}
+	clearerr(file);
+	return !index.empty();
+}
+
+/**
+ * [DESCRIPTION] Construct a new Reader object
+ *
+*/
+SiVideo::Reader::Reader()
+{
+	file = NULL;
+	keyframe_interval = (uint32_t)KEYFRAME_INTERVAL;
+	frame_count = 0;
+	dropped = 0;
+	memset(picture, 0, sizeof(picture));
+	has_pending = false;
+}
+
+/**
+ * [DESCRIPTION] Destroy the Reader object
+ *
+*/
+SiVideo::Reader::~Reader()
+{
+	if (file != NULL) {
+		fclose(file);
+	}
+}
+
+// EXPORT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+/**
+ * [DESCRIPTION] Convert a recording from --export-start on to a YUV4MPEG2 (.y4m)
+ *               grayscale video most players and encoders read directly
+ *      - The picture is rotated upright like the game window shows it
+ *      - A frame the recorder dropped shows the picture before it, so the
+ *        video keeps the game's 60 frames per second
+ *
+ * [PARAM] options
+ * [RETURN] int (0 on success)
+*/
+int SiVideo::exportVideo(const EmulatorOptions& options)
+{
+	Reader reader;
+	if (!reader.open(options.export_video)) {
+		return 1;
+	}
+	if (!reader.seek(options.export_start)) {
+		printf("%s HAS NO FRAME %llu\n", options.export_video, (unsigned long long)options.export_start);
+		return 1;
+	}
+#pragma warning(disable:4996)
+	FILE* out = fopen(options.export_to, "wb");
+	if (out == NULL) {
+		printf("ERROR OPENING %s\n", options.export_to);
+		return 1;
+	}
+
+	const int width = SiBoards::INVADERS.screen_width;
+	const int height = SiBoards::INVADERS.screen_height;
+	fprintf(out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 Cmono\n", width, height,
+		(int)(i8080::i8080_Clock::CYCLES_PER_SECOND / SiMachine::INTERRUPT_INTERVAL));
+
+	std::unique_ptr<Frame> frame(new Frame);
+	std::vector<uint8_t> image(width * height);
+	uint64_t expected = UINT64_MAX;
+	uint64_t frames_out = 0;
+	uint64_t sounds = 0;
+	while (reader.next(*frame)) {
+		for (; expected < frame->number; expected++) {
+			fputs("FRAME\n", out);
+			fwrite(image.data(), 1, image.size(), out);
+			frames_out++;
+		}
+
+		// VRAM is stored as columns of the monitor on its side, bit 0 at the bottom
+		for (int y = 0; y < height; y++) {
+			int bit_row = (height - 1) - y;
+			const uint8_t* column = frame->vram + bit_row / 8;
+			uint8_t mask = (uint8_t)(1 << (bit_row % 8));
+			for (int x = 0; x < width; x++) {
+				image[y * width + x] = (column[x * (height / 8)] & mask) ? 0xFF : 0x00;
+			}
+		}
+		fputs("FRAME\n", out);
+		fwrite(image.data(), 1, image.size(), out);
+		frames_out++;
+		sounds += frame->num_sounds;
+		expected = frame->number + 1;
+	}
+	fclose(out);
+
+	printf("exported %llu frames (%llu sound writes, %llu frames dropped while recording) to %s\n",
+		(unsigned long long)frames_out, (unsigned long long)sounds, (unsigned long long)reader.getDropped(),
+		options.export_to);
+	return 0;
+}
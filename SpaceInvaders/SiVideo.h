@@ -0,0 +1,121 @@
+/**
+ * [FILE] SiVideo.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the gameplay recorder, every emulated frame's 1bpp VRAM and
+ *               sound port writes compressed into a seekable file on a thread of
+ *               its own, and the reader that plays the file back
+ *      FILE LAYOUT (little endian):
+ *          "SIVD" | uint32 version | uint16 width | uint16 height |
+ *          uint32 keyframe interval | uint64 frame count | uint64 dropped frames |
+ *          uint64 index offset (0 if the recording was never closed) |
+ *          records: uint64 frame number | uint64 cycle | uint8 flags |
+ *                   uint8 sound count | sound count * (uint64 cycle | uint8 port | uint8 value) |
+ *                   uint16 payload size | payload |
+ *          index: uint64 count | count * uint64 record offset
+ * [DATE] 2021-06-19
+*/
+
+#pragma once
+#include "SiMachine.h"
+#include "../Emulator/EmulatorOptions.h"
+#include "../Emulator/SpscRing.h"
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * [DESCRIPTION] Class holding the recording format
+ *      - A payload is the frame XORed with the one before it, packed as runs:
+ *        a byte below 0x80 skips that many + 1 unchanged bytes, 0x80 and up
+ *        is followed by (byte & 0x7F) + 1 changed bytes, a keyframe is XORed
+ *        with a blank screen instead
+ *      - Frame number n * KEYFRAME_INTERVAL (or the first one recorded after
+ *        it) is a keyframe and index entry n, so a seek reads one index entry
+ *        and decodes at most KEYFRAME_INTERVAL frames
+ *      - Frames the encoder had no room for are dropped and missing from the
+ *        file, a reader shows the picture before them
+*/
+class SiVideo {
+public:
+    static const uint32_t   VERSION = 1;
+    static const int        FRAME_BYTES = SiBoards::INVADERS.getVRAMBytes();
+    static const int        MAX_PAYLOAD = FRAME_BYTES + FRAME_BYTES / 128 + 1;  // nothing repeats
+    static const uint64_t   KEYFRAME_INTERVAL = 300;        // 5 seconds
+    static const int        MAX_SOUNDS = 32;                // sound writes kept per frame
+    static const uint8_t    FLAG_KEYFRAME = 0x01;
+
+    // a frame on its way to the encoder, or read back
+    struct Frame {
+        uint64_t    number;                 // emulated frames since the recording started
+        uint64_t    cycle;                  // clock cycle at the end of the frame
+        uint8_t     vram[FRAME_BYTES];
+        int         num_sounds;
+        SiMachine::SoundWrite sounds[MAX_SOUNDS];
+    };
+
+    /**
+     * [DESCRIPTION] Class writing a recording, the emulation thread only copies
+     *               the frame into a ring, compressing and writing happens on
+     *               the encoder thread
+    */
+    class Recorder {
+    public:
+        static const size_t RING_FRAMES = 128;      // ~2 seconds the encoder may fall behind
+
+        bool        open(const char* path);         // create the file and start the encoder
+        bool        addFrame(SiMachine& machine, bool wait);    // false if the frame was dropped
+        void        close();                        // finish the file (also done by the destructor)
+        Recorder();
+        Recorder(const Recorder&) = delete;         // owns the file and the encoder thread
+        Recorder& operator=(const Recorder&) = delete;
+        ~Recorder();
+    private:
+        std::unique_ptr<SpscRing<Frame, RING_FRAMES>> ring;
+        std::thread         encoder;
+        std::atomic<bool>   closing;
+        FILE*               file;                   // NULL while not recording
+        const char*         path;
+        uint64_t            next_number;            // number of the next frame handed over
+        uint64_t            dropped;
+
+        // ENCODER THREAD =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        uint8_t             previous[FRAME_BYTES];  // last frame written
+        std::vector<uint64_t> index;                // record offset of every keyframe
+        uint64_t            offset;                 // bytes written so far
+        uint64_t            frames_written;
+        void                encodeLoop();
+        void                writeFrame(const Frame& frame);
+        void                writeHeader(uint64_t index_offset);
+    };
+
+    /**
+     * [DESCRIPTION] Class reading a recording back a frame at a time
+    */
+    class Reader {
+    public:
+        bool        open(const char* path);         // read the header and index (false if it is not a recording)
+        bool        seek(uint64_t number);          // next() returns the first frame at or after number
+        bool        next(Frame& frame);             // false at the end of the file
+        uint64_t    getFrameCount();
+        uint64_t    getDropped();
+        Reader();
+        ~Reader();
+    private:
+        FILE*               file;
+        uint32_t            keyframe_interval;
+        uint64_t            frame_count;
+        uint64_t            dropped;
+        std::vector<uint64_t> index;
+        uint8_t             picture[FRAME_BYTES];   // the frame decoded last
+        bool                has_pending;            // seek decoded the frame next() returns
+        Frame               pending;
+        bool                readRecord(Frame& frame, uint8_t& flags, uint8_t* payload, size_t& payload_size);
+        bool                rebuildIndex(uint64_t data_offset);
+    };
+
+    static size_t   encode(const uint8_t* frame, const uint8_t* previous, uint8_t* payload);
+    static bool     decode(const uint8_t* payload, size_t size, uint8_t* frame);
+    static int      exportVideo(const EmulatorOptions& options);    // --export-video, returns the exit code
+};
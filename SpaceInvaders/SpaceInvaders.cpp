@@ -6,7 +6,6 @@
 */
 
 #include "SpaceInvaders.h"
-#include "../testWriter.h"
 
 /**
  * [DESCRIPTION] Handle user input
@@ -17,12 +16,29 @@ void SpaceInvaders::handleUserInput(bool& quit_flag)
 	// event to handle 
 	SDL_Event evnt;
 	bool event_handled = false;
-	static bool joystick_motion = false;
+	input_event_micro = 0;
 
 	// look at the event queue and handle events on it until
 	// there are none left to handle (the queue is empty)
 	while (SDL_PollEvent(&evnt) != 0 ) {
 	//while (SDL_PollEvent(&evnt) != 0 && !event_handled) {
+		// the pacing keys work while replaying too
+		if ((evnt.type == SDL_KEYDOWN || evnt.type == SDL_KEYUP) && handlePacingKey(evnt.key)) {
+			continue;
+		}
+
+		// while replaying the movie owns the input ports, only let the user quit
+		if (options.replay_path != nullptr && evnt.type != SDL_QUIT &&
+			!(evnt.type == SDL_KEYDOWN && evnt.key.keysym.sym == SDLK_q)) {
+			continue;
+		}
+
+		// remember when the first input of the poll happened (SDL stamps events in ms)
+		if (input_event_micro == 0 && (evnt.type == SDL_KEYDOWN || evnt.type == SDL_KEYUP || evnt.type == SDL_JOYBUTTONDOWN ||
+			evnt.type == SDL_JOYBUTTONUP || evnt.type == SDL_JOYAXISMOTION)) {
+			input_event_micro = HostTimer::nowMicro() - (uint64_t)(SDL_GetTicks() - evnt.common.timestamp) * 1000;
+		}
+
 		// HANDLE MOUSE CLICKS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 		if (evnt.type == SDL_QUIT) {
 			quit_flag = true;
@@ -276,15 +292,138 @@ void SpaceInvaders::handleUserInput(bool& quit_flag)
 }
 
 /**
- * [DESCRIPTION] Load the game ROM files into memory
- * 
+ * [DESCRIPTION] Poll the user input, if it changed the input ports while
+ *               --latency is on the change is followed to the screen
+ *
+ * [PARAM] quit_flag
+*/
+void SpaceInvaders::sampleInput(bool& quit_flag)
+{
+	uint8_t port_1 = cpu->io->input.get_port(1)->port_val.byte_val;
+	uint8_t port_2 = cpu->io->input.get_port(2)->port_val.byte_val;
+
+	handleUserInput(quit_flag);
+
+	if (options.latency && (port_1 != cpu->io->input.get_port(1)->port_val.byte_val ||
+		port_2 != cpu->io->input.get_port(2)->port_val.byte_val)) {
+		latency.inputChanged(*machine, input_event_micro);
+	}
+}
+
+/**
+ * [DESCRIPTION] Stamp the input ports into the movie being recorded, the new
+ *               port values are seen by the next opcode to run
+ *
 */
-void SpaceInvaders::loadRomFiles()
+void SpaceInvaders::recordInput()
 {
-	cpu->memory->loadRom("SpaceInvaders/rom/invaders.h", 0);
-    cpu->memory->loadRom("SpaceInvaders/rom/invaders.g", 0x800);
-    cpu->memory->loadRom("SpaceInvaders/rom/invaders.f", 0x1000);
-    cpu->memory->loadRom("SpaceInvaders/rom/invaders.e", 0x1800);
+	if (options.record_path != nullptr) {
+		movie.recordInput(cpu->clock->getCurrentCCs(),
+			cpu->io->input.get_port(1)->port_val.byte_val,
+			cpu->io->input.get_port(2)->port_val.byte_val);
+	}
+}
+
+/**
+ * [DESCRIPTION] Handle the keys that change how fast the game runs
+ * 		- P pauses/resumes, N runs a single frame while paused
+ * 		- TAB runs unthrottled while held (fast forward)
+ * 		- minus/equals halve/double the speed (1/4x to 16x)
+ *
+ * [PARAM] key
+ * [RETURN] true if the key was a pacing key
+*/
+bool SpaceInvaders::handlePacingKey(const SDL_KeyboardEvent& key)
+{
+	bool down = key.type == SDL_KEYDOWN;
+
+	switch (key.keysym.sym) {
+	case SDLK_TAB:
+		if (down != turbo) {
+			turbo = down;
+			updatePacing();
+		}
+		return true;
+	case SDLK_p:
+		if (down && !key.repeat) {
+			paused = !paused;
+			updatePacing();
+		}
+		return true;
+	case SDLK_n:
+		if (down && paused) {
+			cpu->clock->requestStep();
+		}
+		return true;
+	case SDLK_MINUS:
+	case SDLK_EQUALS:
+		if (down && !key.repeat) {
+			if (speed == 0) {
+				speed = 1.0;
+			}
+			else if (key.keysym.sym == SDLK_MINUS && speed > 0.25) {
+				speed /= 2;
+			}
+			else if (key.keysym.sym == SDLK_EQUALS && speed < 16) {
+				speed *= 2;
+			}
+			updatePacing();
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * [DESCRIPTION] Apply the paused/turbo/speed settings to the cpu clock
+ *
+*/
+void SpaceInvaders::updatePacing()
+{
+	if (paused) {
+		cpu->clock->setPacing(i8080::i8080_Clock::PACING_PAUSED);
+	}
+	else if (turbo || speed == 0) {
+		cpu->clock->setPacing(i8080::i8080_Clock::PACING_UNTHROTTLED);
+	}
+	else if (speed == 1.0) {
+		cpu->clock->setPacing(i8080::i8080_Clock::PACING_REAL_TIME);
+	}
+	else {
+		cpu->clock->setPacing(i8080::i8080_Clock::PACING_SCALED, speed);
+	}
+
+	// the sound plays emulated time back at the same speed
+	if (audio != NULL && speed > 0) {
+		audio->setSpeed(speed);
+	}
+	audio_fill = -1;
+}
+
+/**
+ * [DESCRIPTION] Steer the speed so the emulated time queued ahead of the sound
+ *               card stays at SOUND_LATENCY, the card's clock becomes the
+ *               master and playback never has to jump (--audio-sync)
+ *      - The speed moves at most AUDIO_SYNC_ADJUST off the user's speed,
+ *        in proportion to how far the smoothed fill is off the target
+ *      - Nothing is steered while paused, fast forwarding or unthrottled
+ *
+*/
+void SpaceInvaders::updateAudioSync()
+{
+	int64_t buffered;
+	if (!options.audio_sync || paused || turbo || speed == 0 || !audio->getBufferedCycles(buffered)) {
+		return;
+	}
+	audio_fill = audio_fill < 0 ? (double)buffered : audio_fill + (buffered - audio_fill) * AUDIO_SYNC_SMOOTHING;
+
+	double error = (SOUND_LATENCY - audio_fill) / SOUND_LATENCY;
+	error = error > 1.0 ? 1.0 : (error < -1.0 ? -1.0 : error);
+	double adjust = error * AUDIO_SYNC_ADJUST;
+	audio_adjust_min = adjust < audio_adjust_min ? adjust : audio_adjust_min;
+	audio_adjust_max = adjust > audio_adjust_max ? adjust : audio_adjust_max;
+	cpu->clock->adjustSpeed(speed * (1.0 + adjust));
 }
 
 /**
@@ -293,16 +432,68 @@ void SpaceInvaders::loadRomFiles()
 */
 void SpaceInvaders::loadScreenUpdate()
 {
-	// update the screen pixels (the VRAM)
+	// write the screen pixels straight into the texture
 	prepareVRAM();
-	// apply the updated VRAM to the screen
-	SDL_UpdateTexture(siContainer, NULL, video_RAM, 4 * 224);
-	// clear the old renderer
-	SDL_RenderClear(gwRenderer);
-	// re apply the background bezel
-	SDL_RenderCopy(gwRenderer, siBackground, NULL, NULL);
-	// apply the si container to the background
-	SDL_RenderCopy(gwRenderer, siContainer, NULL, &fillRect);
+	presentScreen();
+}
+
+/**
+ * [DESCRIPTION] Show the screen --run-ahead frames ahead of the game
+ *      - The board is saved, run on with the input held, drawn and put back,
+ *        so the picture already shows what the game does with input it has
+ *        not read yet (it only reads the ports at certain points of its
+ *        interrupt handlers)
+ *      - The sound of the look ahead frames is not captured, the real frames
+ *        play it
+ *      - The opcode/interrupt counters are put back too, the overlay and the
+ *        exported metrics only count the frames the game really ran
+ *
+*/
+void SpaceInvaders::presentRunAhead()
+{
+	uint64_t start_micro = HostTimer::nowMicro();
+	uint64_t opcodes_run = machine->opcodes_run;
+	uint64_t interrupts_run = machine->interrupts_run;
+	machine->saveState(run_ahead_state);
+	machine->capture_sound = false;
+	machine->runUntil(cpu->clock->getCurrentCCs() + (uint64_t)options.run_ahead * SiMachine::INTERRUPT_INTERVAL);
+	prepareVRAM();
+	machine->loadState(run_ahead_state);
+	machine->opcodes_run = opcodes_run;
+	machine->interrupts_run = interrupts_run;
+	machine->capture_sound = true;
+	run_ahead_micro += HostTimer::nowMicro() - start_micro;
+	run_ahead_frames++;
+
+	presentScreen();
+}
+
+/**
+ * [DESCRIPTION] Compose the game texture on the bezel and present it
+ *      - Only the game rectangle is redrawn on the cached bezel, the
+ *        composite then goes to the window in a single copy
+ *
+*/
+void SpaceInvaders::presentScreen()
+{
+	if (siScreen != NULL) {
+		// apply the si container to the cached bezel
+		SDL_SetRenderTarget(gwRenderer, siScreen);
+		SDL_RenderCopy(gwRenderer, siContainer, NULL, &fillRect);
+		SDL_SetRenderTarget(gwRenderer, NULL);
+		SDL_RenderCopy(gwRenderer, siScreen, NULL, NULL);
+	}
+	else {
+		// re apply the background bezel (it covers the whole window so
+		// there is nothing to clear) and the si container on top of it
+		SDL_RenderCopy(gwRenderer, siBackground, NULL, NULL);
+		SDL_RenderCopy(gwRenderer, siContainer, NULL, &fillRect);
+	}
+	// the panel goes over the top left of the bezel, clear of the game
+	if (perf_overlay != NULL) {
+		perf_overlay->draw(gwRenderer, 8 * options.scale, 8 * options.scale, options.scale);
+		perf_overlay->framePresented(HostTimer::nowMicro() - draw_start_micro);
+	}
 	// display the screen
 	SDL_RenderPresent(gwRenderer);
 }
@@ -320,308 +511,257 @@ void SpaceInvaders::mainLoop()
 	int game_timer = 0;
 
 	// to hold clock cycles for loop
-	int clock_cycles_to_run = 0;
-	int goal_clock_cycles = 0;
+	uint64_t clock_cycles_to_run = 0;
+	uint64_t goal_clock_cycles = 0;
+	uint64_t frame_start = 0;
 
-	// to handle interrupts
-	int interrupt_interval = 33333;
-	uint64_t next_interrupt_cc = interrupt_interval;
-	int next_interrupt_to_send = 1;
+	// when replaying the movie drives the input ports
+	if (options.replay_path != nullptr) {
+		machine->playMovie(&movie);
+	}
 
-	while (!quit_flag) {
-		// GET CLOCK =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		// get the amount of clock cycles to run
-		clock_cycles_to_run = cpu->clock->getCyclesToRun();
-		goal_clock_cycles = cpu->clock->getCyclesToRun() + cpu->clock->getCurrentCCs();
+	paused = options.paused;
+	turbo = false;
+	speed = options.speed;
+	updatePacing();
 
+	while (!quit_flag) {
 		// USER INPUT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		handleUserInput(quit_flag);
-
-		// RUN CPU =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		// execute opcodes until the desired number of ccs has been reached
-		while (cpu->clock->getCurrentCCs() < goal_clock_cycles) {
-
-			// INTERRUPT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
-			// check for interrupt condition
-			// 2 clock cycles per micro second 
-			// 1/60 second = 16666 micro seconds
-			// so interrupt every 2 * 16666 = 33333 clock cycles
-			if (cpu->clock->getCurrentCCs() >= next_interrupt_cc) {
-				cpu->sendInterrupt(next_interrupt_to_send);
-				next_interrupt_to_send = next_interrupt_to_send == 1 ? 2 : 1;
-				next_interrupt_cc += interrupt_interval;
+		sampleInput(quit_flag);
+
+		// GET CLOCK =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+		// the pacing is checked once per frame, it hands out a whole frame
+		// of clock cycles once the frame is due
+		clock_cycles_to_run = cpu->clock->getCyclesToRun(SiMachine::INTERRUPT_INTERVAL);
+
+		if (clock_cycles_to_run > 0) {
+			frame_start = cpu->clock->getCurrentCCs();
+			goal_clock_cycles = frame_start + clock_cycles_to_run;
+			uint64_t run_start_micro = HostTimer::nowMicro();
+
+			// RECORD INPUT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=
+			recordInput();
+
+			// LATE INPUT =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+			// run up to just before the game reads the input, wait until that
+			// cycle is due and sample the input again (a game that read it
+			// earlier than last frame keeps the input sampled above)
+			if (options.late_input) {
+				machine->clearInputRead();
+				if (input_read_offset < clock_cycles_to_run) {
+					machine->runUntil(frame_start + input_read_offset);
+					latency.update(*machine);
+					if (machine->getInputRead() == UINT64_MAX) {
+						if (cpu->clock->getPacing() != i8080::i8080_Clock::PACING_PAUSED) {
+							uint64_t sleep_micro = HostTimer::nowMicro();
+							HostTimer::sleepUntil(cpu->clock->getNextDueMicro());
+							run_start_micro += HostTimer::nowMicro() - sleep_micro;	// waiting is not busy
+						}
+						sampleInput(quit_flag);
+						recordInput();
+					}
+				}
 			}
-			
-			// CPU STEP =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-			// step the cpu to the next cycle
-			cpu->step();
-
-			// DEBUG
-			//writeOpcode(cpu->memory->opCode_Array[0], cpu->registers->PC.get(), 0,
-			//	cpu->registers->SP.get(), cpu->registers->A.get(), cpu->registers->B.get(), cpu->registers->C.get(),
-			//	cpu->registers->D.get(), cpu->registers->E.get(), cpu->registers->H.get(), cpu->registers->L.get(),
-			//	cpu->flags->Z.get(), cpu->flags->S.get(), cpu->flags->P.get(), cpu->flags->C.get(), cpu->flags->AC.get());
-
-			// EXE CPU =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-			// execute the opcode
-			cpu->execute->runOpCode();
-
-			// SHIFT CHECK =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=
-			// check for shift condition
-			if ((cpu->memory->opCode_Array[0] == 0xD3) &&
-				(cpu->memory->opCode_Array[1] == 0x04)) {
-				performShift();
+
+			// RUN CPU =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+			// execute opcodes until the desired number of ccs has been reached
+			machine->runUntil(goal_clock_cycles);
+			latency.update(*machine);
+
+			// the split for the next frame
+			if (options.late_input) {
+				uint64_t read_cc = machine->getInputRead();
+				input_read_offset = clock_cycles_to_run;
+				if (read_cc != UINT64_MAX && read_cc >= frame_start) {
+					uint64_t offset = read_cc - frame_start;
+					input_read_offset = offset > LATE_INPUT_MARGIN ? offset - LATE_INPUT_MARGIN : 0;
+				}
 			}
 
-			// SCREEN UPDATE =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=
-			if (SDL_GetTicks() - game_timer > (1000 / 60)) {
-				game_timer = SDL_GetTicks();
-				loadScreenUpdate();
+			// the recorder takes the frame's sound writes before they are played
+			if (video != NULL) {
+				video->addFrame(*machine, false);
 			}
 
+			// hand the frame's sound triggers to the audio thread
 			updateSound();
+			updateAudioSync();
+			uint64_t run_micro = HostTimer::nowMicro() - run_start_micro;
+			if (perf_overlay != NULL) {
+				perf_overlay->frameRun(cpu->clock->getCurrentCCs(), machine->opcodes_run, run_micro);
+			}
+			if (metrics != NULL) {
+				metrics->publishFrame({ cpu->clock->getCurrentCCs(), machine->opcodes_run, machine->interrupts_run,
+					audio->getUnderruns() }, run_micro);
+			}
 
+			// SCREEN UPDATE =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=
+			// every frame at real time, at most 60 per second when faster
+			// (with --audio-sync every frame the sound card paced is shown)
+			bool audio_paced = options.audio_sync && !turbo && speed > 0 && speed <= 1.0;
+			if (audio_paced || SDL_GetTicks() - game_timer >= (1000 / 60)) {
+				game_timer = SDL_GetTicks();
+				draw_start_micro = HostTimer::nowMicro();
+				if (options.run_ahead > 0) {
+					presentRunAhead();
+				}
+				else {
+					loadScreenUpdate();
+				}
+				latency.framePresented();
+			}
+		}
+		else {
+			// SLEEP =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+			// nothing to run until the next frame is due, a paused game
+			// still wakes up once a frame to look at the input
+			uint64_t wake_micro = cpu->clock->getNextDueMicro();
+			uint64_t poll_micro = HostTimer::nowMicro() + 1000000 / 60;
+			HostTimer::sleepUntil(wake_micro < poll_micro ? wake_micro : poll_micro);
 		}
 
-		// RESET CLOCK =-=-=-=-=--=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		cpu->clock->resetClockTimer();
+		// stop once the whole movie has been played back
+		if (options.replay_path != nullptr && cpu->clock->getCurrentCCs() >= movie.getEndCycle()) {
+			quit_flag = true;
+		}
+	}
 
+	// save the recorded session
+	if (options.record_path != nullptr) {
+		movie.finish(cpu->clock->getCurrentCCs());
+		movie.save(options.record_path);
+	}
+	if (video != NULL) {
+		video->close();
+	}
+	if (options.latency) {
+		latency.print();
+	}
+	if (options.run_ahead > 0 && run_ahead_frames > 0) {
+		printf("run-ahead: %d frames, %.1f us per presented frame (save, look ahead, draw, load)\n",
+			options.run_ahead, (double)run_ahead_micro / run_ahead_frames);
+	}
+	if (options.audio_sync) {
+		printf("audio sync: speed steered %+.2f%% to %+.2f%%, playback jumped %u times\n",
+			audio_adjust_min * 100, audio_adjust_max * 100, audio->getResyncs());
 	}
 }
 
 /**
- * [DESCRIPTION] Prepare the moast recent VRAM screen
+ * [DESCRIPTION] Write the most recent VRAM screen into the locked game texture
+ *               in whatever pixel format it was made with
  * 
 */
 void SpaceInvaders::prepareVRAM()
 {
-	// Load the current state of memory into an array that will 
-    // eventually be loaded to the screen
-    
-    // Loop through the bytes 
-    for (int byte_cnt = 0; byte_cnt < 256 * 224 / 8; byte_cnt++) {
-        // Get the row and column of the current byte
-        int row = (byte_cnt * 8) / 256;
-        int col = (byte_cnt * 8) % 256;
-
-        // Get the value of the byte out of memory
-        uint8_t* byte = (uint8_t*)(cpu->memory->returnPtrToMem(0x2400)) + byte_cnt;
-
-        unsigned int* pix;
-        for (int bit = 0; bit < 8; bit++) {
-
-            int offset = (255 - (col + bit)) * 224 * 4 + (row * 4);
-
-            pix = (unsigned int*)((uint8_t*)video_RAM + offset);
-
-            if ((*byte & (1 << bit)) != 0) {
-                *pix = 0xffffffffL;
-            }                
-            else {
-                *pix = 0x00000000L;
-            }
-        }
-    }
-}
-
-/**
- * [DESCRIPTION] Emulate the SI register shift
- * 
-*/
-void SpaceInvaders::performShift()
-{
-	// https://computerarcheology.com/Arcade/SpaceInvaders/Hardware.html
-	//f              0	bit
-	//	xxxxxxxxyyyyyyyy
-
-	//	Writing to Port 4 shifts x into y, and the new value into x, eg.
-	//	$0000,
-	//	write $aa->$aa00,
-	//	write $ff->$ffaa,
-	//	write $12->$12ff, ..
-	//printf("PreShiftRegister: %4X\n", shift_register.get());
-	uint16_t uint16_InitialShiftRegister = shift_register.get();
-	uint16_t uint16_ShiftRegisterTemp = 0x0000;
-	uint8_t uint8_ShiftLow = 0x00;
-	uint8_t uint8_ShiftHigh = 0x00;
-
-	uint8_ShiftLow = uint8_ShiftLow | uint16_InitialShiftRegister;
-	uint8_ShiftHigh = uint8_ShiftHigh | (uint16_InitialShiftRegister >> 8);
-
-	uint16_ShiftRegisterTemp = uint16_ShiftRegisterTemp | cpu->io->output.get_port(4)->port_val.byte_val;
-	uint16_ShiftRegisterTemp = uint16_ShiftRegisterTemp << 0x08;
-	uint16_ShiftRegisterTemp = uint16_ShiftRegisterTemp | uint8_ShiftHigh;
-		
-	shift_register.set(uint16_ShiftRegisterTemp);
-	//printf("PostShiftRegister: %4X\n", shift_register.get());
-
-	//	Writing to Port 2 (bits 0, 1, 2) sets the offset for the 8 bit result, eg.
-	
-	uint8_t uint8_Offset = (cpu->io->output.get_port(2)->port_val.byte_val & 0x07);
-	uint8_t uint8_RegisterTemp = 0x00;
-	//printf("Offset: %4X\n", uint8_Offset);
-	// 
-	//	offset 0:
-	//rrrrrrrr		result = xxxxxxxx
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x00) {
-		uint8_RegisterTemp = shift_register.get() >> 0x08;
-	}
-
-	//	offset 1:
-	//rrrrrrrr		result = xxxxxxxy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x01) {
-		uint8_RegisterTemp = shift_register.get() >> 0x07;
+	void* pixels;
+	int pitch;
+	if (SDL_LockTexture(siContainer, NULL, &pixels, &pitch) != 0) {
+		return;
 	}
 
-	//	offset 2 :
-	//	rrrrrrrr	result = xxxxxxyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x02) {
-		uint8_RegisterTemp = shift_register.get() >> 0x06;
-	}
-
-	//	offset 3:
-	//rrrrrrrr		result = xxxxxyyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x03) {
-		uint8_RegisterTemp = shift_register.get() >> 0x05;
+	// the filter works a row at a time on 32 bit pixels
+	if (filter.isActive()) {
+		const uint8_t* vram = machine->getVRAM();
+		uint32_t row[EM_WIDTH];
+		int rows_per_line = filter.getScale();
+		for (int y = 0; y < EM_HEIGHT; y++) {
+			convertRow<uint32_t>(vram, y, row, 0xFFFFFFFF, 0xFF000000);
+			filter.filterRow(row, y, (uint8_t*)pixels + y * rows_per_line * pitch, pitch);
+		}
+		SDL_UnlockTexture(siContainer);
+		return;
 	}
 
-	//	offset 4:
-	//rrrrrrrr		result = xxxxyyyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x04) {
-		uint8_RegisterTemp = shift_register.get() >> 0x04;
+	switch (options.pixel_bits) {
+	case 8:
+		convertVRAM<uint8_t>((uint8_t*)pixels, pitch, 0xFF, 0x00);
+		break;
+	case 16:
+		convertVRAM<uint16_t>((uint8_t*)pixels, pitch, 0xFFFF, 0x0000);
+		break;
+	default:
+		convertVRAM<uint32_t>((uint8_t*)pixels, pitch, 0xFFFFFFFF, 0xFF000000);
+		break;
 	}
 
-	//	offset 5:
-	//rrrrrrrr		result = xxxyyyyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x05) {
-		uint8_RegisterTemp = shift_register.get() >> 0x03;
-	}
+	SDL_UnlockTexture(siContainer);
+}
 
-	//	offset 6:
-	//rrrrrrrr		result = xxyyyyyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x06) {
-		uint8_RegisterTemp = shift_register.get() >> 0x02;
-	}
+/**
+ * [DESCRIPTION] Rotate the 1bpp VRAM into the texture's pixels
+ *      - VRAM is stored as 224 columns of 256 bits (the monitor is on its
+ *        side), bit 0 of each column's first byte is the bottom pixel
+ *      - The texture is written one row at a time so the writes stay in order
+ *
+ * [PARAM] pixels - locked texture memory
+ * [PARAM] pitch - bytes per texture row
+ * [PARAM] on - pixel value of a lit pixel
+ * [PARAM] off - pixel value of a dark pixel
+*/
+template <typename PIXEL>
+void SpaceInvaders::convertVRAM(uint8_t* pixels, int pitch, PIXEL on, PIXEL off)
+{
+	const uint8_t* vram = machine->getVRAM();
 
-	//	offset 7 :
-	//	rrrrrrrr	result = xyyyyyyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x07) {
-		uint8_RegisterTemp = shift_register.get() >> 0x01;
+	for (int y = 0; y < EM_HEIGHT; y++) {
+		convertRow<PIXEL>(vram, y, (PIXEL*)(pixels + y * pitch), on, off);
 	}
+}
 
-	//	offset 8 :
-	//	rrrrrrrr	result = yyyyyyyy
-	//	xxxxxxxxyyyyyyyy
-	if (uint8_Offset == 0x08) {
-		uint8_RegisterTemp = shift_register.get() >> 0x00;
+/**
+ * [DESCRIPTION] Rotate a single screen row out of the 1bpp VRAM
+ *
+ * [PARAM] vram
+ * [PARAM] y - screen row, 0 is the top
+ * [PARAM] row - EM_WIDTH pixels
+ * [PARAM] on - pixel value of a lit pixel
+ * [PARAM] off - pixel value of a dark pixel
+*/
+template <typename PIXEL>
+inline void SpaceInvaders::convertRow(const uint8_t* vram, int y, PIXEL* row, PIXEL on, PIXEL off)
+{
+	int bit_row = (EM_HEIGHT - 1) - y;
+	const uint8_t* column = vram + bit_row / 8;
+	uint8_t mask = (uint8_t)(1 << (bit_row % 8));
+	for (int x = 0; x < EM_WIDTH; x++) {
+		row[x] = (column[x * (EM_HEIGHT / 8)] & mask) ? on : off;
 	}
-
-	cpu->io->input.get_port(3)->port_val.byte_val = uint8_RegisterTemp;
-	// cpu->io->input.set(3, uint8_RegisterTemp);
-
 }
 
 /**
-* [DESCRIPTION] Function to update the Sound Effects of the game
-* Helpful links:	https://gigi.nullneuron.net/gigilabs/playing-a-wav-file-using-sdl2/
-*					https://soundprogramming.net/programming/tutorial-using-sdl2-and-sdl_mixer-to-play-samples/
+* [DESCRIPTION] Turn the sound port writes of the frame just run into audio
+*               triggers stamped with the cycle each write happened on
+*      - A rising bit starts its sample, the UFO (port 3 bit 0) loops until
+*        its bit falls again
+*      - Fast forwarding only lets sounds stop, new ones would just stack up
 */
 void SpaceInvaders::updateSound()
-{	
-	//static bool soundUFO = false;
-	static bool soundShot = false;
-	static bool soundExplosion = false;
-	static bool soundInvaderKilled = false;
-	static bool soundInvader1 = false;
-	static bool soundInvader2 = false;
-	static bool soundInvader3 = false;
-	static bool soundInvader4 = false;
-
-	//Port 3: (discrete sounds)
-	//bit 0 = UFO(repeats)        SX0 0.raw
-	if ((cpu->io->output.get_port(3)->port_val.bit_struct.b0) == true) {
-		Mix_PlayChannel(-1, wav_UFOHighPitchSoundEffect, 0);
-	}
-
-	////bit 1 = Shot                 SX1 1.raw
-	if ((cpu->io->output.get_port(3)->port_val.bit_struct.b1) == true && !soundShot) {
-		Mix_PlayChannel(-1, wav_ShotSoundEffect, 0);
-		soundShot = true;
-	}
-	else if ((cpu->io->output.get_port(3)->port_val.bit_struct.b1) == false) {
-		soundShot = false;
-	}
-
-	////bit 2 = Flash(player die)   SX2 2.raw
-	if ((cpu->io->output.get_port(3)->port_val.bit_struct.b2) == true && !soundExplosion) {
-		Mix_PlayChannel(-1, wav_ExplosionSoundEffect, 0);
-		soundExplosion = true;
-	}
-	else if ((cpu->io->output.get_port(3)->port_val.bit_struct.b2) == false) {
-		soundExplosion = false;
-	}
-
-	////bit 3 = Invader die          SX3 3.raw
-	if ((cpu->io->output.get_port(3)->port_val.bit_struct.b3) == true && !soundInvaderKilled)
-	{
-		Mix_PlayChannel(-1, wav_InvaderKilledSoundEffect, 0);
-		soundInvaderKilled = true;
-	}
-	else if ((cpu->io->output.get_port(3)->port_val.bit_struct.b3) == false) {
-		soundInvaderKilled = false;
-	}
-
-	////Port 5 :
-	////bit 0 = Fleet movement 1     SX6 4.raw
-	if ((cpu->io->output.get_port(5)->port_val.bit_struct.b0) == true && !soundInvader1)
-	{
-		Mix_PlayChannel(-1, wav_FastInvader1SoundEffect, 0);
-		soundInvader1 = true;
-	}
-	else if ((cpu->io->output.get_port(5)->port_val.bit_struct.b0) == false) {
-		soundInvader1 = false;
-	}
-
-	////bit 1 = Fleet movement 2     SX7 5.raw
-	if ((cpu->io->output.get_port(5)->port_val.bit_struct.b1) == true && !soundInvader2) 
-	{
-		Mix_PlayChannel(-1, wav_FastInvader2SoundEffect, 0);
-		soundInvader2 = true;
-	}
-	else if ((cpu->io->output.get_port(5)->port_val.bit_struct.b1) == false) {
-		soundInvader2 = false;
-	}
-
-	////bit 2 = Fleet movement 3     SX8 6.raw
-	if ((cpu->io->output.get_port(5)->port_val.bit_struct.b2) == true && !soundInvader3)
-	{
-		Mix_PlayChannel(-1, wav_FastInvader3SoundEffect, 0);
-		soundInvader3 = true;
-	}
-	else if ((cpu->io->output.get_port(5)->port_val.bit_struct.b2) == false) {
-		soundInvader3 = false;
-	}
-
-	////bit 3 = Fleet movement 4     SX9 7.raw
-	if ((cpu->io->output.get_port(5)->port_val.bit_struct.b3) == true && !soundInvader4)
-	{
-		Mix_PlayChannel(-1, wav_FastInvader4SoundEffect, 0);
-		soundInvader4 = true;
-	}
-	else if ((cpu->io->output.get_port(5)->port_val.bit_struct.b3) == false) {
-		soundInvader4 = false;
+{
+	bool muted = cpu->clock->getPacing() == i8080::i8080_Clock::PACING_UNTHROTTLED;
+
+	for (const SiMachine::SoundWrite& write : machine->sound_writes) {
+		int port_ind = write.port == 0x03 ? 0 : 1;
+		uint8_t rising = write.value & ~sound_ports[port_ind];
+		uint8_t falling = ~write.value & sound_ports[port_ind];
+		sound_ports[port_ind] = write.value;
+
+		for (int bit = 0; bit < 8; bit++) {
+			int voice = sound_voices[port_ind][bit];
+			bool looping = port_ind == 0 && bit == 0;
+			if (voice < 0) {
+				continue;
+			}
+			if ((rising & (1 << bit)) && !muted) {
+				audio->trigger(write.cycle, voice, looping ? AudioEngine::ACTION_LOOP : AudioEngine::ACTION_PLAY);
+			}
+			else if ((falling & (1 << bit)) && looping) {
+				audio->trigger(write.cycle, voice, AudioEngine::ACTION_STOP);
+			}
+		}
 	}
-
-	////bit 4 = UFO Hit              SX10 8.raw
-
+	machine->sound_writes.clear();
+	audio->sync(cpu->clock->getCurrentCCs());
 }
 
 /**
@@ -630,26 +770,25 @@ void SpaceInvaders::updateSound()
 */
 void SpaceInvaders::displayInstructions()
 {
-	SDL_Surface* imageLoader;
 	SDL_Texture* instructions;
 	bool exit_instructions = false;
 	SDL_Event evnt;
 
-	// load the correct instruction set
+	// take the correct instruction set from the cache
 	if (gc_1 == NULL) {
-		imageLoader = SDL_LoadBMP("SpaceInvaders/space_invaders_keyboard.bmp");
+		instructions = assets->getTexture(gwRenderer, "SpaceInvaders/space_invaders_keyboard.bmp");
 	}
 	else {
-		imageLoader = SDL_LoadBMP("SpaceInvaders/space_invaders_controller.bmp");
+		instructions = assets->getTexture(gwRenderer, "SpaceInvaders/space_invaders_controller.bmp");
 	}
 
-	instructions = SDL_CreateTextureFromSurface(gwRenderer, imageLoader);
 	SDL_RenderCopy(gwRenderer, instructions, NULL, NULL);
 	SDL_RenderPresent(gwRenderer);
 
 	// display the instructions on the screen until space OR a button 
+	// (the thread sleeps until each event arrives)
 	while (!exit_instructions) {
-		while (SDL_PollEvent(&evnt) != 0) {
+		if (SDL_WaitEvent(&evnt) != 0) {
 			if (evnt.type == SDL_KEYDOWN) {
 				if (evnt.key.keysym.sym == SDLK_SPACE) {
 					exit_instructions = true;
@@ -662,9 +801,39 @@ void SpaceInvaders::displayInstructions()
 			}
 		}
 	}
+}
 
-	SDL_FreeSurface(imageLoader);
-	SDL_DestroyTexture(instructions);
+/**
+ * [DESCRIPTION] Register every image, sound and ROM set the game uses so they
+ *               are loaded with the rest of the emulator's assets at startup
+ *
+ * [PARAM] assets
+ * [PARAM] options - picks the board's ROM set
+*/
+void SpaceInvaders::addAssets(AssetCache& assets, const EmulatorOptions& options)
+{
+	assets.addImage("SpaceInvaders/space_invaders_bezel.bmp");
+	assets.addImage("SpaceInvaders/space_invaders_keyboard.bmp");
+	assets.addImage("SpaceInvaders/space_invaders_controller.bmp");
+	assets.addSound("SpaceInvaders/sound/shoot.wav");
+	assets.addSound("SpaceInvaders/sound/explosion.wav");
+	assets.addSound("SpaceInvaders/sound/fastinvader1.wav");
+	assets.addSound("SpaceInvaders/sound/fastinvader2.wav");
+	assets.addSound("SpaceInvaders/sound/fastinvader3.wav");
+	assets.addSound("SpaceInvaders/sound/invaderkilled.wav");
+	assets.addSound("SpaceInvaders/sound/ufo_highpitch.wav");
+	assets.addRomSet(romSetPath(options).c_str());
+}
+
+/**
+ * [DESCRIPTION] Return the manifest of the board's ROM set
+ *
+ * [PARAM] options - picks the board
+ * [RETURN] std::string
+*/
+std::string SpaceInvaders::romSetPath(const EmulatorOptions& options)
+{
+	return std::string("SpaceInvaders/rom/") + SiBoard::find(options.board)->romset;
 }
 
 /**
@@ -675,70 +844,152 @@ void SpaceInvaders::runGame()
 {
 	displayInstructions();
 
-	/* Create space invader specific SDL structures */
-	SDL_Surface* siBezel = SDL_LoadBMP("SpaceInvaders/space_invaders_bezel.bmp");
-	if (siBezel == NULL) {
-		printf("ERROR LOADING BEZEL\n");
-	}
-	siBackground = SDL_CreateTextureFromSurface(gwRenderer, siBezel);
+	/* Create space invader specific SDL structures (the bezel is owned by the cache) */
+	siBackground = assets->getTexture(gwRenderer, "SpaceInvaders/space_invaders_bezel.bmp");
 	if (siBackground == NULL) {
 		printf("ERROR LOADING BACKGROUND\n");
 	}
 
-	// create a texture to run the emulator inside of 
+	// set up the filter, the cabinet's gel puts a red strip over the UFO and
+	// a green one over the shields, the player and the remaining lives
+	int scale = options.scale;
+	filter.setScale(scale);
+	filter.setScanlines(options.scanlines);
+	if (options.overlay) {
+		filter.addBand(32, 64, 0, EM_WIDTH, 0xFF3030);
+		filter.addBand(184, 240, 0, EM_WIDTH, 0x30FF30);
+		filter.addBand(240, EM_HEIGHT, 16, 134, 0x30FF30);
+	}
+	filter.prepare(EM_WIDTH, EM_HEIGHT);
+	fillRect = { 165 * scale, 181 * scale, EM_WIDTH * scale, EM_HEIGHT * scale };
+
+	// create a texture to run the emulator inside of, the smaller formats
+	// cut down what is uploaded every frame
+	Uint32 pixel_format = SDL_PIXELFORMAT_ARGB8888;
+	if (options.pixel_bits == 16) {
+		pixel_format = SDL_PIXELFORMAT_RGB565;
+	}
+	else if (options.pixel_bits == 8) {
+		pixel_format = SDL_PIXELFORMAT_RGB332;
+	}
 	siContainer = SDL_CreateTexture(
 		gwRenderer,
-		SDL_PIXELFORMAT_RGBA8888,
+		pixel_format,
 		SDL_TEXTUREACCESS_STREAMING,
-		EM_WIDTH,
-		EM_HEIGHT);
-
-	// load the rom files for the game
-	loadRomFiles();
-
-	// to setup the sound
-	wav_ShotSoundEffect				= Mix_LoadWAV("SpaceInvaders/sound/shoot.wav");
-	wav_ExplosionSoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/explosion.wav");
-	wav_FastInvader1SoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/fastinvader1.wav");
-	wav_FastInvader2SoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/fastinvader2.wav");
-	wav_FastInvader3SoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/fastinvader3.wav");
-	wav_FastInvader4SoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/fastinvader4.wav");
-	wav_InvaderKilledSoundEffect	= Mix_LoadWAV("SpaceInvaders/sound/invaderkilled.wav");
-	wav_UFOHighPitchSoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/ufo_highpitch.wav");
-	wav_UFOLowPitchSoundEffect		= Mix_LoadWAV("SpaceInvaders/sound/ufo_lowpitch.wav");
+		EM_WIDTH * scale,
+		EM_HEIGHT * scale);
+
+	// draw the bezel once into a texture the game is composed on
+	SDL_Surface* bezel = assets->getSurface("SpaceInvaders/space_invaders_bezel.bmp");
+	if (bezel != NULL) {
+		siScreen = SDL_CreateTexture(gwRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+			bezel->w * scale, bezel->h * scale);
+	}
+	if (siScreen != NULL) {
+		SDL_SetRenderTarget(gwRenderer, siScreen);
+		SDL_RenderCopy(gwRenderer, siBackground, NULL, NULL);
+		SDL_SetRenderTarget(gwRenderer, NULL);
+	}
+
+	if (options.perf_overlay) {
+		perf_overlay = new PerfOverlay(i8080::i8080_Clock::CYCLES_PER_SECOND);
+	}
+	// the game plays on without the counters if they can not be published
+	if (options.metrics) {
+		metrics = new MetricsExport();
+		if (!metrics->create() || (options.metrics_socket != nullptr && !metrics->serve(options.metrics_socket))) {
+			delete metrics;
+			metrics = NULL;
+		}
+	}
+
+	// map the rom set the asset cache opened at startup
+	if (!machine->loadRomSet(assets->getRomSet(romSetPath(options).c_str()))) {
+		return;
+	}
+	machine->use_recompiled = machine->use_recompiled && !options.interpreter;
+	machine->setTracing(options.trace);
+
+	// load the movie to play back
+	if (options.replay_path != nullptr && !movie.load(options.replay_path)) {
+		options.replay_path = nullptr;
+	}
+	if (options.record_video != nullptr) {
+		video = new SiVideo::Recorder();
+		if (!video->open(options.record_video)) {
+			delete video;
+			video = NULL;
+		}
+	}
+
+	// to setup the sound (the samples stay in the cache for the next game)
+	//Port 3: (discrete sounds)
+	//bit 0 = UFO(repeats)        SX0 0.raw
+	//bit 1 = Shot                 SX1 1.raw
+	//bit 2 = Flash(player die)   SX2 2.raw
+	//bit 3 = Invader die          SX3 3.raw
+	//Port 5 :
+	//bit 0-3 = Fleet movement 1-4 SX6-9 4-7.raw
+	//bit 4 = UFO Hit              SX10 8.raw
+	audio = new AudioEngine(i8080::i8080_Clock::CYCLES_PER_SECOND, SOUND_LATENCY, SOUND_DRIFT);
+	memset(sound_voices, -1, sizeof(sound_voices));
+	sound_voices[0][0] = audio->addVoice(assets->getSound("SpaceInvaders/sound/ufo_highpitch.wav"));
+	sound_voices[0][1] = audio->addVoice(assets->getSound("SpaceInvaders/sound/shoot.wav"));
+	sound_voices[0][2] = audio->addVoice(assets->getSound("SpaceInvaders/sound/explosion.wav"));
+	sound_voices[0][3] = audio->addVoice(assets->getSound("SpaceInvaders/sound/invaderkilled.wav"));
+	sound_voices[1][0] = audio->addVoice(assets->getSound("SpaceInvaders/sound/fastinvader1.wav"));
+	sound_voices[1][1] = audio->addVoice(assets->getSound("SpaceInvaders/sound/fastinvader2.wav"));
+	sound_voices[1][2] = audio->addVoice(assets->getSound("SpaceInvaders/sound/fastinvader3.wav"));
+	// there is no sample of the fourth march note, the march repeats the first
+	sound_voices[1][3] = audio->addVoice(assets->getSound("SpaceInvaders/sound/fastinvader1.wav"));
+	sound_ports[0] = 0;
+	sound_ports[1] = 0;
+	machine->capture_sound = true;
+	audio->open();
 
 	// enter the main game loop
 	mainLoop();
 
-	// when done clean up the bezel
-	SDL_FreeSurface(siBezel);
-
-	// clean up audio
-	Mix_FreeChunk(wav_ShotSoundEffect);
-	Mix_FreeChunk(wav_ExplosionSoundEffect);
-	Mix_FreeChunk(wav_FastInvader1SoundEffect);
-	Mix_FreeChunk(wav_FastInvader2SoundEffect);
-	Mix_FreeChunk(wav_FastInvader3SoundEffect);
-	Mix_FreeChunk(wav_FastInvader4SoundEffect);
-	Mix_FreeChunk(wav_InvaderKilledSoundEffect);
-	Mix_FreeChunk(wav_UFOHighPitchSoundEffect);
-	Mix_FreeChunk(wav_UFOLowPitchSoundEffect);
-	Mix_CloseAudio();
+	// stop the audio thread before the board goes away
+	machine->capture_sound = false;
+	delete audio;
+	audio = NULL;
 }
 
 /**
  * [DESCRIPTION] Construct a new Space Invaders:: Space Invaders object
  * 
 */
-SpaceInvaders::SpaceInvaders(SDL_Renderer* renderer, SDL_Joystick* gameController_1, SDL_Joystick* gameController_2)
+SpaceInvaders::SpaceInvaders(SDL_Renderer* renderer, SDL_Joystick* gameController_1, SDL_Joystick* gameController_2,
+							 const EmulatorOptions& p_options, AssetCache* p_assets)
 {
-	cpu = new i8080;
+	assets = p_assets;
+	machine = new SiMachine(*SiBoard::find(p_options.board));
+	cpu = machine->cpu;
+	options = p_options;
 	gwRenderer = renderer;
-	video_RAM = (unsigned int*)malloc(224 * 256 * 4);
-	memset(video_RAM, 1, 224 * 256 * 4);
+	siContainer = NULL;
+	siBackground = NULL;
+	siScreen = NULL;
 	mapActions();
 	gc_1 = gameController_1;
 	gc_2 = gameController_2;
+	joystick_motion = false;
+	input_event_micro = 0;
+	input_read_offset = UINT64_MAX;
+	paused = false;
+	turbo = false;
+	speed = 1.0;
+	audio = NULL;
+	run_ahead_micro = 0;
+	run_ahead_frames = 0;
+	perf_overlay = NULL;
+	metrics = NULL;
+	video = NULL;
+	draw_start_micro = 0;
+	audio_fill = -1;
+	audio_adjust_min = 0;
+	audio_adjust_max = 0;
 }
 
 /**
@@ -747,12 +998,27 @@ SpaceInvaders::SpaceInvaders(SDL_Renderer* renderer, SDL_Joystick* gameControlle
 */
 SpaceInvaders::~SpaceInvaders()
 {
-	free(video_RAM);
-	delete cpu;
+	delete machine;
+	delete act_left_p1;
+	delete act_right_p1;
+	delete act_fire_p1;
+	delete act_start_p1;
+	delete act_left_p2;
+	delete act_right_p2;
+	delete act_fire_p2;
+	delete act_start_p2;
+	delete act_tilt;
+	delete act_coin;
 	SDL_DestroyTexture(siContainer);
-	SDL_DestroyTexture(siBackground);
 	siContainer = NULL;
+	if (siScreen != NULL) {
+		SDL_DestroyTexture(siScreen);
+		siScreen = NULL;
+	}
 	siBackground = NULL;
+	delete perf_overlay;
+	delete metrics;
+	delete video;
 }
 
 /**
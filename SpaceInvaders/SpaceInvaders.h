@@ -9,8 +9,18 @@
 #pragma once
 #include "../i8080/i8080.h"
 #include "../Emulator/Emulator.h"
+#include "../Emulator/EmulatorOptions.h"
+#include "../Emulator/AssetCache.h"
+#include "../Emulator/AudioEngine.h"
+#include "../Emulator/ScreenFilter.h"
+#include "../Emulator/HostTimer.h"
+#include "../Emulator/MetricsExport.h"
+#include "../Emulator/PerfOverlay.h"
+#include "SiMachine.h"
+#include "SiMovie.h"
+#include "SiLatency.h"
+#include "SiVideo.h"
 #include <SDL.h>
-#include <SDL_mixer.h>
 #include <cmath>        // std::abs
 
 /**
@@ -43,39 +53,82 @@ private:
     Si_Action* act_tilt;
     Si_Action* act_coin;
 
-    Mix_Chunk* wav_ShotSoundEffect;
-    Mix_Chunk* wav_ExplosionSoundEffect;
-    Mix_Chunk* wav_FastInvader1SoundEffect;
-    Mix_Chunk* wav_FastInvader2SoundEffect;
-    Mix_Chunk* wav_FastInvader3SoundEffect;
-    Mix_Chunk* wav_FastInvader4SoundEffect;
-    Mix_Chunk* wav_InvaderKilledSoundEffect;
-    Mix_Chunk* wav_UFOHighPitchSoundEffect;
-    Mix_Chunk* wav_UFOLowPitchSoundEffect;
+    // SOUND =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // playback trails the emulation by a frame plus one audio buffer so every
+    // sound port write is known before its sample is mixed
+    static const uint64_t SOUND_LATENCY = SiMachine::INTERRUPT_INTERVAL + (uint64_t)AudioEngine::BUFFER_SAMPLES *
+        i8080::i8080_Clock::CYCLES_PER_SECOND / AudioEngine::SAMPLE_RATE;
+    static const uint64_t SOUND_DRIFT = 2 * SiMachine::INTERRUPT_INTERVAL;
+    // --audio-sync makes the sound card the master clock: the speed is moved
+    // up to AUDIO_SYNC_ADJUST off the user's speed to keep the emulated time
+    // queued ahead of the device at SOUND_LATENCY
+    static constexpr double AUDIO_SYNC_ADJUST = 0.005;
+    static constexpr double AUDIO_SYNC_SMOOTHING = 0.05;    // weight of a frame's reading (the device takes whole buffers)
+    AudioEngine* audio;                     // plays the sound effects
+    double audio_fill;                      // smoothed cycles queued ahead of the device (-1 = restart)
+    double audio_adjust_min;                // range of the speed changes made (for the report)
+    double audio_adjust_max;
+    void            updateAudioSync();  // steer the speed towards the sound card's clock
+    int sound_voices[2][8];                 // voice for each bit of port 3/port 5 (-1 if none)
+    uint8_t sound_ports[2];                 // last value written to port 3/port 5
 
-    const int       EM_WIDTH = 224;         // space invaders pixel width
-    const int       EM_HEIGHT = 256;        // space invaders pixel height
-    const SDL_Rect  fillRect = { 165,181,
-                    EM_WIDTH,EM_HEIGHT };   // defines the area for the emulator on top of the bezel
-    SDL_Texture* siContainer;               // VRAM container
+    static const int EM_WIDTH = 224;        // space invaders pixel width
+    static const int EM_HEIGHT = 256;       // space invaders pixel height
+    SDL_Rect        fillRect;               // defines the area for the emulator on top of the bezel
+    ScreenFilter    filter;                 // scaling/scanlines/overlay for the game screen
+    SDL_Texture* siContainer;               // VRAM container (streamed, written in place)
     SDL_Texture* siBackground;              // SI Bezel background
+    SDL_Texture* siScreen;                  // bezel with the game drawn on it (NULL if no render targets)
     SDL_Renderer* gwRenderer;               // game window to render to
     SDL_Joystick* gc_1;
     SDL_Joystick* gc_2;
+    bool joystick_motion;                   // true while a joystick axis is held
+    SiMachine* machine;                     // board the game runs on
     i8080* cpu;                             // cpu to run the game on
-    unsigned int* video_RAM;                // VRAM from space invaders
-    i8080::i8080_Registers::Register_16Bit shift_register;   // special i8080 hardware 
+    EmulatorOptions options;                // command line options
+    AssetCache* assets;                     // images/sounds shared with the emulator
+    SiMovie movie;                          // input movie being recorded or played back
+    SiVideo::Recorder* video;               // --record-video recorder (NULL if off)
+    bool paused;                            // P toggles, N runs a single frame while paused
+    bool turbo;                             // run unthrottled while TAB is held
+    double speed;                           // multiple of real time otherwise (0 = unthrottled)
+
+    // INPUT LATENCY =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // --late-input runs each frame up to just before the cycle the game read
+    // the input ports on in the frame before, waits until that cycle is due
+    // in real time and samples the input again
+    static const uint64_t LATE_INPUT_MARGIN = 64;   // cycles the split is ahead of the IN
+    SiLatency latency;                      // --latency measurement
+    uint64_t input_event_micro;             // host time of the first input event of the last poll (0 if none)
+    uint64_t input_read_offset;             // cycle in the frame the game first read the input ports on
+    void            sampleInput(bool& quit_flag);   // poll the input and start a latency measurement
+    void            recordInput();      // stamp the input ports into the movie being recorded
+    void            updatePacing();     // apply paused/turbo/speed to the cpu clock
+    bool            handlePacingKey(const SDL_KeyboardEvent& key); // pause/step/turbo/speed keys
     void            handleUserInput(bool& quit_flag); // handle the input from the user
-    void            loadRomFiles();     // load the rom files for the game
     void            mapActions();       // map the actions to the cpu ports
     void            loadScreenUpdate(); // load an update to the screen
+    void            presentScreen();    // compose the game texture on the bezel and present it
+    SiMachine::State run_ahead_state;       // the game's real state while a look ahead frame runs
+    uint64_t        run_ahead_micro;        // host time spent on --run-ahead (for the report)
+    uint64_t        run_ahead_frames;
+    void            presentRunAhead();  // show the screen --run-ahead frames ahead of the game
+    PerfOverlay*    perf_overlay;           // --perf-overlay panel (NULL if off)
+    MetricsExport*  metrics;                // --metrics segment (NULL if off)
+    uint64_t        draw_start_micro;       // host time the frame being presented started being drawn
     void            mainLoop();         // main game loop
-    void            prepareVRAM();      // prepare the VRAM for the space invaders screen
-    void            performShift();     // special i8080 hardware
+    void            prepareVRAM();      // write the VRAM into the game texture
+    template <typename PIXEL>
+    void            convertVRAM(uint8_t* pixels, int pitch, PIXEL on, PIXEL off);
+    template <typename PIXEL>
+    void            convertRow(const uint8_t* vram, int y, PIXEL* row, PIXEL on, PIXEL off);
     void            updateSound();      // function to play the sound effects
     void            displayInstructions();
 public:
     void            runGame();          // run the game
-    SpaceInvaders(SDL_Renderer* renderer, SDL_Joystick* gameController_1, SDL_Joystick* gameController_2);   // constructor
+    SpaceInvaders(SDL_Renderer* renderer, SDL_Joystick* gameController_1, SDL_Joystick* gameController_2,
+                  const EmulatorOptions& p_options, AssetCache* p_assets);   // constructor
+    static void     addAssets(AssetCache& assets, const EmulatorOptions& options);  // register the game's assets for loading
+    static std::string romSetPath(const EmulatorOptions& options);              // manifest of the board's ROM set
     ~SpaceInvaders();   // destructor           
 };
\ No newline at end of file
@@ -11,49 +11,56 @@
 #include "i8080.h"
 
 /**
- * [DESCRIPTION] Send an interrupt to the processor
+ * [DESCRIPTION] Raise the INT line with the RST vector the device puts on the
+ *               bus, the request stays latched until serviceInterrupt takes it
+ *               (a newer request replaces a latched one)
  * 
- * [PARAM] itr_num 
+ * [PARAM] rst_num - 0 to 7
 */
-void i8080::sendInterrupt(int itr_num)
+void i8080::requestInterrupt(uint8_t rst_num)
 {
-     // first check if interuppts are enabled, only act if they are
-    if (flags->INTE.get()) {
-
-        // break the Program Counter into two bytes so that it can be stored in memory
-        uint16_t uint16_InitialSP = registers->SP.get();
-        uint16_t uint16_InitialPC = registers->PC.get();
-        uint8_t uint8_PCAddrLow = 0x00;
-        uint8_t uint8_PCAddrHigh = 0x00;
-        uint8_PCAddrLow = uint8_PCAddrLow | uint16_InitialPC;
-        uint8_PCAddrHigh = uint8_PCAddrHigh | (uint16_InitialPC >> 8);
-
-        // push the Program Counter to memory where the Stack Pointer - 1 and Stack Pointer - 2 point
-        memory->set((uint16_InitialSP - 0x0001), uint8_PCAddrHigh);
-        memory->set((uint16_InitialSP - 0x0002), uint8_PCAddrLow);
-
-        // the Stack Pointer is updated
-        registers->SP.set(uint16_InitialSP - 0x0002);
-
-        // set the PC to the low memory vector.    
-        // this is identical to an "RST interrupt_num" instruction.
-        switch (itr_num)
-        {
-            case 0x00: registers->PC.set(0x0000); break;
-            case 0x01: registers->PC.set(0x0008); break;
-            case 0x02: registers->PC.set(0x0010); break;
-            case 0x03: registers->PC.set(0x0018); break;
-            case 0x04: registers->PC.set(0x0020); break;
-            case 0x05: registers->PC.set(0x0028); break;
-            case 0x06: registers->PC.set(0x0030); break;
-            case 0x07: registers->PC.set(0x0038); break;
-            default: break;
-        }
-        
-        // reset the int enable bit
-        flags->INTE.set(true);
+    interrupt_pending = true;
+    interrupt_rst = rst_num & 0x07;
+}
+
+/**
+ * [DESCRIPTION] Check if a latched request would be taken at this opcode boundary
+ * 
+ * [RETURN] false while INTE is clear or the opcode after an EI has not run yet
+*/
+bool i8080::canTakeInterrupt()
+{
+    // every opcode takes cycles, so the EI cycle is only current before the next one
+    return flags->INTE.get() && clock->getCurrentCCs() != flags->ei_cycle;
+}
+
+/**
+ * [DESCRIPTION] Take the latched request at an opcode boundary: INTE is
+ *               cleared and the RST on the bus is run (PC pushed, 11 cycles)
+ * 
+ * [RETURN] true if the request was taken, false if it stays latched
+*/
+bool i8080::serviceInterrupt()
+{
+    if (!interrupt_pending || !canTakeInterrupt()) {
+        return false;
     }
-};
+    interrupt_pending = false;
+    flags->INTE.set(false);
+    flags->halted = false;
+
+    // push the Program Counter to memory where the Stack Pointer - 1 and Stack Pointer - 2 point
+    uint16_t sp = registers->SP.get();
+    uint16_t pc = registers->PC.get();
+    memory->set((uint16_t)(sp - 0x0001), (uint8_t)(pc >> 8));
+    memory->set((uint16_t)(sp - 0x0002), (uint8_t)pc);
+    registers->SP.set((uint16_t)(sp - 0x0002));
+
+    // jump to the low memory vector, identical to an "RST interrupt_rst" instruction
+    registers->PC.set((uint16_t)(interrupt_rst * 0x0008));
+    clock->incClockCycles(11);
+    return true;
+}
 
 /**
  * [DESCRIPTION] Steps the CPU to the next opcode
@@ -65,6 +72,130 @@ void i8080::step()
     memory->opCode_Array[2] = memory->get(registers->PC.get() + 0x0002);
 }
 
+/**
+ * [DESCRIPTION] Work out which data bytes the opcode in opCode_Array is about
+ *               to read (the fetch itself is not counted), used by watchpoints
+ *               to catch reads without a check in i8080_Memory::get
+ *
+ * [PARAM] addresses - room for 2 addresses
+ * [RETURN] int (number of addresses filled in)
+*/
+int i8080::getDataReads(uint16_t* addresses)
+{
+    uint8_t op = memory->opCode_Array[0];
+    uint16_t sp = registers->SP.get();
+
+    // MOV r,M / ALU M / INR M / DCR M read the byte HL points to
+    if ((op >= 0x40 && op < 0x80 && (op & 0x07) == 0x06 && op != 0x76) ||
+        (op >= 0x80 && op < 0xC0 && (op & 0x07) == 0x06) || op == 0x34 || op == 0x35) {
+        addresses[0] = registers->get_HL();
+        return 1;
+    }
+
+    bool ret_taken = false;
+    switch (op) {
+    case 0x0A: addresses[0] = registers->get_BC(); return 1;    // LDAX B
+    case 0x1A: addresses[0] = registers->get_DE(); return 1;    // LDAX D
+    case 0x3A: addresses[0] = memory->get_Adr(); return 1;      // LDA
+    case 0x2A:                                                  // LHLD
+        addresses[0] = memory->get_Adr();
+        addresses[1] = memory->get_Adr() + 1;
+        return 2;
+    case 0xC1: case 0xD1: case 0xE1: case 0xF1:                 // POP
+    case 0xC9: case 0xD9: case 0xE3:                            // RET / XTHL
+        ret_taken = true;
+        break;
+    case 0xC0: ret_taken = !flags->Z.get(); break;              // RNZ
+    case 0xC8: ret_taken = flags->Z.get(); break;               // RZ
+    case 0xD0: ret_taken = !flags->C.get(); break;              // RNC
+    case 0xD8: ret_taken = flags->C.get(); break;               // RC
+    case 0xE0: ret_taken = !flags->P.get(); break;              // RPO
+    case 0xE8: ret_taken = flags->P.get(); break;               // RPE
+    case 0xF0: ret_taken = !flags->S.get(); break;              // RP
+    case 0xF8: ret_taken = flags->S.get(); break;               // RM
+    default: break;
+    }
+    if (ret_taken) {
+        addresses[0] = sp;
+        addresses[1] = sp + 1;
+        return 2;
+    }
+    return 0;
+}
+
+/**
+ * [DESCRIPTION] Work out which data bytes the opcode in opCode_Array is about
+ *               to write, the counterpart of getDataReads for the board's
+ *               instrumentation (the pushes of an interrupt are not counted)
+ *
+ * [PARAM] addresses - room for 2 addresses
+ * [RETURN] int (number of addresses filled in)
+*/
+int i8080::getDataWrites(uint16_t* addresses)
+{
+    uint8_t op = memory->opCode_Array[0];
+    uint16_t sp = registers->SP.get();
+
+    // MOV M,r / MVI M / INR M / DCR M write the byte HL points to
+    if ((op >= 0x70 && op < 0x78 && op != 0x76) || op == 0x36 || op == 0x34 || op == 0x35) {
+        addresses[0] = registers->get_HL();
+        return 1;
+    }
+
+    bool call_taken = false;
+    switch (op) {
+    case 0x02: addresses[0] = registers->get_BC(); return 1;    // STAX B
+    case 0x12: addresses[0] = registers->get_DE(); return 1;    // STAX D
+    case 0x32: addresses[0] = memory->get_Adr(); return 1;      // STA
+    case 0x22:                                                  // SHLD
+        addresses[0] = memory->get_Adr();
+        addresses[1] = memory->get_Adr() + 1;
+        return 2;
+    case 0xE3:                                                  // XTHL
+        addresses[0] = sp;
+        addresses[1] = sp + 1;
+        return 2;
+    case 0xC5: case 0xD5: case 0xE5: case 0xF5:                 // PUSH
+    case 0xCD:                                                  // CALL
+    case 0xC7: case 0xCF: case 0xD7: case 0xDF:                 // RST
+    case 0xE7: case 0xEF: case 0xF7: case 0xFF:
+        call_taken = true;
+        break;
+    case 0xC4: call_taken = !flags->Z.get(); break;             // CNZ
+    case 0xCC: call_taken = flags->Z.get(); break;              // CZ
+    case 0xD4: call_taken = !flags->C.get(); break;             // CNC
+    case 0xDC: call_taken = flags->C.get(); break;              // CC
+    case 0xE4: call_taken = !flags->P.get(); break;             // CPO
+    case 0xEC: call_taken = flags->P.get(); break;              // CPE
+    case 0xF4: call_taken = !flags->S.get(); break;             // CP
+    case 0xFC: call_taken = flags->S.get(); break;              // CM
+    default: break;
+    }
+    if (call_taken) {
+        addresses[0] = sp - 1;
+        addresses[1] = sp - 2;
+        return 2;
+    }
+    return 0;
+}
+
+/**
+ * [DESCRIPTION] Put the registers, flags, clock and IO back into their power
+ *               on state, memory is left alone and every component keeps its
+ *               address so pointers into the cpu stay valid
+ *
+*/
+void i8080::reset()
+{
+    *registers  = i8080_Registers();
+    *flags      = i8080_Flags(registers);
+    *clock      = i8080_Clock();
+    *io         = i8080_IO();
+    memory->opCode_Array = { 0 };
+    interrupt_pending = false;
+    interrupt_rst = 0;
+}
+
 /**
  * [DESCRIPTION] Construct a new i8080::i8080 object by pointing the
  *               child components to this object (only if they need access)
@@ -78,6 +209,8 @@ i8080::i8080()
     clock       = new i8080_Clock;
     io          = new i8080_IO;
     execute     = new i8080_OpCodes(registers, memory, flags, clock, io);
+    interrupt_pending = false;
+    interrupt_rst = 0;
 }
 
 /**
@@ -92,6 +225,5 @@ i8080::~i8080()
     delete clock;
     delete io;
     delete execute;
-    free(memory);
 }
 
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <chrono>
 #include <array>
+#include <utility>
+#include <vector>
 
 /**
  * [DESCRIPTION] Class representing an i8080 processor and 
@@ -35,8 +37,20 @@ public:
     i8080_Clock     *clock;
     i8080_IO        *io;
     i8080_OpCodes   *execute;
-    void            sendInterrupt(int itr_num);
     void            step();                                // step the PC to the next cycle
+    void            reset();                               // power on state (memory is kept)
+    int             getDataReads(uint16_t* addresses);     // bytes the fetched opcode will read
+    int             getDataWrites(uint16_t* addresses);    // bytes the fetched opcode will write
+
+    // INTERRUPT UNIT =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    /* a device raising INT is latched until the cpu takes it at an opcode
+        boundary: INTE has to be set and the opcode after an EI has to have
+        run, taking it clears INTE and runs the RST the device put on the bus */
+    bool            interrupt_pending;                     // a request is latched
+    uint8_t         interrupt_rst;                         // RST number of the latched request
+    void            requestInterrupt(uint8_t rst_num);     // raise INT (a newer request replaces the latched one)
+    bool            serviceInterrupt();                    // take the latched request if INTE allows it
+    bool            canTakeInterrupt();                    // INTE is set and no EI delay is running
 
     // CONSTRUCTOR/DECONSTRUCTOR
     i8080();
@@ -47,20 +61,45 @@ public:
      * [DESCRIPTION] Represents a clock in an i8080 processor
      *      - i8080 runs at 2Mhz which means it processes 2 clock cycles every micro 
      *        second 
-     *      - This class faclilitates the synchronization of that timing and the 
-     *        system clock 
+     *      - The emulated time is a 64 bit count of the cycles that have been run,
+     *        the host clock is only read by the pacing check (once per frame)
+     *      - The pacing decides when the next frame may run: in step with real
+     *        time, N times faster/slower, as fast as the host allows, or only when
+     *        a single step is requested while paused
     */
     class i8080_Clock {
+    public:
+        enum Pacing {
+            PACING_REAL_TIME,               // 2 clock cycles every micro second
+            PACING_SCALED,                  // real time multiplied by the speed
+            PACING_UNTHROTTLED,             // every frame is due straight away
+            PACING_PAUSED                   // frames only run when stepped
+        };
+        static const uint64_t CYCLES_PER_SECOND = 2000000;
     private:
-        /* values below are uint64_t becuase they will be 
-            holding microseconds (prevents overflow) */
-        uint64_t    timer;                  // timer in microseconds since last reset
+        /* a host that falls further behind than this stops trying to catch
+            up (a stall would otherwise be followed by a burst of frames) */
+        static const uint64_t MAX_LAG_FRAMES = 4;
+
         uint64_t    cycles;                 // total clock cycles that have been run
+        Pacing      pacing;                 // how the emulated time follows the host
+        double      speed;                  // multiple of real time for PACING_SCALED
+        uint64_t    sync_micro;             // host time the pacing was last synced
+        uint64_t    sync_cycles;            // clock cycles at sync_micro
+        bool        step_requested;         // run one frame while paused
+        void        resync();               // restart the pacing from the current time
     public:   
-        int         getCyclesToRun();       // get the clock cycles to run 
+        static uint64_t nowMicro();         // host time in micro seconds (steady clock)
+        uint64_t    getCyclesToRun(uint64_t frame_cycles);  // cycles to run now (0 or a frame)
+        uint64_t    getNextDueMicro();      // host time the next frame is due at
         void        incClockCycles(int cyc);// increment the cycles by passed value
-        void        resetClockTimer();      // reset the timer
         uint64_t    getCurrentCCs();        // return the current clock cycles
+        void        setCurrentCCs(uint64_t p_cycles);   // put the clock back on a saved cycle
+        void        setPacing(Pacing mode, double p_speed = 1.0);
+        void        adjustSpeed(double p_speed);    // change the speed without restarting the pacing
+        Pacing      getPacing();
+        double      getSpeed();             // current multiple of real time (0 = unthrottled)
+        void        requestStep();          // let one frame run while paused
         i8080_Clock();                      // constructor
     };
     // CLOCK CLASS END =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -152,6 +191,8 @@ public:
         Flag C;     // Carry - Set to 1 when a carry out or borrow was used in the carry bit
         Flag AC;    // Auxillary Carry - Carry Out Bit, but for Bit 3 of the instruction result
         Flag INTE;  // Interrupt flag
+        uint64_t ei_cycle;  // clock cycle the last EI finished on, interrupts wait one more opcode (UINT64_MAX if none)
+        bool halted;        // a HLT ran, nothing is fetched until an interrupt is taken
 
         // SET/CHECK FLAG FUNCTIONS
         void set_S();
@@ -227,8 +268,39 @@ public:
      * 
     */
     class i8080_Memory {
-        uint8_t*    memory;                             // array representing RAM
+    public:
+        static const int        PAGE_SHIFT = 10;                    // 1KB pages
+        static const uint32_t   PAGE_SIZE = 1 << PAGE_SHIFT;
+        static const int        NUM_PAGES = 0x10000 >> PAGE_SHIFT;
+
+        // WATCHPOINTS =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        static const uint8_t    WATCH_READ = 1;
+        static const uint8_t    WATCH_WRITE = 2;
+        static const uint8_t    WATCH_EXECUTE = 4;
+        // a range of addresses to stop on, optionally only when a given byte is read/written
+        struct Watchpoint {
+            uint16_t    first;
+            uint16_t    last;                           // inclusive
+            uint8_t     kinds;                          // WATCH_* bits
+            int         value;                          // byte to match, -1 = any
+        };
+        // the access that matched a watchpoint
+        struct WatchHit {
+            uint8_t     kind;                           // a single WATCH_* bit
+            uint16_t    address;
+            uint8_t     value;                          // byte read/written (the opcode for execute)
+        };
+    private:
+        uint8_t*    memory;                             // array representing RAM (owned by this cpu)
+        const uint8_t* read_pages[NUM_PAGES];           // where every page is read from
+        uint8_t*    write_pages[NUM_PAGES];             // where every page is written to (NULL = slow path)
+        uint8_t     watch_pages[NUM_PAGES];             // WATCH_* bits armed on every page
+        std::vector<Watchpoint> watchpoints;
+        bool        watch_hit;                          // a watchpoint matched since the last takeWatchHit
+        WatchHit    last_hit;
         i8080_Registers* registers;                     // give the flags access to registers
+        void        unsharePage(int page);              // copy a shared page into memory before a write
+        void        setSlow(uint16_t index, uint8_t val);   // write to a shared or write watched page
     public:
         std::array<uint8_t, 3> opCode_Array;            // array of surrent opcodes
         uint8_t     get(uint16_t index);                // get memory
@@ -236,8 +308,17 @@ public:
         uint16_t    get_Adr();                          // get ADR location from memory                    
         uint8_t     get_M();                            // get M location from memory
         void        set_M(uint8_t val);                 // set M location from memory
-        void        loadRom(const char* fileName, size_t address);  // load ROM into mem
+        bool        loadRom(const char* fileName, size_t address);  // load ROM into mem
+        void        mapRom(uint16_t address, const uint8_t* data, size_t size); // map shared read only ROM
+        bool        isShared(uint16_t index);           // true if the page is still shared ROM
+        void        addWatchpoint(const Watchpoint& watchpoint);    // arm a watchpoint
+        void        clearWatchpoints();                 // disarm every watchpoint
+        bool        hasWatchpoints();                   // true if any watchpoint is armed
+        bool        isWatched(uint16_t index, uint8_t kind);    // page check before checkWatch
+        bool        checkWatch(uint8_t kind, uint16_t index, uint8_t val);  // latch a hit if one matches
+        bool        takeWatchHit(WatchHit& hit);        // return and clear the latched hit
         i8080_Memory(i8080_Registers* parent_registers);
+        ~i8080_Memory();
         void*       returnPtrToMem(int index);          // return a pointer to a specfic memory index
     };
     // MEMORY CLASS END =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -245,7 +326,9 @@ public:
     // OPCODE CLASS START =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     /**
      * [DESCRIPTION] Class which represents the instruction set of an i8080
-     * 
+     *      - Every opcode runs exec<OP>, generated from the opcode's row of
+     *        i8080_OpSpec (length, cycles, family), the families are templates
+     *        on the register/pair/condition indices encoded in the opcode
     */
     class i8080_OpCodes {
     private:
@@ -255,282 +338,29 @@ public:
         i8080_Clock     *clock;                         // give the opcodes access to the clock
         i8080_IO        *io;                            // give the opcodes access to the io
 
-        // GENERAL FUNCTION PROTOTYPES
-        void func_LXI_Registers(i8080_Registers::Register_8Bit& reg_Source1, i8080_Registers::Register_8Bit& reg_Source2);
-        void func_INR_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_DCR_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_MOV_Registers(i8080_Registers::Register_8Bit& reg_Destination, i8080_Registers::Register_8Bit& reg_Source);
-        void func_MVI_Registers(i8080_Registers::Register_8Bit& reg_Destination, uint8_t uint8_Source);
-        void func_ADD_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_ADC_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_SUB_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_SBB_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_CMP_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_PUSH_Registers(i8080_Registers::Register_8Bit& reg_Source1, i8080_Registers::Register_8Bit& reg_Source2);
-        void func_INX_Registers(i8080_Registers::Register_8Bit& reg_Source1, i8080_Registers::Register_8Bit& reg_Source2);
-        void func_ANA_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_XRA_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_ORA_Registers(i8080_Registers::Register_8Bit& reg_Source);
-        void func_General_RET();
-        void func_General_CALL();
+        typedef void (i8080_OpCodes::*Handler)();
+        static const std::array<Handler, 256> handlers; // exec<OP> of every opcode
+        template <size_t... OP>
+        static constexpr std::array<Handler, 256> buildHandlers(std::index_sequence<OP...>);
+        template <int OP> void exec();                  // one opcode, built from its i8080_OpSpec row
+
+        // OPERANDS (indices as the opcodes encode them)
+        i8080_Registers::Register_8Bit& getRegister(int reg);   // B C D E H L - A (not M)
+        template <int REG> uint8_t  getOperand();       // register or M, 8 is the immediate byte
+        template <int REG> void     setOperand(uint8_t val);    // register or M
+        uint16_t    getPair(int rp);                    // BC DE HL SP
+        void        setPair(int rp, uint16_t val);
+        bool        checkCondition(int cc);             // NZ Z NC C PO PE P M
 
-        // OP CODE PROTOTYPES
-        void  func_NOP();
-        void  func_LXI_B_D16();
-        void  func_STAX_B();
-        void  func_INX_B();
-        void  func_INR_B();
-        void  func_DCR_B();
-        void  func_MVI_B_D8();
-        void  func_RLC();
-        // *NOP 0x08 NOT IMPLEMENTED
-        void  func_DAD_B();
-        void  func_LDAX_B();
-        void  func_DCX_B();
-        void  func_INR_C();
-        void  func_DCR_C();
-        void  func_MVI_C_D8();
-        void  func_RRC();
-        // *NOP 0x10 NOT IMPLEMENTED
-        void  func_LXI_D_D16();
-        void  func_STAX_D();
-        void  func_INX_D();
-        void  func_INR_D();
-        void  func_DCR_D();
-        void  func_MVI_D_D8();
-        void  func_RAL();
-        // *NOP 0x18 NOT IMPLEMENTED
-        void  func_DAD_D();
-        void  func_LDAX_D();
-        void  func_DCX_D();
-        void  func_INR_E();
-        void  func_DCR_E();
-        void  func_MVI_E_D8();
-        void  func_RAR();
-        // *NOP 0x20 NOT IMPLEMENTED
-        void  func_LXI_H_D16();
-        void  func_SHLD_ADR();
-        void  func_INX_H();
-        void  func_INR_H();
-        void  func_DCR_H();
-        void  func_MVI_H_D8();
-        void  func_DAA();
-        // *NOP 0x28 NOT IMPLEMENTED
-        void  func_DAD_H();
-        void  func_LHLD_ADR();
-        void  func_DCX_H();
-        void  func_INR_L();
-        void  func_DCR_L();
-        void  func_MVI_L_D8();
-        void  func_CMA();
-        //void  func_SIM();
-        void  func_LXI_SP_D16();
-        void  func_STA_ADR();
-        void  func_INX_SP();
-        void  func_INR_M();
-        void  func_DCR_M();
-        void  func_MVI_M_D8();
-        void  func_STC();
-        // *NOP 0x38 NOT IMPLEMENTED
-        void  func_DAD_SP();
-        void  func_LDA_ADR();
-        void  func_DCX_SP();
-        void  func_INR_A();
-        void  func_DCR_A();
-        void  func_MVI_A_D8();
-        void  func_CMC();
-        void  func_MOV_B_B();
-        void  func_MOV_B_C();
-        void  func_MOV_B_D();
-        void  func_MOV_B_E();
-        void  func_MOV_B_H();
-        void  func_MOV_B_L();
-        void  func_MOV_B_M();
-        void  func_MOV_B_A();
-        void  func_MOV_C_B();
-        void  func_MOV_C_C();
-        void  func_MOV_C_D();
-        void  func_MOV_C_E();
-        void  func_MOV_C_H();
-        void  func_MOV_C_L();
-        void  func_MOV_C_M();
-        void  func_MOV_C_A();
-        void  func_MOV_D_B();
-        void  func_MOV_D_C();
-        void  func_MOV_D_D();
-        void  func_MOV_D_E();
-        void  func_MOV_D_H();
-        void  func_MOV_D_L();
-        void  func_MOV_D_M();
-        void  func_MOV_D_A();
-        void  func_MOV_E_B();
-        void  func_MOV_E_C();
-        void  func_MOV_E_D();
-        void  func_MOV_E_E();
-        void  func_MOV_E_H();
-        void  func_MOV_E_L();
-        void  func_MOV_E_M();
-        void  func_MOV_E_A();
-        void  func_MOV_H_B();
-        void  func_MOV_H_C();
-        void  func_MOV_H_D();
-        void  func_MOV_H_E();
-        void  func_MOV_H_H();
-        void  func_MOV_H_L();
-        void  func_MOV_H_M();
-        void  func_MOV_H_A();
-        void  func_MOV_L_B();
-        void  func_MOV_L_C();
-        void  func_MOV_L_D();
-        void  func_MOV_L_E();
-        void  func_MOV_L_H();
-        void  func_MOV_L_L();
-        void  func_MOV_L_M();
-        void  func_MOV_L_A();
-        void  func_MOV_M_B();
-        void  func_MOV_M_C();
-        void  func_MOV_M_D();
-        void  func_MOV_M_E();
-        void  func_MOV_M_H();
-        void  func_MOV_M_L();
-        void  func_HLT();
-        void  func_MOV_M_A();
-        void  func_MOV_A_B();
-        void  func_MOV_A_C();
-        void  func_MOV_A_D();
-        void  func_MOV_A_E();
-        void  func_MOV_A_H();
-        void  func_MOV_A_L();
-        void  func_MOV_A_M();
-        void  func_MOV_A_A();
-        void  func_ADD_B();
-        void  func_ADD_C();
-        void  func_ADD_D();
-        void  func_ADD_E();
-        void  func_ADD_H();
-        void  func_ADD_L();
-        void  func_ADD_M();
-        void  func_ADD_A();
-        void  func_ADC_B();
-        void  func_ADC_C();
-        void  func_ADC_D();
-        void  func_ADC_E();
-        void  func_ADC_H();
-        void  func_ADC_L();
-        void  func_ADC_M();
-        void  func_ADC_A();
-        void  func_SUB_B();
-        void  func_SUB_C();
-        void  func_SUB_D();
-        void  func_SUB_E();
-        void  func_SUB_H();
-        void  func_SUB_L();
-        void  func_SUB_M();
-        void  func_SUB_A();
-        void  func_SBB_B();
-        void  func_SBB_C();
-        void  func_SBB_D();
-        void  func_SBB_E();
-        void  func_SBB_H();
-        void  func_SBB_L();
-        void  func_SBB_M();
-        void  func_SBB_A();
-        void  func_ANA_B();
-        void  func_ANA_C();
-        void  func_ANA_D();
-        void  func_ANA_E();
-        void  func_ANA_H();
-        void  func_ANA_L();
-        void  func_ANA_M();
-        void  func_ANA_A();
-        void  func_XRA_B();
-        void  func_XRA_C();
-        void  func_XRA_D();
-        void  func_XRA_E();
-        void  func_XRA_H();
-        void  func_XRA_L();
-        void  func_XRA_M();
-        void  func_XRA_A();
-        void  func_ORA_B();
-        void  func_ORA_C();
-        void  func_ORA_D();
-        void  func_ORA_E();
-        void  func_ORA_H();
-        void  func_ORA_L();
-        void  func_ORA_M();
-        void  func_ORA_A();
-        void  func_CMP_B();
-        void  func_CMP_C();
-        void  func_CMP_D();
-        void  func_CMP_E();
-        void  func_CMP_H();
-        void  func_CMP_L();
-        void  func_CMP_M();
-        void  func_CMP_A();
-        void  func_RNZ();
-        void  func_POP_B();
-        void  func_JNZ_ADR();
-        void  func_JMP_ADR();
-        void  func_CNZ_ADR();
-        void  func_PUSH_B();
-        void  func_ADI_D8();
-        void  func_RST_0();
-        void  func_RZ();
-        void  func_RET();
-        void  func_JZ_ADR();
-        // *JMP a16 0xcb NOT IMPLEMENTED
-        void  func_CZ_ADR();
-        void  func_CALL_ADR();
-        void  func_ACI_D8();
-        void  func_RST_1();
-        void  func_RNC();
-        void  func_POP_D();
-        void  func_JNC_ADR();
-        void  func_OUT_D8();
-        void  func_CNC_ADR();
-        void  func_PUSH_D();
-        void  func_SUI_D8();
-        void  func_RST_2();
-        void  func_RC();
-        // *RET 0xd9 NOT IMPLEMENTED
-        void  func_JC_ADR();
-        void  func_IN_D8();
-        void  func_CC_ADR();
-        // *CALL a16 0xdd NOT IMPLEMENTED
-        void  func_SBI_D8();
-        void  func_RST_3();
-        void  func_RPO();
-        void  func_POP_H();
-        void  func_JPO_ADR();
-        void  func_XTHL();
-        void  func_CPO_ADR();
-        void  func_PUSH_H();
-        void  func_ANI_D8();
-        void  func_RST_4();
-        void  func_RPE();
-        void  func_PCHL();
-        void  func_JPE_ADR();
-        void  func_XCHG();
-        void  func_CPE_ADR();
-        // *CALL a16 0xed NOT IMPLEMENTED
-        void  func_XRI_D8();
-        void  func_RST_5();
-        void  func_RP();
-        void  func_POP_PSW();
-        void  func_JP_ADR();
-        void  func_DI();
-        void  func_CP_ADR();
-        void  func_PUSH_PSW();
-        void  func_ORI_D8();
-        void  func_RST_6();
-        void  func_RM();
-        void  func_SPHL();
-        void  func_JM_ADR();
-        void  func_EI();
-        void  func_CM_ADR();
-        // *CALL a16 0xfd NOT IMPLEMENTED
-        void  func_CPI_D8();
-        void  func_RST_7();
+        // FAMILIES (return true when the opcode takes its alternative cycle count)
+        template <int DST> bool opINR();
+        template <int DST> bool opDCR();
+        template <int KIND, int SRC> bool opALU();      // ADD ADC SUB SBB ANA XRA ORA CMP
+        void        opDAA();
+        void        opPOP(int rp);                      // PSW for 3
+        void        opPUSH(int rp);
+        void        pushPC();
+        void        popPC();
     public:
         void runOpCode();
         i8080_OpCodes(i8080_Registers* parent_register, i8080_Memory* parent_memory,  i8080_Flags* parent_flags, i8080_Clock* parent_clock, i8080_IO* parent_IO);
@@ -8,33 +8,102 @@
 #include "i8080.h"
 
 /**
- * [DESCRIPTION] Since the i8080 runs at 2Mhz we need to periodically calculate 
- * 				 how many clock cycles we need to run since the last time we ran 
- * 				 opcodes (2 clock cycles per micro second passed)
- * 
- * [RETURN] int (clock cycles that need to be run according to the timer)
+ * [DESCRIPTION] Return the host time in micro seconds
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t i8080::i8080_Clock::nowMicro()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>
+		(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * [DESCRIPTION] Restart the pacing so the current clock cycles line up with the
+ * 				 current host time
+ *
+*/
+void i8080::i8080_Clock::resync()
+{
+	sync_micro = nowMicro();
+	sync_cycles = cycles;
+}
+
+/**
+ * [DESCRIPTION] Since the i8080 runs at 2Mhz we need to periodically calculate
+ * 				 how many clock cycles we need to run, this is asked once per frame
+ * 		- Real time/scaled: the frame is run once the host time has reached the
+ * 		  emulated time the frame starts at (2 clock cycles per micro second,
+ * 		  times the speed)
+ * 		- Unthrottled: every frame is due straight away
+ * 		- Paused: a frame is only due after requestStep()
+ *
+ * [PARAM] frame_cycles - clock cycles in one frame
+ * [RETURN] uint64_t (frame_cycles if the frame is due, 0 if not)
 */
-int i8080::i8080_Clock::getCyclesToRun()
+uint64_t i8080::i8080_Clock::getCyclesToRun(uint64_t frame_cycles)
 {
-	// on the first call (when the timer is 0) just start the timer
-    if (timer == 0) {
-        resetClockTimer();
-        return 0;
-    }
-    
-    // on all subsequesnt calls see how much time has passed on the timer and calculate
-    // how many clock cycles need to be executed
-    uint64_t now_micro = std::chrono::duration_cast<std::chrono::microseconds>
-		(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
-
-    // number of clock cycles = (time in micro seconds) * 2
-    return (now_micro - timer) * 2;
+	switch (pacing) {
+	case PACING_UNTHROTTLED:
+		return frame_cycles;
+	case PACING_PAUSED:
+		if (step_requested) {
+			step_requested = false;
+			return frame_cycles;
+		}
+		return 0;
+	default:
+		break;
+	}
+
+	// the clock cycles the host time says we should be at
+	double rate = (pacing == PACING_SCALED) ? speed : 1.0;
+	uint64_t elapsed_micro = nowMicro() - sync_micro;
+	uint64_t due_cycles = sync_cycles + (uint64_t)(elapsed_micro * (CYCLES_PER_SECOND / 1000000) * rate);
+
+	if (due_cycles < cycles) {
+		return 0;
+	}
+
+	// the host fell behind (window dragged, debugger break...) so drop the lag
+	if (due_cycles - cycles > MAX_LAG_FRAMES * frame_cycles) {
+		resync();
+	}
+	return frame_cycles;
+}
+
+/**
+ * [DESCRIPTION] Return the host time (nowMicro) the next frame is due at, so
+ * 				 the caller can sleep until then instead of asking again
+ * 		- Unthrottled: now
+ * 		- Paused: now if a step was requested, otherwise never (UINT64_MAX)
+ *
+ * [RETURN] uint64_t
+*/
+uint64_t i8080::i8080_Clock::getNextDueMicro()
+{
+	switch (pacing) {
+	case PACING_UNTHROTTLED:
+		return nowMicro();
+	case PACING_PAUSED:
+		return step_requested ? nowMicro() : UINT64_MAX;
+	default:
+		break;
+	}
+
+	// the frame is due once the host time catches up with the current cycles
+	// (rounded up a micro second so the frame is due when woken)
+	double rate = (pacing == PACING_SCALED) ? speed : 1.0;
+	if (cycles <= sync_cycles) {
+		return sync_micro;
+	}
+	return sync_micro + (uint64_t)((cycles - sync_cycles) / ((CYCLES_PER_SECOND / 1000000) * rate)) + 1;
 }
 
 /**
  * [DESCRIPTION] Increment the clock cycles based on the opcode that was just run
- * 		- This is called from the individual opcodes 
- * [PARAM] cyc 
+ * 		- This is called from the individual opcodes
+ * [PARAM] cyc
 */
 void i8080::i8080_Clock::i8080_Clock::incClockCycles(int cyc)
 {
@@ -42,22 +111,97 @@ void i8080::i8080_Clock::i8080_Clock::incClockCycles(int cyc)
 }
 
 /**
- * [DESCRIPTION] Construct a new i8080 Clock::i8080 Clock object
- * 
+ * [DESCRIPTION] Change how the emulated time follows the host time, the pacing
+ * 				 restarts from now so there is no burst after a pause
+ *
+ * [PARAM] mode
+ * [PARAM] p_speed - multiple of real time for PACING_SCALED
 */
-i8080::i8080_Clock::i8080_Clock() {
-	timer 	= 0;
-	cycles 	= 0;
+void i8080::i8080_Clock::setPacing(Pacing mode, double p_speed)
+{
+	pacing = mode;
+	speed = p_speed > 0 ? p_speed : 1.0;
+	step_requested = false;
+	resync();
+}
+
+/**
+ * [DESCRIPTION] Put the clock back on a cycle it was on before (loading a save
+ * 				 state), the pacing is left alone
+ *
+ * [PARAM] p_cycles
+*/
+void i8080::i8080_Clock::setCurrentCCs(uint64_t p_cycles)
+{
+	cycles = p_cycles;
+}
+
+/**
+ * [DESCRIPTION] Change the speed of real time/scaled pacing in place, the
+ * 				 cycles already due stay due (setPacing restarts from now and
+ * 				 would drop the lead of a frame run early), used to steer the
+ * 				 emulation a fraction of a percent at a time
+ *
+ * [PARAM] p_speed - multiple of real time
+*/
+void i8080::i8080_Clock::adjustSpeed(double p_speed)
+{
+	if ((pacing != PACING_REAL_TIME && pacing != PACING_SCALED) || p_speed <= 0) {
+		return;
+	}
+	double rate = (pacing == PACING_SCALED) ? speed : 1.0;
+	uint64_t now = nowMicro();
+	sync_cycles += (uint64_t)((now - sync_micro) * (CYCLES_PER_SECOND / 1000000) * rate);
+	sync_micro = now;
+	pacing = PACING_SCALED;
+	speed = p_speed;
+}
+
+/**
+ * [DESCRIPTION] Return the current pacing mode
+ *
+*/
+i8080::i8080_Clock::Pacing i8080::i8080_Clock::getPacing()
+{
+	return pacing;
 }
 
 /**
- * [DESCRIPTION] Reset the clock timer to the current tim ein microseconds
- * 
+ * [DESCRIPTION] Return the current multiple of real time (0 when unthrottled
+ * 				 or paused)
+ *
 */
-void i8080::i8080_Clock::resetClockTimer()
+double i8080::i8080_Clock::getSpeed()
 {
-	timer = std::chrono::duration_cast<std::chrono::microseconds>
-	(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+	switch (pacing) {
+	case PACING_REAL_TIME:
+		return 1.0;
+	case PACING_SCALED:
+		return speed;
+	default:
+		return 0.0;
+	}
+}
+
+/**
+ * [DESCRIPTION] Let a single frame run while paused
+ *
+*/
+void i8080::i8080_Clock::requestStep()
+{
+	step_requested = true;
+}
+
+/**
+ * [DESCRIPTION] Construct a new i8080 Clock::i8080 Clock object
+ *
+*/
+i8080::i8080_Clock::i8080_Clock() {
+	cycles 	= 0;
+	pacing 	= PACING_REAL_TIME;
+	speed 	= 1.0;
+	step_requested = false;
+	resync();
 }
 
 /**
@@ -68,4 +212,3 @@ uint64_t i8080::i8080_Clock::getCurrentCCs()
 {
     return cycles;
 }
-
@@ -44,6 +44,8 @@ i8080::i8080_Flags::i8080_Flags(i8080_Registers* parent_registers)
     C.set(true);
     AC.set(false);
     INTE.set(false);
+    ei_cycle = UINT64_MAX;
+    halted = false;
 
 	/* Point to the parents registers */
 	registers = parent_registers;
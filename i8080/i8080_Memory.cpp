@@ -6,6 +6,9 @@
 */
 
 #include "i8080.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 /**
  * [DESCRIPTION] Returns the memory value at the passed index
@@ -15,7 +18,7 @@
 */
 uint8_t i8080::i8080_Memory::get(uint16_t index)
 {
-	return memory[index];
+	return read_pages[index >> PAGE_SHIFT][index & (PAGE_SIZE - 1)];
 }
 
 /**
@@ -26,9 +29,199 @@ uint8_t i8080::i8080_Memory::get(uint16_t index)
 */
 void i8080::i8080_Memory::set(uint16_t index, uint8_t val)
 {
+	uint8_t* page = write_pages[index >> PAGE_SHIFT];
+	if (page == NULL) {
+		setSlow(index, val);
+		return;
+	}
+	page[index & (PAGE_SIZE - 1)] = val;
+}
+
+/**
+ * [DESCRIPTION] Write to a page without a write pointer, it is either still
+ * 				 shared ROM or has a write watchpoint armed on it
+ *
+ * [PARAM] index
+ * [PARAM] val
+*/
+void i8080::i8080_Memory::setSlow(uint16_t index, uint8_t val)
+{
+	int page = index >> PAGE_SHIFT;
+	if (watch_pages[page] & WATCH_WRITE) {
+		checkWatch(WATCH_WRITE, index, val);
+	}
+	if (read_pages[page] != &memory[page * PAGE_SIZE]) {
+		unsharePage(page);
+	}
 	memory[index] = val;
 }
 
+/**
+ * [DESCRIPTION] Give this cpu its own copy of a shared ROM page, writes to ROM
+ * 				 land in memory like they always have (copy on write)
+ *
+ * [PARAM] page
+*/
+void i8080::i8080_Memory::unsharePage(int page)
+{
+	uint8_t* own = &memory[page * PAGE_SIZE];
+	if (read_pages[page] != own) {
+		memcpy(own, read_pages[page], PAGE_SIZE);
+	}
+	read_pages[page] = own;
+	// write watched pages stay on the slow path
+	write_pages[page] = (watch_pages[page] & WATCH_WRITE) ? NULL : own;
+}
+
+/**
+ * [DESCRIPTION] Point the pages of the passed range at shared read only ROM
+ * 				 instead of this cpu's memory, partial pages at the ends are
+ * 				 copied in
+ *
+ * [PARAM] address
+ * [PARAM] data - must stay mapped for as long as the cpu uses it
+ * [PARAM] size
+*/
+void i8080::i8080_Memory::mapRom(uint16_t address, const uint8_t* data, size_t size)
+{
+	if (address + size > 0x10000) {
+		size = 0x10000 - address;
+	}
+
+	size_t offset = 0;
+	while (offset < size) {
+		uint32_t at = address + (uint32_t)offset;
+		int page = at >> PAGE_SHIFT;
+		size_t in_page = PAGE_SIZE - (at & (PAGE_SIZE - 1));
+		size_t count = (size - offset) < in_page ? (size - offset) : in_page;
+
+		if (count == PAGE_SIZE) {
+			read_pages[page] = data + offset;
+			write_pages[page] = NULL;
+		}
+		else {
+			if (isShared((uint16_t)at)) {
+				unsharePage(page);
+			}
+			memcpy(&memory[at], data + offset, count);
+		}
+		offset += count;
+	}
+}
+
+/**
+ * [DESCRIPTION] Check if the page holding the address still reads shared ROM
+ *
+ * [PARAM] index
+ * [RETURN] bool
+*/
+bool i8080::i8080_Memory::isShared(uint16_t index)
+{
+	int page = index >> PAGE_SHIFT;
+	return read_pages[page] != &memory[page * PAGE_SIZE];
+}
+
+/**
+ * [DESCRIPTION] Arm a watchpoint, the pages it covers are flagged so only
+ * 				 accesses to them are ever compared against the list
+ * 		- Write watched pages lose their write pointer, so the NULL check
+ * 		  set() already makes for shared ROM sends their writes to setSlow
+ * 		- Reads and execution are checked by the caller before each opcode
+ * 		  while any watchpoint is armed (see isWatched/checkWatch)
+ *
+ * [PARAM] watchpoint
+*/
+void i8080::i8080_Memory::addWatchpoint(const Watchpoint& watchpoint)
+{
+	watchpoints.push_back(watchpoint);
+	for (int page = watchpoint.first >> PAGE_SHIFT; page <= (watchpoint.last >> PAGE_SHIFT); page++) {
+		watch_pages[page] |= watchpoint.kinds;
+		if (watchpoint.kinds & WATCH_WRITE) {
+			write_pages[page] = NULL;
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Disarm every watchpoint and give the pages their write
+ * 				 pointers back (shared ROM pages stay on the slow path)
+ *
+*/
+void i8080::i8080_Memory::clearWatchpoints()
+{
+	watchpoints.clear();
+	watch_hit = false;
+	for (int page = 0; page < NUM_PAGES; page++) {
+		watch_pages[page] = 0;
+		if (!isShared((uint16_t)(page << PAGE_SHIFT))) {
+			write_pages[page] = &memory[page * PAGE_SIZE];
+		}
+	}
+}
+
+/**
+ * [DESCRIPTION] Check if any watchpoint is armed
+ *
+ * [RETURN] bool
+*/
+bool i8080::i8080_Memory::hasWatchpoints()
+{
+	return !watchpoints.empty();
+}
+
+/**
+ * [DESCRIPTION] Check if the page holding the address has the passed kind of
+ * 				 watchpoint armed anywhere on it
+ *
+ * [PARAM] index
+ * [PARAM] kind - WATCH_* bit
+ * [RETURN] bool
+*/
+bool i8080::i8080_Memory::isWatched(uint16_t index, uint8_t kind)
+{
+	return (watch_pages[index >> PAGE_SHIFT] & kind) != 0;
+}
+
+/**
+ * [DESCRIPTION] Compare an access against the armed watchpoints and latch the
+ * 				 first one that matches
+ *
+ * [PARAM] kind - WATCH_* bit
+ * [PARAM] index
+ * [PARAM] val - byte read/written
+ * [RETURN] true if a watchpoint matched
+*/
+bool i8080::i8080_Memory::checkWatch(uint8_t kind, uint16_t index, uint8_t val)
+{
+	for (const Watchpoint& watchpoint : watchpoints) {
+		if ((watchpoint.kinds & kind) && index >= watchpoint.first && index <= watchpoint.last &&
+			(watchpoint.value < 0 || watchpoint.value == val)) {
+			if (!watch_hit) {
+				watch_hit = true;
+				last_hit = { kind, index, val };
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * [DESCRIPTION] Return the latched watchpoint hit and clear it
+ *
+ * [PARAM] hit - filled in if there was one
+ * [RETURN] false if nothing matched since the last call
+*/
+bool i8080::i8080_Memory::takeWatchHit(WatchHit& hit)
+{
+	if (!watch_hit) {
+		return false;
+	}
+	hit = last_hit;
+	watch_hit = false;
+	return true;
+}
+
 /**
  * [DESCRIPTION] Gets the adr value from memory
  * 
@@ -69,8 +262,9 @@ void i8080::i8080_Memory::set_M(uint8_t val)
  * 
  * [PARAM] fileName 
  * [PARAM] address 
+ * [RETURN] false if the file could not be read or does not fit
 */
-void i8080::i8080_Memory::loadRom(const char* fileName, size_t address)
+bool i8080::i8080_Memory::loadRom(const char* fileName, size_t address)
 {
 	// Open the ROM file
 #pragma warning(disable:4996)
@@ -79,27 +273,40 @@ void i8080::i8080_Memory::loadRom(const char* fileName, size_t address)
     // Check if the file was opened
 	if (f==NULL)
 	{
-		printf("ERROR OPENING %s\nn", fileName);
+		printf("ERROR OPENING %s\n", fileName);
+		return false;
 	}
 
     // Find the end of the file
-#pragma warning(disable:6387)
 	fseek(f, 0L, SEEK_END);
-	int file_size = ftell(f);
+	long file_size = ftell(f);
 	fseek(f, 0L, SEEK_SET);
-	
-    // Create a temporary pointer to the location we want to copy the
-    // ROM into 
-	uint8_t *temp_buffer = &memory[address];
 
-    // Read the data from the file into the temporary pointer which
-    // copies it into the mem_array
-	fread(temp_buffer, file_size, 1, f);
+	// the file has to fit between the address and the end of memory
+	if (file_size <= 0 || address >= 0x10000 || (size_t)file_size > 0x10000 - address) {
+		printf("ROM %s (%ld BYTES) DOES NOT FIT AT %04zx\n", fileName, file_size, address);
+		fclose(f);
+		return false;
+	}
+
+	// the pages being loaded stop being shared
+	for (size_t page = address >> PAGE_SHIFT; page <= (address + file_size - 1) >> PAGE_SHIFT; page++) {
+		if (isShared((uint16_t)(page << PAGE_SHIFT))) {
+			unsharePage((int)page);
+		}
+	}
+
+    // Read the data from the file straight into memory
+	size_t read = fread(&memory[address], 1, (size_t)file_size, f);
 
     // Close the file
 	fclose(f);
 
-    return;
+	if (read != (size_t)file_size) {
+		printf("ERROR READING %s\n", fileName);
+		return false;
+	}
+    return true;
 }
 
 /**
@@ -112,16 +319,34 @@ i8080::i8080_Memory::i8080_Memory(i8080_Registers* parent_registers)
 	registers = parent_registers;
 	memory = (uint8_t*)malloc(0x10000);
 	memset(memory, 0, 0x10000);
+
+	// every page starts out as this cpu's own memory
+	for (int page = 0; page < NUM_PAGES; page++) {
+		read_pages[page] = &memory[page * PAGE_SIZE];
+		write_pages[page] = &memory[page * PAGE_SIZE];
+		watch_pages[page] = 0;
+	}
+	watch_hit = false;
+}
+
+/**
+ * [DESCRIPTION] Destroy the i8080 Memory::i8080 Memory object
+ * 
+*/
+i8080::i8080_Memory::~i8080_Memory()
+{
+	free(memory);
 }
 
 /**
- * [DESCRIPTION] Returns the memory address at the passed index
+ * [DESCRIPTION] Returns the memory address at the passed index, only RAM can be
+ * 				 read through it (shared ROM pages are not in memory)
  *
  * [PARAM] index
  * [RETURN] void*
 */
 void* i8080::i8080_Memory::returnPtrToMem(int index)
 {
-	return (void*)&memory[0x2400];
+	return (void*)&memory[index];
 }
 
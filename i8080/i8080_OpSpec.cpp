@@ -0,0 +1,69 @@
+/**
+ * [FILE] i8080_OpSpec.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the disassembler built on the instruction set table
+ * [DATE] 2021-06-21
+*/
+
+#include "i8080_OpSpec.h"
+#include <cstdio>
+
+constexpr i8080_OpSpec::Pattern i8080_OpSpec::PATTERNS[];
+
+static const char* const REGISTER_NAMES[8] = { "B", "C", "D", "E", "H", "L", "M", "A" };
+static const char* const PAIR_NAMES[4] = { "B", "D", "H", "SP" };
+static const char* const CONDITION_NAMES[8] = { "NZ", "Z", "NC", "C", "PO", "PE", "P", "M" };
+
+/**
+ * [DESCRIPTION] Return the size of an opcode in bytes
+ *
+ * [PARAM] op
+ * [RETURN] int (1-3)
+*/
+int i8080_OpSpec::getLength(uint8_t op)
+{
+    return find(op).length;
+}
+
+/**
+ * [DESCRIPTION] Write an opcode as assembly ("MVI A,$1F", "JNZ $0A3C")
+ *
+ * [PARAM] bytes - the opcode and the 2 bytes after it
+ * [PARAM] text
+ * [PARAM] size - of text
+ * [RETURN] int (length of the opcode)
+*/
+int i8080_OpSpec::disassemble(const uint8_t* bytes, char* text, size_t size)
+{
+    uint8_t op = bytes[0];
+    const Pattern& pattern = find(op);
+
+    // "*" stands for the condition
+    char mnemonic[8];
+    if (pattern.mnemonic[1] == '*') {
+        snprintf(mnemonic, sizeof(mnemonic), "%c%s", pattern.mnemonic[0], CONDITION_NAMES[(op >> 3) & 0x07]);
+    }
+    else {
+        snprintf(mnemonic, sizeof(mnemonic), "%s", pattern.mnemonic);
+    }
+
+    const char* dst = REGISTER_NAMES[(op >> 3) & 0x07];
+    const char* src = REGISTER_NAMES[op & 0x07];
+    const char* pair = PAIR_NAMES[(op >> 4) & 0x03];
+    unsigned d8 = bytes[1];
+    unsigned a16 = (bytes[2] << 8) | bytes[1];
+    switch (pattern.operands) {
+    case DST_SRC:   snprintf(text, size, "%s %s,%s", mnemonic, dst, src); break;
+    case DST:       snprintf(text, size, "%s %s", mnemonic, dst); break;
+    case SRC:       snprintf(text, size, "%s %s", mnemonic, src); break;
+    case DST_D8:    snprintf(text, size, "%s %s,$%02X", mnemonic, dst, d8); break;
+    case RP:        snprintf(text, size, "%s %s", mnemonic, pair); break;
+    case RP_PSW:    snprintf(text, size, "%s %s", mnemonic, ((op >> 4) & 0x03) == 3 ? "PSW" : pair); break;
+    case RP_D16:    snprintf(text, size, "%s %s,$%04X", mnemonic, pair, a16); break;
+    case D8:        snprintf(text, size, "%s $%02X", mnemonic, d8); break;
+    case A16:       snprintf(text, size, "%s $%04X", mnemonic, a16); break;
+    case RST_N:     snprintf(text, size, "%s %d", mnemonic, (op >> 3) & 0x07); break;
+    default:        snprintf(text, size, "%s", mnemonic); break;
+    }
+    return pattern.length;
+}
@@ -0,0 +1,172 @@
+/**
+ * [FILE] i8080_OpSpec.h
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the i8080 instruction set as a table of encoding patterns,
+ *               the interpreter's opcode handlers are generated from it and the
+ *               disassembler, the opcode trace and the profiler read it
+ *      RESOURCES:
+ *          https://pastraiser.com/cpu/i8080/i8080_opcodes.html
+ *          https://altairclone.com/downloads/manuals/8080%20Programmers%20Manual.pdf
+ * [DATE] 2021-06-21
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * [DESCRIPTION] Class holding the instruction set
+ *      - A row covers every opcode whose bits under mask equal bits, the
+ *        rest of the opcode is its operands (DDD = bits 5-3, SSS = bits 2-0,
+ *        RP = bits 5-4, CCC = bits 5-3, NNN = bits 5-3)
+ *      - find() returns the first row that matches, so the rows of an opcode
+ *        that is an exception (HLT inside MOV, the PSW pushes) come first
+ *      - Registers are numbered as the opcodes encode them: B C D E H L M A,
+ *        register pairs BC DE HL SP (PSW in place of SP for PUSH/POP) and
+ *        conditions NZ Z NC C PO PE P M
+*/
+class i8080_OpSpec {
+public:
+    enum Family : uint8_t {
+        NOP, HLT, MOV, MVI, INR, DCR, ALU,      // ALU: the operation is bits 5-3 (ADD ADC SUB SBB ANA XRA ORA CMP)
+        LXI, STAX, LDAX, INX, DCX, DAD, SHLD, LHLD, STA, LDA,
+        RLC, RRC, RAL, RAR, DAA, CMA, STC, CMC,
+        JMP, JMP_CC, CALL, CALL_CC, RET, RET_CC, RST, POP, PUSH,
+        XTHL, XCHG, PCHL, SPHL, OUT, IN, DI, EI
+    };
+
+    enum Operands : uint8_t {
+        NONE,
+        DST_SRC,        // MOV DDD,SSS
+        DST,            // DDD
+        SRC,            // SSS
+        DST_D8,         // DDD,byte 2
+        RP,             // RP
+        RP_PSW,         // RP with PSW in place of SP
+        RP_D16,         // RP,bytes 3:2
+        D8,             // byte 2 (data or port)
+        A16,            // bytes 3:2
+        RST_N           // NNN
+    };
+
+    // flags a row can change, in their PSW positions
+    static const uint8_t FLAG_S  = 0x80;
+    static const uint8_t FLAG_Z  = 0x40;
+    static const uint8_t FLAG_AC = 0x10;
+    static const uint8_t FLAG_P  = 0x04;
+    static const uint8_t FLAG_C  = 0x01;
+    static const uint8_t FLAG_ALL = FLAG_S | FLAG_Z | FLAG_AC | FLAG_P | FLAG_C;
+
+    struct Pattern {
+        uint8_t     mask;           // bits of the opcode the row fixes
+        uint8_t     bits;           // their value
+        Family      family;
+        const char* mnemonic;       // "*" is replaced by the condition (J* = JNZ ... JM)
+        Operands    operands;
+        uint8_t     length;         // bytes, opcode included
+        uint8_t     cycles;
+        uint8_t     cycles_alt;     // with an M operand, or when the condition holds
+        uint8_t     flags;          // FLAG_* bits it can change
+    };
+
+    static constexpr int NUM_PATTERNS = 61;
+    static constexpr Pattern PATTERNS[NUM_PATTERNS] = {
+        // mask bits  family    mnemonic operands  len  cyc  alt  flags
+        { 0xFF, 0x76, HLT,      "HLT",  NONE,       1,   7,   7,  0 },
+        { 0xC0, 0x40, MOV,      "MOV",  DST_SRC,    1,   5,   7,  0 },
+        { 0xC7, 0x00, NOP,      "NOP",  NONE,       1,   4,   4,  0 },        // 0x08-0x38 repeat it
+        { 0xCF, 0x01, LXI,      "LXI",  RP_D16,     3,  10,  10,  0 },
+        { 0xEF, 0x02, STAX,     "STAX", RP,         1,   7,   7,  0 },
+        { 0xFF, 0x22, SHLD,     "SHLD", A16,        3,  16,  16,  0 },
+        { 0xFF, 0x32, STA,      "STA",  A16,        3,  13,  13,  0 },
+        { 0xCF, 0x03, INX,      "INX",  RP,         1,   5,   5,  0 },
+        { 0xC7, 0x04, INR,      "INR",  DST,        1,   5,  10,  FLAG_S | FLAG_Z | FLAG_AC | FLAG_P },
+        { 0xC7, 0x05, DCR,      "DCR",  DST,        1,   5,  10,  FLAG_S | FLAG_Z | FLAG_AC | FLAG_P },
+        { 0xC7, 0x06, MVI,      "MVI",  DST_D8,     2,   7,  10,  0 },
+        { 0xFF, 0x07, RLC,      "RLC",  NONE,       1,   4,   4,  FLAG_C },
+        { 0xFF, 0x0F, RRC,      "RRC",  NONE,       1,   4,   4,  FLAG_C },
+        { 0xFF, 0x17, RAL,      "RAL",  NONE,       1,   4,   4,  FLAG_C },
+        { 0xFF, 0x1F, RAR,      "RAR",  NONE,       1,   4,   4,  FLAG_C },
+        { 0xFF, 0x27, DAA,      "DAA",  NONE,       1,   4,   4,  FLAG_ALL },
+        { 0xFF, 0x2F, CMA,      "CMA",  NONE,       1,   4,   4,  0 },
+        { 0xFF, 0x37, STC,      "STC",  NONE,       1,   4,   4,  FLAG_C },
+        { 0xFF, 0x3F, CMC,      "CMC",  NONE,       1,   4,   4,  FLAG_C },
+        { 0xCF, 0x09, DAD,      "DAD",  RP,         1,  10,  10,  FLAG_C },
+        { 0xEF, 0x0A, LDAX,     "LDAX", RP,         1,   7,   7,  0 },
+        { 0xFF, 0x2A, LHLD,     "LHLD", A16,        3,  16,  16,  0 },
+        { 0xFF, 0x3A, LDA,      "LDA",  A16,        3,  13,  13,  0 },
+        { 0xCF, 0x0B, DCX,      "DCX",  RP,         1,   5,   5,  0 },
+        { 0xF8, 0x80, ALU,      "ADD",  SRC,        1,   4,   7,  FLAG_ALL },
+        { 0xF8, 0x88, ALU,      "ADC",  SRC,        1,   4,   7,  FLAG_ALL },
+        { 0xF8, 0x90, ALU,      "SUB",  SRC,        1,   4,   7,  FLAG_ALL },
+        { 0xF8, 0x98, ALU,      "SBB",  SRC,        1,   4,   7,  FLAG_ALL },
+        { 0xF8, 0xA0, ALU,      "ANA",  SRC,        1,   4,   7,  FLAG_S | FLAG_Z | FLAG_P | FLAG_C },
+        { 0xF8, 0xA8, ALU,      "XRA",  SRC,        1,   4,   7,  FLAG_ALL },
+        { 0xF8, 0xB0, ALU,      "ORA",  SRC,        1,   4,   7,  FLAG_S | FLAG_Z | FLAG_P | FLAG_C },
+        { 0xF8, 0xB8, ALU,      "CMP",  SRC,        1,   4,   7,  FLAG_ALL },
+        { 0xF7, 0xD0, RET_CC,   "R*",   NONE,       1,   5,  11,  0 },        // RNC RC
+        { 0xFF, 0xF8, RET_CC,   "R*",   NONE,       1,   5,  11,  0 },        // RM
+        { 0xC7, 0xC0, RET_CC,   "R*",   NONE,       1,   5,  16,  0 },        // RNZ RZ RPO RPE RP
+        { 0xFF, 0xF1, POP,      "POP",  RP_PSW,     1,  10,  10,  FLAG_ALL },
+        { 0xCF, 0xC1, POP,      "POP",  RP_PSW,     1,  10,  10,  0 },
+        { 0xC7, 0xC2, JMP_CC,   "J*",   A16,        3,  10,  10,  0 },
+        { 0xF7, 0xC3, JMP,      "JMP",  A16,        3,  10,  10,  0 },        // 0xCB repeats it
+        { 0xFF, 0xD3, OUT,      "OUT",  D8,         2,  10,  10,  0 },
+        { 0xFF, 0xDB, IN,       "IN",   D8,         2,  10,  10,  0 },
+        { 0xFF, 0xE3, XTHL,     "XTHL", NONE,       1,  18,  18,  0 },
+        { 0xFF, 0xEB, XCHG,     "XCHG", NONE,       1,   5,   5,  0 },
+        { 0xFF, 0xF3, DI,       "DI",   NONE,       1,   4,   4,  0 },
+        { 0xFF, 0xFB, EI,       "EI",   NONE,       1,   4,   4,  0 },
+        { 0xC7, 0xC4, CALL_CC,  "C*",   A16,        3,  11,  17,  0 },
+        { 0xCF, 0xC5, PUSH,     "PUSH", RP_PSW,     1,  11,  11,  0 },
+        { 0xFF, 0xC6, ALU,      "ADI",  D8,         2,   7,   7,  FLAG_ALL },
+        { 0xFF, 0xCE, ALU,      "ACI",  D8,         2,   7,   7,  FLAG_ALL },
+        { 0xFF, 0xD6, ALU,      "SUI",  D8,         2,   7,   7,  FLAG_ALL },
+        { 0xFF, 0xDE, ALU,      "SBI",  D8,         2,   7,   7,  FLAG_ALL },
+        { 0xFF, 0xE6, ALU,      "ANI",  D8,         2,   7,   7,  FLAG_S | FLAG_Z | FLAG_P | FLAG_C },
+        { 0xFF, 0xEE, ALU,      "XRI",  D8,         2,   7,   7,  FLAG_ALL },
+        { 0xFF, 0xF6, ALU,      "ORI",  D8,         2,   7,   7,  FLAG_S | FLAG_Z | FLAG_P | FLAG_C },
+        { 0xFF, 0xFE, ALU,      "CPI",  D8,         2,   7,   7,  FLAG_ALL },
+        { 0xC7, 0xC7, RST,      "RST",  RST_N,      1,  11,  11,  0 },
+        { 0xEF, 0xC9, RET,      "RET",  NONE,       1,  10,  10,  0 },        // 0xD9 repeats it
+        { 0xFF, 0xE9, PCHL,     "PCHL", NONE,       1,   5,   5,  0 },
+        { 0xFF, 0xF9, SPHL,     "SPHL", NONE,       1,   5,   5,  0 },
+        { 0xCF, 0xCD, CALL,     "CALL", A16,        3,  17,  17,  0 },        // 0xDD 0xED 0xFD repeat it
+        { 0x00, 0x00, NOP,      "???",  NONE,       1,   4,   4,  0 },        // never reached (see covered)
+    };
+
+    /**
+     * [DESCRIPTION] Return the row of an opcode
+     *
+     * [PARAM] op
+     * [RETURN] const Pattern&
+    */
+    static constexpr const Pattern& find(uint8_t op)
+    {
+        int i = 0;
+        while ((op & PATTERNS[i].mask) != PATTERNS[i].bits) {
+            i++;
+        }
+        return PATTERNS[i];
+    }
+
+    /**
+     * [DESCRIPTION] Check that every opcode has a row before the catch all
+     *
+     * [RETURN] bool
+    */
+    static constexpr bool covered()
+    {
+        for (int op = 0; op < 256; op++) {
+            if (&find(static_cast<uint8_t>(op)) == &PATTERNS[NUM_PATTERNS - 1]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static int  getLength(uint8_t op);      // bytes the opcode takes
+    static int  disassemble(const uint8_t* bytes, char* text, size_t size);   // returns the length
+};
+
+static_assert(i8080_OpSpec::covered(), "every opcode needs a row in i8080_OpSpec::PATTERNS");
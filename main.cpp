@@ -8,8 +8,41 @@
 */
 
 #include "Emulator/Emulator.h"
+#include "Emulator/EmulatorOptions.h"
+#include "Emulator/MetricsExport.h"
+#include "SpaceInvaders/SiHeadless.h"
+#include "SpaceInvaders/SiBatch.h"
+#include "SpaceInvaders/SiDiff.h"
+#include "SpaceInvaders/SiRecompiler.h"
+#include "SpaceInvaders/SiVideo.h"
 
 int main(int argc, char* argv[]) {
-	Emulator em;
+	EmulatorOptions options;
+	if (!options.parse(argc, argv)) {
+		EmulatorOptions::printUsage();
+		return 1;
+	}
+
+	// headless runs never touch SDL
+	if (options.metrics_read != 0) {
+		return MetricsExport::printProcess(options.metrics_read);
+	}
+	if (options.export_video != nullptr) {
+		return SiVideo::exportVideo(options);
+	}
+	if (options.recompile_path != nullptr) {
+		return SiRecompiler::run(options);
+	}
+	if (options.diff_engine != nullptr) {
+		return SiDiff::run(options);
+	}
+	if (options.isBatch()) {
+		return SiBatch::run(options);
+	}
+	if (options.headless) {
+		return SiHeadless::run(options);
+	}
+
+	Emulator em(options);
 	return 0;
 }
\ No newline at end of file
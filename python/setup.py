@@ -0,0 +1,32 @@
+# [FILE] setup.py
+# [AUTHOR] Madison Woy
+# [DESCRIPTION] Builds the si_env Python extension (batched Space Invaders environments)
+#               python setup.py build_ext --inplace
+# [DATE] 2021-06-09
+
+import glob
+import os
+import sys
+from setuptools import setup, Extension
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+sources = ["si_env_module.cpp"]
+sources += sorted(glob.glob(os.path.join(ROOT, "i8080", "*.cpp")))
+sources += [os.path.join(ROOT, "Emulator", name) for name in ("RomSet.cpp", "XxHash.cpp")]
+sources += [os.path.join(ROOT, "SpaceInvaders", name) for name in
+            ("SiMachine.cpp", "SiMovie.cpp", "SiEnv.cpp",
+             "SiRecompiled.cpp", "SiRecompiledBlocks.cpp")]
+sources = [os.path.relpath(path) for path in sources]
+
+if sys.platform == "win32":
+    compile_args = ["/std:c++14", "/O2"]       # the project's standard (Emulator_8080.vcxproj)
+else:
+    compile_args = ["-std=c++14", "-O2"]
+
+setup(
+    name="si_env",
+    version="1.0",
+    description="Batched Space Invaders environments on the i8080 emulator",
+    ext_modules=[Extension("si_env", sources=sources, extra_compile_args=compile_args)],
+)
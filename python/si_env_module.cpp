@@ -0,0 +1,338 @@
+/**
+ * [FILE] si_env_module.cpp
+ * [AUTHOR] Madison Woy
+ * [DESCRIPTION] Contains the si_env Python extension module, a thin wrapper around
+ *               SiEnv that reads actions from and writes results into caller owned
+ *               buffers (numpy arrays, bytearrays, array.array ...)
+ * [DATE] 2021-06-09
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "../SpaceInvaders/SiEnv.h"
+
+/**
+ * [DESCRIPTION] Python object wrapping a SiEnv
+ *
+*/
+struct EnvObject {
+	PyObject_HEAD
+	SiEnv* env;
+};
+
+/**
+ * [DESCRIPTION] Python object exporting one environment's VRAM as a read only
+ *               buffer, it keeps the Env alive for as long as the view exists
+ *
+*/
+struct VramObject {
+	PyObject_HEAD
+	EnvObject* owner;
+	uint8_t* vram;
+};
+
+/**
+ * [DESCRIPTION] Get a writable (or read only) contiguous buffer and check its size
+ *
+ * [PARAM] obj - object exporting the buffer protocol
+ * [PARAM] view - filled in, must be released by the caller on success
+ * [PARAM] item_size - bytes per element the caller expects
+ * [PARAM] count - elements the caller expects
+ * [PARAM] writable
+ * [PARAM] name - argument name used in the error message
+ * [RETURN] bool - true on success, false with a Python error set
+*/
+static bool getBuffer(PyObject* obj, Py_buffer* view, Py_ssize_t item_size, Py_ssize_t count,
+	bool writable, const char* name)
+{
+	int flags = PyBUF_C_CONTIGUOUS | (writable ? PyBUF_WRITABLE : 0);
+	if (PyObject_GetBuffer(obj, view, flags) != 0) {
+		return false;
+	}
+	if (view->itemsize != item_size || view->len != item_size * count) {
+		PyErr_Format(PyExc_ValueError, "%s must hold %zd items of %zd bytes", name, count, item_size);
+		PyBuffer_Release(view);
+		return false;
+	}
+	return true;
+}
+
+// VRAM VIEW =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static int Vram_getbuffer(VramObject* self, Py_buffer* view, int flags)
+{
+	return PyBuffer_FillInfo(view, (PyObject*)self, self->vram, SiEnv::VRAM_BYTES, 1, flags);
+}
+
+static void Vram_dealloc(VramObject* self)
+{
+	Py_XDECREF(self->owner);
+	Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyBufferProcs Vram_as_buffer = {
+	(getbufferproc)Vram_getbuffer,
+	NULL,
+};
+
+static PyTypeObject VramType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"si_env.Vram",                          // tp_name
+	sizeof(VramObject),                     // tp_basicsize
+};
+
+// ENV =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static int Env_init(EnvObject* self, PyObject* args, PyObject* kwds)
+{
+	static const char* kwlist[] = { "num_envs", "frame_skip", "seed", "noop_max", "rom_dir", NULL };
+	int num_envs;
+	int frame_skip = 4;
+	unsigned long long seed = 0;
+	int noop_max = 30;
+	const char* rom_dir = "SpaceInvaders/rom";
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "i|iKis", (char**)kwlist,
+		&num_envs, &frame_skip, &seed, &noop_max, &rom_dir)) {
+		return -1;
+	}
+	if (num_envs < 1) {
+		PyErr_SetString(PyExc_ValueError, "num_envs must be at least 1");
+		return -1;
+	}
+
+	delete self->env;
+	Py_BEGIN_ALLOW_THREADS
+	self->env = new SiEnv(num_envs, frame_skip, seed, noop_max, rom_dir);
+	Py_END_ALLOW_THREADS
+	if (!self->env->isLoaded()) {
+		delete self->env;
+		self->env = NULL;
+		PyErr_Format(PyExc_RuntimeError, "could not load the ROM set from %s", rom_dir);
+		return -1;
+	}
+	return 0;
+}
+
+static void Env_dealloc(EnvObject* self)
+{
+	delete self->env;
+	Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static bool Env_check(EnvObject* self)
+{
+	if (self->env == NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "Env was not initialized");
+		return false;
+	}
+	return true;
+}
+
+static PyObject* Env_reset(EnvObject* self, PyObject* args)
+{
+	int env = -1;
+	if (!Env_check(self) || !PyArg_ParseTuple(args, "|i", &env)) {
+		return NULL;
+	}
+	if (env >= self->env->getNumEnvs()) {
+		PyErr_SetString(PyExc_IndexError, "env out of range");
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	if (env < 0) {
+		self->env->reset();
+	}
+	else {
+		self->env->reset(env);
+	}
+	Py_END_ALLOW_THREADS
+	Py_RETURN_NONE;
+}
+
+static PyObject* Env_step(EnvObject* self, PyObject* args)
+{
+	PyObject* actions_obj;
+	PyObject* rewards_obj;
+	PyObject* dones_obj;
+	if (!Env_check(self) || !PyArg_ParseTuple(args, "OOO", &actions_obj, &rewards_obj, &dones_obj)) {
+		return NULL;
+	}
+
+	Py_ssize_t n = self->env->getNumEnvs();
+	Py_buffer actions, rewards, dones;
+	if (!getBuffer(actions_obj, &actions, 1, n, false, "actions")) {
+		return NULL;
+	}
+	if (!getBuffer(rewards_obj, &rewards, 4, n, true, "rewards")) {
+		PyBuffer_Release(&actions);
+		return NULL;
+	}
+	if (!getBuffer(dones_obj, &dones, 1, n, true, "dones")) {
+		PyBuffer_Release(&actions);
+		PyBuffer_Release(&rewards);
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	self->env->step((const uint8_t*)actions.buf, (int32_t*)rewards.buf, (uint8_t*)dones.buf);
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&actions);
+	PyBuffer_Release(&rewards);
+	PyBuffer_Release(&dones);
+	Py_RETURN_NONE;
+}
+
+static PyObject* Env_observations(EnvObject* self, PyObject* args)
+{
+	PyObject* out_obj;
+	if (!Env_check(self) || !PyArg_ParseTuple(args, "O", &out_obj)) {
+		return NULL;
+	}
+
+	Py_buffer out;
+	Py_ssize_t count = (Py_ssize_t)self->env->getNumEnvs() * SiEnv::OBS_HEIGHT * SiEnv::OBS_WIDTH;
+	if (!getBuffer(out_obj, &out, 1, count, true, "out")) {
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	self->env->observations((uint8_t*)out.buf);
+	Py_END_ALLOW_THREADS
+	PyBuffer_Release(&out);
+	Py_RETURN_NONE;
+}
+
+static PyObject* Env_observations_vram(EnvObject* self, PyObject* args)
+{
+	PyObject* out_obj;
+	if (!Env_check(self) || !PyArg_ParseTuple(args, "O", &out_obj)) {
+		return NULL;
+	}
+
+	Py_buffer out;
+	Py_ssize_t count = (Py_ssize_t)self->env->getNumEnvs() * SiEnv::VRAM_BYTES;
+	if (!getBuffer(out_obj, &out, 1, count, true, "out")) {
+		return NULL;
+	}
+	self->env->observationsVRAM((uint8_t*)out.buf);
+	PyBuffer_Release(&out);
+	Py_RETURN_NONE;
+}
+
+static PyObject* Env_vram(EnvObject* self, PyObject* args)
+{
+	int env;
+	if (!Env_check(self) || !PyArg_ParseTuple(args, "i", &env)) {
+		return NULL;
+	}
+	if (env < 0 || env >= self->env->getNumEnvs()) {
+		PyErr_SetString(PyExc_IndexError, "env out of range");
+		return NULL;
+	}
+
+	VramObject* vram = PyObject_New(VramObject, &VramType);
+	if (vram == NULL) {
+		return NULL;
+	}
+	Py_INCREF(self);
+	vram->owner = self;
+	vram->vram = (uint8_t*)self->env->observation(env);
+	PyObject* view = PyMemoryView_FromObject((PyObject*)vram);
+	Py_DECREF(vram);
+	return view;
+}
+
+static PyObject* Env_get_num_envs(EnvObject* self, void* closure)
+{
+	if (!Env_check(self)) {
+		return NULL;
+	}
+	return PyLong_FromLong(self->env->getNumEnvs());
+}
+
+static PyObject* Env_get_num_actions(EnvObject* self, void* closure)
+{
+	return PyLong_FromLong(SiEnv::NUM_ACTIONS);
+}
+
+static PyObject* Env_get_obs_shape(EnvObject* self, void* closure)
+{
+	return Py_BuildValue("(ii)", SiEnv::OBS_HEIGHT, SiEnv::OBS_WIDTH);
+}
+
+static PyMethodDef Env_methods[] = {
+	{ "reset", (PyCFunction)Env_reset, METH_VARARGS,
+		"reset(env=-1)\nStart a new episode on every env (or only on env)." },
+	{ "step", (PyCFunction)Env_step, METH_VARARGS,
+		"step(actions, rewards, dones)\nHold the uint8 actions for frame_skip frames, write the int32 "
+		"rewards and uint8 dones. Finished envs are reset straight away." },
+	{ "observations", (PyCFunction)Env_observations, METH_VARARGS,
+		"observations(out)\nWrite num_envs x obs_shape grayscale screens into the uint8 buffer out." },
+	{ "observations_vram", (PyCFunction)Env_observations_vram, METH_VARARGS,
+		"observations_vram(out)\nCopy every env's 7168 byte 1bpp VRAM into the uint8 buffer out." },
+	{ "vram", (PyCFunction)Env_vram, METH_VARARGS,
+		"vram(env)\nReturn a read only zero copy memoryview of the env's 1bpp VRAM." },
+	{ NULL }
+};
+
+static PyGetSetDef Env_getset[] = {
+	{ "num_envs", (getter)Env_get_num_envs, NULL, "number of environments", NULL },
+	{ "num_actions", (getter)Env_get_num_actions, NULL, "size of the action set", NULL },
+	{ "obs_shape", (getter)Env_get_obs_shape, NULL, "(height, width) of a grayscale observation", NULL },
+	{ NULL }
+};
+
+static PyTypeObject EnvType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"si_env.Env",                           // tp_name
+	sizeof(EnvObject),                      // tp_basicsize
+};
+
+// MODULE =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static PyModuleDef si_env_module = {
+	PyModuleDef_HEAD_INIT,
+	"si_env",
+	"Batched Space Invaders environments",
+	-1,
+};
+
+PyMODINIT_FUNC PyInit_si_env(void)
+{
+	VramType.tp_flags = Py_TPFLAGS_DEFAULT;
+	VramType.tp_dealloc = (destructor)Vram_dealloc;
+	VramType.tp_as_buffer = &Vram_as_buffer;
+	if (PyType_Ready(&VramType) < 0) {
+		return NULL;
+	}
+
+	EnvType.tp_flags = Py_TPFLAGS_DEFAULT;
+	EnvType.tp_doc = "Env(num_envs, frame_skip=4, seed=0, noop_max=30, rom_dir='SpaceInvaders/rom')";
+	EnvType.tp_new = PyType_GenericNew;
+	EnvType.tp_init = (initproc)Env_init;
+	EnvType.tp_dealloc = (destructor)Env_dealloc;
+	EnvType.tp_methods = Env_methods;
+	EnvType.tp_getset = Env_getset;
+	if (PyType_Ready(&EnvType) < 0) {
+		return NULL;
+	}
+
+	PyObject* module = PyModule_Create(&si_env_module);
+	if (module == NULL) {
+		return NULL;
+	}
+	Py_INCREF(&EnvType);
+	if (PyModule_AddObject(module, "Env", (PyObject*)&EnvType) < 0) {
+		Py_DECREF(&EnvType);
+		Py_DECREF(module);
+		return NULL;
+	}
+	PyModule_AddIntConstant(module, "NOOP", SiEnv::ACTION_NOOP);
+	PyModule_AddIntConstant(module, "FIRE", SiEnv::ACTION_FIRE);
+	PyModule_AddIntConstant(module, "RIGHT", SiEnv::ACTION_RIGHT);
+	PyModule_AddIntConstant(module, "LEFT", SiEnv::ACTION_LEFT);
+	PyModule_AddIntConstant(module, "RIGHT_FIRE", SiEnv::ACTION_RIGHT_FIRE);
+	PyModule_AddIntConstant(module, "LEFT_FIRE", SiEnv::ACTION_LEFT_FIRE);
+	return module;
+}